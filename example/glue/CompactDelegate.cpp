@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrhashtable.h"
+
+#include "CompactScheme.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MarkMap.hpp"
+#include "omrExampleVM.hpp"
+#include "OMRVMThreadListIterator.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+#include "Task.hpp"
+
+#include "CompactDelegate.hpp"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+void
+MM_CompactDelegate::fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme)
+{
+	if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		J9HashTableState state;
+		RootEntry *rEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+		while (NULL != rEntry) {
+			rEntry->rootPtr = compactScheme->getForwardingPtr(rEntry->rootPtr);
+			rEntry = (RootEntry *)hashTableNextDo(&state);
+		}
+
+		/* Dead entries were removed from the object table once marking completed */
+		ObjectEntry *objEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+		while (NULL != objEntry) {
+			objEntry->objPtr = compactScheme->getForwardingPtr(objEntry->objPtr);
+			objEntry = (ObjectEntry *)hashTableNextDo(&state);
+		}
+
+		OMR_VMThread *walkThread = NULL;
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+			if (NULL != walkThread->_savedObject1) {
+				walkThread->_savedObject1 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject1);
+			}
+			if (NULL != walkThread->_savedObject2) {
+				walkThread->_savedObject2 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject2);
+			}
+		}
+	}
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/* Remembered objects that did not survive the collection are dropped, the others are forwarded */
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator remSetIterator(&env->getExtensions()->rememberedSet);
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			omrobjectptr_t *slotPtr = NULL;
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				if ((NULL == *slotPtr) || !_markMap->isBitSet(*slotPtr)) {
+					remSetSlotIterator.removeSlot();
+				} else {
+					*slotPtr = compactScheme->getForwardingPtr(*slotPtr);
+				}
+			}
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+}
+
+#endif /* OMR_GC_MODRON_COMPACTION */
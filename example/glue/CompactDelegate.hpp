@@ -74,8 +74,16 @@ public:
 	void
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
+	/**
+	 * Update the roots held by the example VM (the root and object tables and the objects saved by
+	 * each thread) and the remembered set to point to the forwarded objects. Called by every GC thread
+	 * once the heap objects have been moved; the work is shared out in work units.
+	 *
+	 * @param env environment for calling thread
+	 * @param compactScheme the compact scheme providing the forwarding addresses
+	 */
 	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
@@ -84,9 +92,9 @@ public:
 	masterSetupForGC(MM_EnvironmentBase *env) { }
 
 	MM_CompactDelegate()
-		: _compactScheme(NULL)
+		: _omrVM(NULL)
+		, _compactScheme(NULL)
 		, _markMap(NULL)
-		, _omrVM(NULL)
 	{}
 };
 
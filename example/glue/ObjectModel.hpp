@@ -66,6 +66,16 @@ public:
 	 */
 	virtual void tearDown(MM_GCExtensionsBase *extensions) {}
 
+	/**
+	 * Declare the hot fields of example objects (see GC_ObjectModelDelegate::getHotFieldsDescriptor()).
+	 * @param hotFieldsDescriptor bit n is set if the nth slot following the object header is hot
+	 */
+	MMINLINE void
+	setHotFieldsDescriptor(uintptr_t hotFieldsDescriptor)
+	{
+		getObjectModelDelegate()->setHotFieldsDescriptor(hotFieldsDescriptor);
+	}
+
 	/**
 	 * Set size in object header, with header flags.
 	 * @param objectPtr Pointer to an object
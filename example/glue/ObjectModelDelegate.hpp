@@ -59,6 +59,8 @@ private:
 	static const uintptr_t _objectHeaderSlotFlagsShift = 0;
 	static const uintptr_t _objectHeaderSlotSizeShift = 8;
 
+	uintptr_t _hotFieldsDescriptor; /**< Bit n is set if the nth slot following the object header is a hot field (example objects share a single shape) */
+
 protected:
 public:
 
@@ -110,6 +112,31 @@ public:
 		return _objectHeaderSlotFlagsShift;
 	}
 
+	/**
+	 * Get the hot fields descriptor for an object. Bit n of the descriptor is set if the nth fomrobject_t
+	 * slot following the object header is a hot field, ie a field that the mutator usually dereferences
+	 * shortly after accessing the object. The scavenger may copy the referents of hot fields next to their
+	 * parent. Languages with more than one object shape would derive this from the object's class.
+	 *
+	 * @param objectPtr the object to obtain the hot fields descriptor for
+	 * @return the hot fields descriptor, or 0 if the object has no hot fields
+	 */
+	MMINLINE uintptr_t
+	getHotFieldsDescriptor(omrobjectptr_t objectPtr)
+	{
+		return _hotFieldsDescriptor;
+	}
+
+	/**
+	 * Declare the hot fields of example objects.
+	 * @param hotFieldsDescriptor bit n is set if the nth slot following the object header is hot
+	 */
+	MMINLINE void
+	setHotFieldsDescriptor(uintptr_t hotFieldsDescriptor)
+	{
+		_hotFieldsDescriptor = hotFieldsDescriptor;
+	}
+
 	/**
 	 * Get the exact size of the object header, in bytes. This includes the size of the metadata slot.
 	 */
@@ -255,6 +282,8 @@ public:
 	/**
 	 * Constructor receives a copy of OMR's object flags mask, normalized to low order byte.
 	 */
-	GC_ObjectModelDelegate(fomrobject_t omrHeaderSlotFlagsMask) {}
+	GC_ObjectModelDelegate(fomrobject_t omrHeaderSlotFlagsMask)
+		: _hotFieldsDescriptor(0)
+	{}
 };
 #endif /* OBJECTMODELDELEGATE_HPP_ */
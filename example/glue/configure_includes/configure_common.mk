@@ -29,5 +29,7 @@ CONFIGURE_ARGS += \
   --enable-OMR_GC_SEGREGATED_HEAP \
   --enable-OMR_GC_MODRON_SCAVENGER \
   --enable-OMR_GC_MODRON_CONCURRENT_MARK \
+  --enable-OMR_GC_MODRON_COMPACTION \
+  --enable-OMR_GC_CONCURRENT_SWEEP \
   --enable-OMR_THR_CUSTOM_SPIN_OPTIONS \
   --enable-OMR_NOTIFY_POLICY_CONTROL
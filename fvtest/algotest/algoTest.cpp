@@ -169,6 +169,11 @@ TEST_P(AVLTest, test)
 
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, AVLTest, ::testing::ValuesIn(avlParams));
 
+TEST(OmrAlgoTest, RangeBTreeTest)
+{
+	ASSERT_EQ(0, verifyRangeBTree(omrTestEnv->getPortLibrary()));
+}
+
 class PoolTest: public ::testing::TestWithParam<PoolInputData>
 {
 };
@@ -187,6 +192,16 @@ TEST(OmrAlgoTest, PoolTestPuddleSharing)
 	ASSERT_EQ(0, testPoolPuddleListSharing(omrTestEnv->getPortLibrary()));
 }
 
+TEST(OmrAlgoTest, PoolTestBulkElements)
+{
+	ASSERT_EQ(0, testPoolBulkElements(omrTestEnv->getPortLibrary()));
+}
+
+TEST(OmrAlgoTest, PoolTestMagazines)
+{
+	ASSERT_EQ(0, testPoolMagazines(omrTestEnv->getPortLibrary()));
+}
+
 TEST(OmrAlgoTest, hookabletest)
 {
 	uintptr_t passCount = 0;
@@ -223,6 +238,32 @@ TEST_P(HashtableTest, NoForce)
 
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, HashtableTest, ::testing::ValuesIn(hastableParams));
 
+class OpenAddressingHashtableTest: public ::testing::TestWithParam<HashtableInputData>
+{
+};
+
+TEST_P(OpenAddressingHashtableTest, Force)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(OpenAddressingHashtableTest, NoForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, OpenAddressingHashtableTest, ::testing::ValuesIn(hastableParams));
+
 class CollisionResilientHashtableTest: public ::testing::TestWithParam< ::testing::tuple<HashtableInputData, uint32_t> >
 {
 };
@@ -254,6 +295,11 @@ INSTANTIATE_TEST_CASE_P(OmrAlgoTest, CollisionResilientHashtableTest,
 	)
 );
 
+TEST(OmrAlgoTest, ConcurrentHashtableTest)
+{
+	ASSERT_EQ(0, verifyConcurrentHashtable(omrTestEnv->getPortLibrary()));
+}
+
 static void
 showResult(OMRPortLibrary *portlib, uintptr_t passCount, uintptr_t failCount, int32_t numSuitesNotRun)
 {
@@ -50,6 +50,7 @@ typedef struct HashtableInputData {
 	uint32_t listToTreeThreshold;
 	BOOLEAN forceCollisions;
 	BOOLEAN collisionResistant;
+	BOOLEAN openAddressing;
 } HashtableInputData;
 
 /* ---------------- avltest.c ---------------- */
@@ -63,6 +64,16 @@ typedef struct HashtableInputData {
 int32_t
 buildAndVerifyAVLTree(OMRPortLibrary *portLib, const char *success, const char *testData);
 
+/* ---------------- btreetest.c ---------------- */
+
+/**
+* @brief
+* @param *portLib
+* @return int32_t
+*/
+int32_t
+verifyRangeBTree(OMRPortLibrary *portLib);
+
 /* ---------------- pooltest.c ---------------- */
 
 /**
@@ -82,6 +93,22 @@ createAndVerifyPool(OMRPortLibrary *portLib, PoolInputData *input);
 int32_t
 testPoolPuddleListSharing(OMRPortLibrary *portLib);
 
+/**
+* @brief
+* @param *portLib
+* @return int32_t
+*/
+int32_t
+testPoolBulkElements(OMRPortLibrary *portLib);
+
+/**
+* @brief
+* @param *portLib
+* @return int32_t
+*/
+int32_t
+testPoolMagazines(OMRPortLibrary *portLib);
+
 /* ---------------- hooktest.c ---------------- */
 
 /**
@@ -110,6 +137,16 @@ verifyHashtable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCo
 int32_t
 buildAndVerifyHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData);
 
+/* ---------------- concurrenthashtabletest.c ---------------- */
+
+/**
+* @brief
+* @param *portLib
+* @return int32_t
+*/
+int32_t
+verifyConcurrentHashtable(OMRPortLibrary *portLib);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include "algorithm_test_internal.h"
+#include "avl_api.h"
+#include "omrport.h"
+/*
+ * Testing J9BTree:
+ * 		btree_insert()
+ * 		btree_search()
+ * 		btree_findRange()
+ * 		btree_delete()
+ * Ranges are laid out in address order with a gap after each, inserted in a shuffled
+ * order, and looked up at their first and last address and in the gaps. Then every
+ * other range is deleted, and then the rest, so that leaves and inner nodes empty out.
+ */
+
+#define BTREE_RANGES 20000
+#define BTREE_RANGE_BASE 0x10000
+#define BTREE_RANGE_STRIDE 0x100
+
+typedef struct BTreeTestRange {
+	uintptr_t start;
+	uintptr_t end;
+	BOOLEAN present;
+} BTreeTestRange;
+
+static uintptr_t
+nextRandom(uintptr_t *seed)
+{
+	*seed = (*seed * 1103515245) + 12345;
+	return (*seed >> 8) & 0xFFFFFF;
+}
+
+/**
+ * Check every range, and the gaps around it, against the tree.
+ */
+static int32_t
+verifyRanges(J9BTree *tree, BTreeTestRange *ranges)
+{
+	uintptr_t expectedCount = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < BTREE_RANGES; i++) {
+		BTreeTestRange *range = &ranges[i];
+		void *expected = range->present ? range : NULL;
+
+		if (btree_search(tree, range->start) != expected) {
+			return -10;
+		}
+		if ((btree_findRange(tree, range->start) != expected) || (btree_findRange(tree, range->end - 1) != expected)) {
+			return -11;
+		}
+		if ((NULL != btree_findRange(tree, range->end)) || (NULL != btree_findRange(tree, range->start - 1))) {
+			return -12;
+		}
+		if (range->present) {
+			expectedCount += 1;
+		}
+	}
+	if (NULL != btree_findRange(tree, 0)) {
+		return -13;
+	}
+	if (expectedCount != tree->numberOfRanges) {
+		return -14;
+	}
+
+	return 0;
+}
+
+int32_t
+verifyRangeBTree(OMRPortLibrary *portLib)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9BTree *tree = btree_new(portLib, OMRMEM_CATEGORY_VM);
+	BTreeTestRange *ranges = NULL;
+	uintptr_t *order = NULL;
+	uintptr_t seed = 17;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	if (NULL == tree) {
+		return -1;
+	}
+	ranges = omrmem_allocate_memory(BTREE_RANGES * sizeof(BTreeTestRange), OMRMEM_CATEGORY_VM);
+	order = omrmem_allocate_memory(BTREE_RANGES * sizeof(uintptr_t), OMRMEM_CATEGORY_VM);
+	if ((NULL == ranges) || (NULL == order)) {
+		result = -2;
+		goto done;
+	}
+
+	for (i = 0; i < BTREE_RANGES; i++) {
+		/* lengths vary, but always leave a gap before the next range */
+		ranges[i].start = BTREE_RANGE_BASE + (i * BTREE_RANGE_STRIDE);
+		ranges[i].end = ranges[i].start + 1 + (nextRandom(&seed) % (BTREE_RANGE_STRIDE - 1));
+		ranges[i].present = FALSE;
+		order[i] = i;
+	}
+	for (i = BTREE_RANGES - 1; i > 0; i--) {
+		uintptr_t j = nextRandom(&seed) % (i + 1);
+		uintptr_t swap = order[i];
+		order[i] = order[j];
+		order[j] = swap;
+	}
+
+	if ((NULL != btree_findRange(tree, BTREE_RANGE_BASE)) || (NULL != btree_delete(tree, BTREE_RANGE_BASE))) {
+		result = -3;
+		goto done;
+	}
+
+	for (i = 0; i < BTREE_RANGES; i++) {
+		BTreeTestRange *range = &ranges[order[i]];
+		if (btree_insert(tree, range->start, range->end, range) != range) {
+			result = -4;
+			goto done;
+		}
+		range->present = TRUE;
+	}
+	result = verifyRanges(tree, ranges);
+	if (0 != result) {
+		goto done;
+	}
+
+	/* Overlapping or empty ranges are refused. */
+	if ((btree_insert(tree, ranges[5].start, ranges[5].end, &seed) != &ranges[5])
+		|| (btree_insert(tree, ranges[5].end - 1, ranges[6].start, &seed) != &ranges[5])
+		|| (btree_insert(tree, ranges[5].end, ranges[6].start + 1, &seed) != &ranges[6])
+		|| (NULL != btree_insert(tree, ranges[5].end, ranges[5].end, &seed))
+	) {
+		result = -5;
+		goto done;
+	}
+
+	/* Delete every other range, in shuffled order. */
+	for (i = 0; i < BTREE_RANGES; i++) {
+		BTreeTestRange *range = &ranges[order[i]];
+		if (0 == (order[i] & 0x1)) {
+			if (btree_delete(tree, range->start) != range) {
+				result = -6;
+				goto done;
+			}
+			range->present = FALSE;
+		}
+	}
+	if (NULL != btree_delete(tree, ranges[0].start)) {
+		result = -7;
+		goto done;
+	}
+	result = verifyRanges(tree, ranges);
+	if (0 != result) {
+		goto done;
+	}
+
+	/* The gaps left by the deleted ranges can be filled again. */
+	if (btree_insert(tree, ranges[0].start, ranges[1].start - 1, &ranges[0]) != &ranges[0]) {
+		result = -8;
+		goto done;
+	}
+	ranges[0].end = ranges[1].start - 1;
+	ranges[0].present = TRUE;
+	result = verifyRanges(tree, ranges);
+	if (0 != result) {
+		goto done;
+	}
+
+	for (i = 0; i < BTREE_RANGES; i++) {
+		BTreeTestRange *range = &ranges[order[i]];
+		if (range->present) {
+			if (btree_delete(tree, range->start) != range) {
+				result = -9;
+				goto done;
+			}
+			range->present = FALSE;
+		}
+	}
+	if ((NULL != tree->root) || (0 != tree->height)) {
+		result = -15;
+		goto done;
+	}
+	result = verifyRanges(tree, ranges);
+
+done:
+	omrmem_free_memory(order);
+	omrmem_free_memory(ranges);
+	btree_free(tree);
+	return result;
+}
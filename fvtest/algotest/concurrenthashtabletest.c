@@ -0,0 +1,279 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include <string.h>
+#include "algorithm_test_internal.h"
+#include "hashtable_api.h"
+#include "omrport.h"
+#include "omrthread.h"
+/*
+ * Testing J9ConcurrentHashTable:
+ * 		concurrentHashTableAdd()
+ * 		concurrentHashTableFind()
+ * 		concurrentHashTableRemove()
+ * 		concurrentHashTableForEachDo()
+ * 		concurrentHashTableGetCount()
+ * first from a single thread, then with reader threads looking up entries that are always
+ * present while writer threads add and remove their own entries and grow the table.
+ */
+
+#define SINGLE_THREAD_ENTRIES 20000
+#define STABLE_ENTRIES 1024
+#define WRITER_ENTRIES 4096
+#define WRITER_ROUNDS 4
+#define READER_THREADS 3
+#define WRITER_THREADS 3
+
+typedef struct ConcurrentEntry {
+	uintptr_t key;
+	uintptr_t value;
+} ConcurrentEntry;
+
+typedef struct ConcurrentTestState {
+	J9ConcurrentHashTable *table;
+	omrthread_monitor_t monitor;
+	volatile uintptr_t writersRunning;
+	uintptr_t threadsRunning;
+	uintptr_t nextWriterId;
+	int32_t result;
+} ConcurrentTestState;
+
+static uintptr_t
+entryHashFn(void *entry, void *userData)
+{
+	/* aligned, pointer-like hash values */
+	return ((ConcurrentEntry *)entry)->key * sizeof(uintptr_t);
+}
+
+static uintptr_t
+entryEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	return ((ConcurrentEntry *)leftEntry)->key == ((ConcurrentEntry *)rightEntry)->key;
+}
+
+static uintptr_t
+removeOddKeyFn(void *entry, void *userData)
+{
+	return ((ConcurrentEntry *)entry)->key & 0x1;
+}
+
+static uintptr_t
+countEntryFn(void *entry, void *userData)
+{
+	*(uintptr_t *)userData += 1;
+	return FALSE;
+}
+
+static int32_t
+runSingleThreadedTest(OMRPortLibrary *portLib, J9ConcurrentHashTable *table)
+{
+	uintptr_t i = 0;
+	uintptr_t count = 0;
+
+	for (i = 0; i < SINGLE_THREAD_ENTRIES; i++) {
+		ConcurrentEntry entry = {i, i * 3};
+		ConcurrentEntry *added = concurrentHashTableAdd(table, &entry);
+		if ((NULL == added) || (added->value != (i * 3))) {
+			return -1;
+		}
+	}
+	if (SINGLE_THREAD_ENTRIES != concurrentHashTableGetCount(table)) {
+		return -2;
+	}
+
+	/* adding an existing key returns the entry already in the table */
+	for (i = 0; i < SINGLE_THREAD_ENTRIES; i++) {
+		ConcurrentEntry entry = {i, 0};
+		ConcurrentEntry *found = concurrentHashTableFind(table, &entry);
+		if ((NULL == found) || (found->value != (i * 3)) || (found != concurrentHashTableAdd(table, &entry))) {
+			return -3;
+		}
+	}
+
+	concurrentHashTableForEachDo(table, removeOddKeyFn, NULL);
+	concurrentHashTableForEachDo(table, countEntryFn, &count);
+	if ((count != (SINGLE_THREAD_ENTRIES / 2)) || (count != concurrentHashTableGetCount(table))) {
+		return -4;
+	}
+
+	for (i = 0; i < SINGLE_THREAD_ENTRIES; i++) {
+		ConcurrentEntry entry = {i, 0};
+		uint32_t rc = concurrentHashTableRemove(table, &entry);
+		if ((0 == (i & 0x1)) != (0 == rc)) {
+			return -5;
+		}
+		if (NULL != concurrentHashTableFind(table, &entry)) {
+			return -6;
+		}
+	}
+
+	return (0 == concurrentHashTableGetCount(table)) ? 0 : -7;
+}
+
+static void
+threadFinished(ConcurrentTestState *state, int32_t result, BOOLEAN isWriter)
+{
+	omrthread_monitor_enter(state->monitor);
+	if (0 != result) {
+		state->result = result;
+	}
+	if (isWriter) {
+		state->writersRunning -= 1;
+	}
+	state->threadsRunning -= 1;
+	omrthread_monitor_notify_all(state->monitor);
+	omrthread_monitor_exit(state->monitor);
+}
+
+static int J9THREAD_PROC
+readerThread(void *arg)
+{
+	ConcurrentTestState *state = (ConcurrentTestState *)arg;
+	int32_t result = 0;
+	uintptr_t i = 0;
+
+	/* keep looking up the stable entries until the writers are done */
+	while ((0 == result) && (0 != state->writersRunning)) {
+		for (i = 0; i < STABLE_ENTRIES; i++) {
+			ConcurrentEntry entry = {i, 0};
+			ConcurrentEntry *found = concurrentHashTableFind(state->table, &entry);
+			if ((NULL == found) || (found->value != (i * 3))) {
+				result = -10;
+				break;
+			}
+		}
+	}
+
+	threadFinished(state, result, FALSE);
+	return 0;
+}
+
+static int J9THREAD_PROC
+writerThread(void *arg)
+{
+	ConcurrentTestState *state = (ConcurrentTestState *)arg;
+	uintptr_t firstKey = 0;
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	omrthread_monitor_enter(state->monitor);
+	firstKey = STABLE_ENTRIES + (state->nextWriterId * WRITER_ENTRIES);
+	state->nextWriterId += 1;
+	omrthread_monitor_exit(state->monitor);
+
+	for (round = 0; (0 == result) && (round < WRITER_ROUNDS); round++) {
+		for (i = firstKey; i < (firstKey + WRITER_ENTRIES); i++) {
+			ConcurrentEntry entry = {i, i * 3};
+			if (NULL == concurrentHashTableAdd(state->table, &entry)) {
+				result = -20;
+				break;
+			}
+		}
+		for (i = firstKey; (0 == result) && (i < (firstKey + WRITER_ENTRIES)); i++) {
+			ConcurrentEntry entry = {i, 0};
+			ConcurrentEntry *found = concurrentHashTableFind(state->table, &entry);
+			if ((NULL == found) || (found->value != (i * 3))) {
+				result = -21;
+			} else if (0 != concurrentHashTableRemove(state->table, &entry)) {
+				result = -22;
+			} else if (NULL != concurrentHashTableFind(state->table, &entry)) {
+				result = -23;
+			}
+		}
+	}
+
+	threadFinished(state, result, TRUE);
+	return 0;
+}
+
+static int32_t
+runMultiThreadedTest(OMRPortLibrary *portLib, J9ConcurrentHashTable *table)
+{
+	ConcurrentTestState state;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	memset(&state, 0, sizeof(state));
+	if (0 != omrthread_monitor_init_with_name(&state.monitor, 0, "concurrent hashtable test")) {
+		return -30;
+	}
+	state.table = table;
+
+	for (i = 0; i < STABLE_ENTRIES; i++) {
+		ConcurrentEntry entry = {i, i * 3};
+		if (NULL == concurrentHashTableAdd(table, &entry)) {
+			result = -31;
+			goto done;
+		}
+	}
+
+	state.writersRunning = WRITER_THREADS;
+	state.threadsRunning = READER_THREADS + WRITER_THREADS;
+	for (i = 0; i < (READER_THREADS + WRITER_THREADS); i++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, (i < READER_THREADS) ? readerThread : writerThread, &state)) {
+			/* account for the threads that will never start */
+			omrthread_monitor_enter(state.monitor);
+			state.writersRunning -= WRITER_THREADS - ((i < READER_THREADS) ? 0 : (i - READER_THREADS));
+			state.threadsRunning -= (READER_THREADS + WRITER_THREADS) - i;
+			state.result = -32;
+			omrthread_monitor_exit(state.monitor);
+			break;
+		}
+	}
+
+	omrthread_monitor_enter(state.monitor);
+	while (0 != state.threadsRunning) {
+		omrthread_monitor_wait(state.monitor);
+	}
+	omrthread_monitor_exit(state.monitor);
+	result = state.result;
+
+	if ((0 == result) && (STABLE_ENTRIES != concurrentHashTableGetCount(table))) {
+		result = -33;
+	}
+
+done:
+	omrthread_monitor_destroy(state.monitor);
+	return result;
+}
+
+int32_t
+verifyConcurrentHashtable(OMRPortLibrary *portLib)
+{
+	J9ConcurrentHashTable *table = NULL;
+	int32_t result = 0;
+
+	table = concurrentHashTableNew(portLib, OMR_GET_CALLSITE(), 0, sizeof(ConcurrentEntry), OMRMEM_CATEGORY_VM, entryHashFn, entryEqualFn, NULL);
+	if (NULL == table) {
+		return -100;
+	}
+	result = runSingleThreadedTest(portLib, table);
+	if (0 == result) {
+		result = runMultiThreadedTest(portLib, table);
+	}
+	/* freeing a table that still holds entries frees them as well */
+	concurrentHashTableFree(table);
+
+	return result;
+}
@@ -193,6 +193,50 @@ runHashtableTests(OMRPortLibrary *portLib, J9HashTable *table, const uintptr_t *
 	return 0;
 }
 
+static uintptr_t
+removeOddEntryFn(void *entry, void *userData)
+{
+	return *(uintptr_t *)entry & 0x1;
+}
+
+/* hashTableForEachDo() removes entries through hashTableDoRemove(), which space optimized tables do not support */
+static int32_t
+runForEachDoRemoveTest(OMRPortLibrary *portLib, J9HashTable *table, const uintptr_t *data, uintptr_t dataLength)
+{
+	uintptr_t i = 0;
+	uintptr_t entry = 0;
+	uintptr_t evenCount = 0;
+
+	for (i = 0; i < dataLength; i++) {
+		entry = data[i];
+		if (hashTableAdd(table, &entry) == NULL) {
+			return -1;
+		}
+		if (0 == (entry & 0x1)) {
+			evenCount += 1;
+		}
+	}
+
+	hashTableForEachDo(table, removeOddEntryFn, NULL);
+	if (hashTableGetCount(table) != evenCount) {
+		return -2;
+	}
+
+	for (i = 0; i < dataLength; i++) {
+		uintptr_t *node = NULL;
+		entry = data[i];
+		node = hashTableFind(table, &entry);
+		if ((0 == (entry & 0x1)) != (NULL != node)) {
+			return -3;
+		}
+		if ((NULL != node) && (0 != hashTableRemove(table, &entry))) {
+			return -4;
+		}
+	}
+
+	return (0 == hashTableGetCount(table)) ? 0 : -5;
+}
+
 static J9HashTable *
 allocateHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 {
@@ -215,6 +259,18 @@ allocateHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 				hashComparatorFn,
 				NULL,
 				userData);
+	} else if (TRUE == inputData->openAddressing) {
+		hashtable = hashTableNew(portLib,
+				tableName,
+				tableSize,
+				entrySize,
+				0,
+				flags | J9HASH_TABLE_OPEN_ADDRESSING,
+				OMRMEM_CATEGORY_VM,
+				hashFn,
+				hashEqualFn,
+				NULL,
+				userData);
 	} else {
 		hashtable = hashTableNew(portLib,
 				tableName,
@@ -255,6 +311,12 @@ buildAndVerifyHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 			goto fail;
 		}
 	}
+	if (TRUE == inputData->openAddressing) {
+		if (0 != runForEachDoRemoveTest(portLib, table, inputData->data, inputData->dataLength)) {
+			result = -4;
+			goto fail;
+		}
+	}
 fail:
 	hashTableFree(table);
 	return result;
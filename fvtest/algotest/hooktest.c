@@ -33,6 +33,8 @@ static void testRegisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount,
 static void testUnregister(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event);
 static void testUnregisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t userData);
 static void testDispatch(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t event, uintptr_t expectedResult);
+static void testSetDispatchMode(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t modeFlags);
+static void testLastHookStartTime(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t event, int64_t startMillis);
 static uintptr_t testAllocateAgentID(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
 static void hookNormalEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
 static void hookOrderedEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
@@ -68,6 +70,8 @@ testHookInterface(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *fail
 {
 	int32_t rc = 0;
 	uintptr_t agent1, agent2, agent2andAHalf, agent3;
+	int64_t startMillis = 0;
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
 
 	/* all events should be enabled initially */
 	testEnabled(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT1, TRUE);
@@ -163,6 +167,32 @@ testHookInterface(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *fail
 	testRegisterWithAgent(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, agent2, 3, 0);
 	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
 
+	/* dispatch from a flattened listener array, timed with the time base */
+	startMillis = omrtime_current_time_millis();
+	testSetDispatchMode(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, J9HOOK_FLAG_FLATTENED | J9HOOK_FLAG_CYCLE_TIMING);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
+	testLastHookStartTime(portLib, passCount, failCount, TESTHOOK_EVENT3, startMillis);
+
+	/* the array is rebuilt, in agent order, when listeners are unregistered and registered */
+	testUnregisterWithAgent(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, 2);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 4);
+	testRegisterWithAgent(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, agent2, 2, 0);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
+
+	/* a flattened event may lose all of its listeners and gain them again */
+	testSetDispatchMode(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2, J9HOOK_FLAG_FLATTENED);
+	testRegister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2, 0);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT2, 1);
+	testUnregister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT2, 0);
+	testRegister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2, 0);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT2, 1);
+
+	/* and go back to dispatching from the records */
+	testSetDispatchMode(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, 0);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
+	testLastHookStartTime(portLib, passCount, failCount, TESTHOOK_EVENT3, startMillis);
+
 	return rc;
 }
 
@@ -231,6 +261,35 @@ testRegisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *
 	}
 }
 
+static void
+testSetDispatchMode(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t modeFlags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	if (J9HookSetDispatchMode(hookInterface, event, modeFlags) == 0) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("J9HookSetDispatchMode for 0x%zx failed. It should have succeeded.\n", event);
+		(*failCount)++;
+	}
+}
+
+static void
+testLastHookStartTime(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t event, int64_t startMillis)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(&sampleHookInterface.common, event);
+	int64_t endMillis = omrtime_current_time_millis();
+	int64_t lastHookStart = (int64_t)eventDump->lastHook.startTime;
+
+	/* allow for the time base and the wall clock drifting apart a little */
+	if ((lastHookStart >= (startMillis - 10)) && (lastHookStart <= (endMillis + 10))) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("Last listener for 0x%zx started at %lld, expected between %lld and %lld\n", event, lastHookStart, startMillis, endMillis);
+		(*failCount)++;
+	}
+}
 
 static uintptr_t
 testAllocateAgentID(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface)
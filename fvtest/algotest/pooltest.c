@@ -21,6 +21,7 @@
 
 #include <string.h>
 #include "omrport.h"
+#include "omrthread.h"
 #include "omrutil.h"
 #include "pool_api.h"
 #include "algorithm_test_internal.h"
@@ -37,6 +38,26 @@ static int32_t sharedPuddleListReferenceCount = 0;
 #define BYTE_MARKER 2
 #define LAST_BYTE_MARKER 4
 
+#define BULK_ELEMENTS 1000
+#define MAGAZINE_BATCH_SIZE 8
+#define MAGAZINE_THREADS 4
+#define MAGAZINE_THREAD_ELEMENTS 500
+#define MAGAZINE_THREAD_ROUNDS 20
+
+typedef struct MagazineElement {
+	uintptr_t owner;
+	uintptr_t index;
+	uintptr_t pad;
+} MagazineElement;
+
+typedef struct MagazineTestState {
+	J9PoolMagazines *magazines;
+	omrthread_monitor_t monitor;
+	uintptr_t threadsRunning;
+	uintptr_t nextThreadId;
+	int32_t result;
+} MagazineTestState;
+
 static J9Pool* createNewPool(OMRPortLibrary *portLib, PoolInputData *input);
 static int32_t testPoolNewElement(OMRPortLibrary *portLib, PoolInputData *inputData, J9Pool *currentPool);
 static int32_t testPoolWalkFunctions(OMRPortLibrary *portLib, PoolInputData *inputData, J9Pool *currentPool, uint32_t elementsAllocated);
@@ -401,3 +422,200 @@ error:
 
 	return result;
 }
+
+int32_t
+testPoolBulkElements(OMRPortLibrary *portLib)
+{
+	void *elements[BULK_ELEMENTS];
+	J9Pool *pool = pool_new(sizeof(MagazineElement), 16, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+	int32_t result = 0;
+
+	if (NULL == pool) {
+		return -1;
+	}
+
+	if (BULK_ELEMENTS != pool_newElements(pool, BULK_ELEMENTS, elements)) {
+		result = -2;
+		goto done;
+	}
+	if (BULK_ELEMENTS != pool_numElements(pool)) {
+		result = -3;
+		goto done;
+	}
+	for (i = 0; i < BULK_ELEMENTS; i++) {
+		MagazineElement *element = (MagazineElement *)elements[i];
+		if ((0 != element->owner) || (0 != element->index) || !pool_includesElement(pool, element)) {
+			result = -4;
+			goto done;
+		}
+		element->owner = 1;
+		element->index = i;
+	}
+	for (i = 0; i < BULK_ELEMENTS; i++) {
+		if (((MagazineElement *)elements[i])->index != i) {
+			result = -5;
+			goto done;
+		}
+	}
+
+	/* Remove every other element, with NULLs in between that must be skipped. */
+	for (i = 0; i < BULK_ELEMENTS; i += 2) {
+		elements[i + 1] = NULL;
+	}
+	pool_removeElements(pool, BULK_ELEMENTS, elements);
+	if ((BULK_ELEMENTS / 2) != pool_numElements(pool)) {
+		result = -6;
+		goto done;
+	}
+
+	/* Gather the survivors and remove them too. */
+	{
+		pool_state state;
+		void *element = pool_startDo(pool, &state);
+		while (NULL != element) {
+			elements[j] = element;
+			j += 1;
+			element = pool_nextDo(&state);
+		}
+	}
+	if ((BULK_ELEMENTS / 2) != j) {
+		result = -7;
+		goto done;
+	}
+	pool_removeElements(pool, j, elements);
+	if (0 != pool_numElements(pool)) {
+		result = -8;
+	}
+
+done:
+	pool_kill(pool);
+	return result;
+}
+
+static void
+magazineThreadFinished(MagazineTestState *state, int32_t result)
+{
+	omrthread_monitor_enter(state->monitor);
+	if (0 != result) {
+		state->result = result;
+	}
+	state->threadsRunning -= 1;
+	omrthread_monitor_notify_all(state->monitor);
+	omrthread_monitor_exit(state->monitor);
+}
+
+static int J9THREAD_PROC
+magazineThread(void *arg)
+{
+	MagazineTestState *state = (MagazineTestState *)arg;
+	MagazineElement *elements[MAGAZINE_THREAD_ELEMENTS];
+	uintptr_t owner = 0;
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	omrthread_monitor_enter(state->monitor);
+	state->nextThreadId += 1;
+	owner = state->nextThreadId;
+	omrthread_monitor_exit(state->monitor);
+
+	for (round = 0; (0 == result) && (round < MAGAZINE_THREAD_ROUNDS); round++) {
+		/* Vary the live set so that magazines both refill and spill. */
+		uintptr_t count = MAGAZINE_THREAD_ELEMENTS - ((round * 37) % (MAGAZINE_THREAD_ELEMENTS / 2));
+
+		for (i = 0; i < count; i++) {
+			elements[i] = (MagazineElement *)poolMagazines_newElement(state->magazines);
+			if ((NULL == elements[i]) || (0 != elements[i]->owner) || (0 != elements[i]->index)) {
+				result = -10;
+				count = i;
+				break;
+			}
+			elements[i]->owner = owner;
+			elements[i]->index = i;
+		}
+		for (i = 0; i < count; i++) {
+			if ((elements[i]->owner != owner) || (elements[i]->index != i)) {
+				result = -11;
+			}
+			poolMagazines_removeElement(state->magazines, elements[i]);
+		}
+	}
+	/* The main thread kills the magazines as soon as this thread is finished. */
+	poolMagazines_flush(state->magazines);
+
+	magazineThreadFinished(state, result);
+	return 0;
+}
+
+int32_t
+testPoolMagazines(OMRPortLibrary *portLib)
+{
+	MagazineTestState state;
+	J9Pool *pool = pool_new(sizeof(MagazineElement), 16, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+	void *element = NULL;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	if (NULL == pool) {
+		return -1;
+	}
+	memset(&state, 0, sizeof(state));
+	state.magazines = poolMagazines_new(portLib, pool, MAGAZINE_BATCH_SIZE);
+	if (NULL == state.magazines) {
+		pool_kill(pool);
+		return -2;
+	}
+
+	/* A freed element is reused by the same thread, zeroed again. */
+	element = poolMagazines_newElement(state.magazines);
+	if ((NULL == element) || (MAGAZINE_BATCH_SIZE != pool_numElements(pool))) {
+		result = -3;
+		goto done;
+	}
+	((MagazineElement *)element)->owner = 1;
+	poolMagazines_removeElement(state.magazines, element);
+	if ((element != poolMagazines_newElement(state.magazines)) || (0 != ((MagazineElement *)element)->owner)) {
+		result = -4;
+		goto done;
+	}
+	poolMagazines_removeElement(state.magazines, element);
+	poolMagazines_flush(state.magazines);
+	if (0 != pool_numElements(pool)) {
+		result = -5;
+		goto done;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&state.monitor, 0, "pool magazine test")) {
+		result = -6;
+		goto done;
+	}
+	state.threadsRunning = MAGAZINE_THREADS;
+	for (i = 0; i < MAGAZINE_THREADS; i++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, magazineThread, &state)) {
+			/* account for the threads that will never start */
+			omrthread_monitor_enter(state.monitor);
+			state.threadsRunning -= MAGAZINE_THREADS - i;
+			state.result = -7;
+			omrthread_monitor_exit(state.monitor);
+			break;
+		}
+	}
+	omrthread_monitor_enter(state.monitor);
+	while (0 != state.threadsRunning) {
+		omrthread_monitor_wait(state.monitor);
+	}
+	omrthread_monitor_exit(state.monitor);
+	omrthread_monitor_destroy(state.monitor);
+	result = state.result;
+	if ((0 == result) && (0 != pool_numElements(pool))) {
+		result = -8;
+	}
+
+done:
+	poolMagazines_kill(state.magazines);
+	pool_kill(pool);
+	return result;
+}
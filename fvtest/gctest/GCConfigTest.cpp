@@ -22,11 +22,14 @@
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "Heap.hpp"
+#include "MemorySpace.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
 #include "SlotObject.hpp"
+#include "SegregatedWriteBarrier.hpp"
 #include "StandardWriteBarrier.hpp"
 #include "VerboseWriterChain.hpp"
 
@@ -46,11 +49,27 @@ const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml",
                                 "fvtest/gctest/configuration/gencon_GC_backout_config.xml",
                                 "fvtest/gctest/configuration/scavenger_GC_config.xml",
                                 "fvtest/gctest/configuration/scavenger_GC_backout_config.xml",
+                                "fvtest/gctest/configuration/scavenger_GC_numa_config.xml",
                                	"fvtest/gctest/configuration/global_GC_config.xml",
-								"fvtest/gctest/configuration/optavgpause_GC_config.xml"};
+								"fvtest/gctest/configuration/global_GC_prefetch_config.xml",
+								"fvtest/gctest/configuration/global_GC_adaptive_tlh_config.xml",
+								"fvtest/gctest/configuration/global_GC_work_stealing_config.xml",
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+								"fvtest/gctest/configuration/concurrent_sweep_GC_config.xml",
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+								"fvtest/gctest/configuration/optavgpause_GC_config.xml",
+#if defined(OMR_GC_MODRON_COMPACTION)
+								"fvtest/gctest/configuration/global_GC_sliding_compact_config.xml",
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+								"fvtest/gctest/configuration/segregated_GC_generational_config.xml",
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+								};
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml",
+								"perftest/gctest/configuration/hotfield_breadthfirst_copy.xml",
+								"perftest/gctest/configuration/hotfield_depthfirst_copy.xml"};
 void
 GCConfigTest::SetUp()
 {
@@ -611,7 +630,14 @@ GCConfigTest::attachChildEntry(ObjectEntry *parentEntry, ObjectEntry *childEntry
 
 	if ((uint32_t)parentEntry->numOfRef < slotCount) {
 		fomrobject_t *childSlot = firstSlot + parentEntry->numOfRef;
-		standardWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, childSlot, childEntry->objPtr);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		if (extensions->isSegregatedHeap()) {
+			segregatedWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, childSlot, childEntry->objPtr);
+		} else
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+		{
+			standardWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, childSlot, childEntry->objPtr);
+		}
 		gcTestEnv->log(LEVEL_VERBOSE, "\tadd child %s(%p[0x%llx]) to parent %s(%p[0x%llx]) slot %p[%llx].\n", 
         			childEntry->name, childEntry->objPtr, *(childEntry->objPtr), parentEntry->name, parentEntry->objPtr, *(parentEntry->objPtr), childSlot, (uintptr_t)*childSlot);
 		parentEntry->numOfRef += 1;
@@ -967,12 +993,101 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "scavenge")) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+			MM_GCExtensionsBase *extensions = env->getExtensions();
+			if (!extensions->scavengerEnabled) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Scavenge operation requires GCPolicy=gencon.\n", __FILE__, __LINE__);
+				goto done;
+			}
+			gcTestEnv->log("Invoking scavenge...\n");
+			/* the default memory subspace of a generational heap is the nursery, so a local collect scavenges it */
+			extensions->heap->getDefaultMemorySpace()->localGarbageCollect(env);
+			verboseManager->getWriterChain()->endOfCycle(env);
+#else
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Scavenge operation requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk).\n", __FILE__, __LINE__);
+			goto done;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+		} else if (0 == strcmp(node.name(), "mutatorTraverse")) {
+			rt = mutatorTraverse(node);
+			OMRGCTEST_CHECK_RT(rt);
 		}
 	}
 done:
 	return rt;
 }
 
+int32_t
+GCConfigTest::mutatorTraverse(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(exampleVM->_omrVM);
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	int32_t rt = 0;
+
+	const char *iterationsStr = node.attribute("iterations").value();
+	if (0 == strcmp(iterationsStr, "")) {
+		iterationsStr = "1";
+	}
+	int32_t iterations = atoi(iterationsStr);
+	/* object graphs may be cyclic, so bound each traversal by the number of allocated objects */
+	uintptr_t maxVisits = hashTableGetCount(exampleVM->objectTable);
+	uintptr_t visits = 0;
+	uintptr_t checksum = 0;
+	std::vector<omrobjectptr_t> stack;
+	GCTestCacheCounters cacheCounters;
+
+	gcTestEnv->log("Traversing live objects from the root set %d times...\n", iterations);
+	uint64_t startTime = omrtime_hires_clock();
+	cacheCounters.start();
+	for (int32_t i = 0; i < iterations; i++) {
+		J9HashTableState state;
+		uintptr_t iterationVisits = 0;
+		RootEntry *rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state);
+		while (NULL != rootEntry) {
+			if (NULL != rootEntry->rootPtr) {
+				stack.push_back(rootEntry->rootPtr);
+			}
+			rootEntry = (RootEntry *)hashTableNextDo(&state);
+		}
+		while (!stack.empty() && (iterationVisits < maxVisits)) {
+			omrobjectptr_t objPtr = stack.back();
+			stack.pop_back();
+			iterationVisits += 1;
+			uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objPtr);
+			fomrobject_t *currentSlot = (fomrobject_t *)objPtr + 1;
+			fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)objPtr + size);
+			/* push in reverse so that the first slot is visited first */
+			while (currentSlot < endSlot) {
+				endSlot -= 1;
+				GC_SlotObject slotObject(exampleVM->_omrVM, endSlot);
+				omrobjectptr_t child = slotObject.readReferenceFromSlot();
+				if (NULL != child) {
+					checksum += (uintptr_t)child;
+					stack.push_back(child);
+				}
+			}
+		}
+		stack.clear();
+		visits += iterationVisits;
+	}
+	cacheCounters.stop();
+	uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	gcTestEnv->log("Time elapsed in mutator traversal: %llu us (%llu objects visited, checksum 0x%llx)\n", elapsed, (uint64_t)visits, (uint64_t)checksum);
+	if (cacheCounters.isAvailable()) {
+		uint64_t references = cacheCounters.getReferences();
+		uint64_t misses = cacheCounters.getMisses();
+		uint64_t missRate = (0 == references) ? 0 : ((misses * 10000) / references);
+		gcTestEnv->log("Cache references: %llu, misses: %llu (miss rate %llu.%02llu%%)\n", references, misses, missRate / 100, missRate % 100);
+	} else {
+		gcTestEnv->log("Cache counters are not available on this system.\n");
+	}
+
+	return rt;
+}
+
 int32_t
 GCConfigTest::iniXMLStr(const char *configStyle)
 {
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "Bits.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "gcTestHelpers.hpp"
+#include "HeapMapScan.hpp"
+
+/* nine 512-bit blocks, so that every vector implementation runs its block loops and its scalar tail */
+#define MAP_SLOTS 72
+#define SLOT_HIGH_BIT ((uintptr_t)1 << (J9BITS_BITS_IN_SLOT - 1))
+
+class HeapMapScanTest : public GCUnitTest
+{
+	/*
+	 * Data members
+	 */
+protected:
+	uintptr_t _map[MAP_SLOTS];
+	bool _vectorHeapMapScan; /**< setting of vectorHeapMapScan to restore when the test ends */
+
+	/*
+	 * Function members
+	 */
+protected:
+	virtual void SetUp();
+	virtual void TearDown();
+
+	void checkAllRanges(const char *pattern);
+	void checkMarkedBits(const char *pattern);
+
+public:
+	HeapMapScanTest()
+		: GCUnitTest()
+		, _vectorHeapMapScan(true)
+	{
+	}
+};
+
+void
+HeapMapScanTest::SetUp()
+{
+	ASSERT_NO_FATAL_FAILURE(GCUnitTest::SetUp());
+
+	/* select the widest implementation the processor supports, regardless of how the heap was configured */
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	_vectorHeapMapScan = extensions->vectorHeapMapScan;
+	extensions->vectorHeapMapScan = true;
+	MM_HeapMapScan::initialize(env);
+	gcTestEnv->log(LEVEL_VERBOSE, "Heap map scan vector width: %zu\n", MM_HeapMapScan::getVectorWidth());
+
+	memset(_map, 0, sizeof(_map));
+}
+
+void
+HeapMapScanTest::TearDown()
+{
+	env->getExtensions()->vectorHeapMapScan = _vectorHeapMapScan;
+	MM_HeapMapScan::initialize(env);
+
+	GCUnitTest::TearDown();
+}
+
+/**
+ * Compare the selected implementations against the scalar ones for every range of the map,
+ * so that every alignment of the start and every length of the tail is covered.
+ */
+void
+HeapMapScanTest::checkAllRanges(const char *pattern)
+{
+	for (uintptr_t start = 0; start <= MAP_SLOTS; start++) {
+		for (uintptr_t top = start; top <= MAP_SLOTS; top++) {
+			ASSERT_EQ(MM_HeapMapScan::findNonEmptySlotScalar(_map + start, _map + top), MM_HeapMapScan::findNonEmptySlot(_map + start, _map + top))
+				<< "findNonEmptySlot: pattern " << pattern << ", range [" << start << ", " << top << ")";
+			ASSERT_EQ(MM_HeapMapScan::findEmptySlotScalar(_map + start, _map + top), MM_HeapMapScan::findEmptySlot(_map + start, _map + top))
+				<< "findEmptySlot: pattern " << pattern << ", range [" << start << ", " << top << ")";
+		}
+	}
+}
+
+/**
+ * Walk the map the way the sweep does - skipping runs of empty slots, then consuming runs of
+ * non-empty ones - and check that exactly the marked bits are visited.
+ */
+void
+HeapMapScanTest::checkMarkedBits(const char *pattern)
+{
+	for (uintptr_t start = 0; start < J9BITS_BITS_IN_SLOT / 8; start++) {
+		uintptr_t top = MAP_SLOTS - start;
+		std::vector<uintptr_t> expected;
+		std::vector<uintptr_t> visited;
+
+		for (uintptr_t slot = start; slot < top; slot++) {
+			for (uintptr_t bit = 0; bit < J9BITS_BITS_IN_SLOT; bit++) {
+				if (0 != (_map[slot] & ((uintptr_t)1 << bit))) {
+					expected.push_back((slot * J9BITS_BITS_IN_SLOT) + bit);
+				}
+			}
+		}
+
+		uintptr_t *current = _map + start;
+		while (current < _map + top) {
+			current = MM_HeapMapScan::findNonEmptySlot(current, _map + top);
+			uintptr_t *runEnd = MM_HeapMapScan::findEmptySlot(current, _map + top);
+			for (; current < runEnd; current++) {
+				uintptr_t slot = current - _map;
+				ASSERT_NE((uintptr_t)0, *current) << "pattern " << pattern << ": empty slot " << slot << " inside a non-empty run";
+				for (uintptr_t bit = 0; bit < J9BITS_BITS_IN_SLOT; bit++) {
+					if (0 != (*current & ((uintptr_t)1 << bit))) {
+						visited.push_back((slot * J9BITS_BITS_IN_SLOT) + bit);
+					}
+				}
+			}
+		}
+
+		ASSERT_TRUE(expected == visited) << "pattern " << pattern << ": marked bits differ for range [" << start << ", " << top << ")";
+	}
+}
+
+TEST_F(HeapMapScanTest, emptyAndFullMaps)
+{
+	ASSERT_NO_FATAL_FAILURE(checkAllRanges("empty"));
+	ASSERT_NO_FATAL_FAILURE(checkMarkedBits("empty"));
+
+	for (uintptr_t slot = 0; slot < MAP_SLOTS; slot++) {
+		_map[slot] = UDATA_MAX;
+	}
+	ASSERT_NO_FATAL_FAILURE(checkAllRanges("full"));
+	ASSERT_NO_FATAL_FAILURE(checkMarkedBits("full"));
+}
+
+TEST_F(HeapMapScanTest, singleMarkedSlot)
+{
+	/* the lowest and highest bit of a slot are the marks nearest to the previous and next heap map word */
+	uintptr_t const bits[] = { 1, SLOT_HIGH_BIT };
+	for (uintptr_t i = 0; i < sizeof(bits) / sizeof(bits[0]); i++) {
+		for (uintptr_t slot = 0; slot < MAP_SLOTS; slot++) {
+			memset(_map, 0, sizeof(_map));
+			_map[slot] = bits[i];
+			ASSERT_NO_FATAL_FAILURE(checkAllRanges("single marked slot"));
+			ASSERT_NO_FATAL_FAILURE(checkMarkedBits("single marked slot"));
+		}
+	}
+}
+
+TEST_F(HeapMapScanTest, singleEmptySlot)
+{
+	for (uintptr_t slot = 0; slot < MAP_SLOTS; slot++) {
+		for (uintptr_t i = 0; i < MAP_SLOTS; i++) {
+			_map[i] = (0 == (i & 1)) ? 1 : SLOT_HIGH_BIT;
+		}
+		_map[slot] = 0;
+		ASSERT_NO_FATAL_FAILURE(checkAllRanges("single empty slot"));
+		ASSERT_NO_FATAL_FAILURE(checkMarkedBits("single empty slot"));
+	}
+}
+
+TEST_F(HeapMapScanTest, randomMaps)
+{
+	/* fixed seed so that failures reproduce */
+	uint64_t seed = 0x9E3779B97F4A7C15ULL;
+
+	for (uintptr_t round = 0; round < 64; round++) {
+		/* alternate between sparse maps (long empty runs) and dense maps (long non-empty runs) */
+		uintptr_t markedPercent = (0 == (round & 1)) ? 5 : 90;
+		for (uintptr_t slot = 0; slot < MAP_SLOTS; slot++) {
+			seed ^= seed << 13;
+			seed ^= seed >> 7;
+			seed ^= seed << 17;
+			if ((seed % 100) < markedPercent) {
+				_map[slot] = ((uintptr_t)1 << ((seed >> 8) % J9BITS_BITS_IN_SLOT)) | (uintptr_t)(seed >> 32);
+			} else {
+				_map[slot] = 0;
+			}
+		}
+		ASSERT_NO_FATAL_FAILURE(checkAllRanges("random"));
+		ASSERT_NO_FATAL_FAILURE(checkMarkedBits("random"));
+	}
+}
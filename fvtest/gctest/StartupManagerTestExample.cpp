@@ -83,7 +83,16 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "numaAwareGCThreads")) {
+					extensions->numaAwareGCThreads = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workStealing")) {
+					extensions->workStealingEnabled = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workStealingDequeCapacity")) {
+					extensions->workStealingDequeCapacity = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,22 +100,70 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, segregated or optavgpause): %s\n", attr.value());
 						result = false;
 					}
+				} else if (0 == strcmp(attr.name(), "segregatedGenerational")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					extensions->segregatedGenerational = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: segregatedGenerational=true ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 					extensions->concurrentMark = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+					extensions->concurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSweep=true ignored, requires OMR_GC_CONCURRENT_SWEEP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP)*/
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					if (0 == j9_cmdla_stricmp(attr.value(), "true")) {
+						/* the startup manager disables compaction by default */
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->compactOnGlobalGC = 1;
+					}
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: compactOnGlobalGC=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION)*/
+				} else if (0 == strcmp(attr.name(), "parallelSlidingCompact")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->parallelSlidingCompact = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: parallelSlidingCompact=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION)*/
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hotFieldCopyDepthFirst")) {
+					extensions->scavengerHotFieldCopyDepthFirst = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hotFieldCopyMaxDepth")) {
+					extensions->scavengerHotFieldCopyMaxDepth = atoi(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDistance")) {
+					extensions->markingPrefetchDistance = atoi(attr.value());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhTargetRefreshCount")) {
+					extensions->tlhTargetRefreshCount = atoi(attr.value());
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+				} else if (0 == strcmp(attr.name(), "hotFieldsDescriptor")) {
+					extensions->objectModel.setHotFieldsDescriptor((uintptr_t)strtoul(attr.value(), NULL, 0));
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
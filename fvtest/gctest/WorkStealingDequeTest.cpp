@@ -0,0 +1,240 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "AtomicOperations.hpp"
+#include "gcTestHelpers.hpp"
+#include "WorkStealingDeque.hpp"
+
+#define THIEF_THREADS 4
+#define CONCURRENT_ELEMENTS 200000
+#define CONCURRENT_CAPACITY 8
+
+/* Deque elements must not be NULL: element n is encoded as n + 1 */
+#define ELEMENT(n) ((void *)((uintptr_t)(n) + 1))
+#define ELEMENT_INDEX(element) ((uintptr_t)(element) - 1)
+
+typedef struct DequeTestState {
+	MM_WorkStealingDeque *deque;
+	volatile uintptr_t *takenCounts; /**< number of times each element was popped or stolen */
+	volatile uintptr_t ownerDone; /**< set once the owner has pushed every element and drained its deque */
+	uintptr_t threadsRunning;
+	uintptr_t stolen;
+	omrthread_monitor_t monitor;
+} DequeTestState;
+
+class WorkStealingDequeTest : public GCUnitTest
+{
+};
+
+static void
+recordTaken(DequeTestState *state, void *element)
+{
+	MM_AtomicOperations::add(&state->takenCounts[ELEMENT_INDEX(element)], 1);
+}
+
+static int J9THREAD_PROC
+thiefThread(void *arg)
+{
+	DequeTestState *state = (DequeTestState *)arg;
+	uintptr_t stolen = 0;
+
+	/* the owner only sets ownerDone once its deque is empty, so the final check cannot miss an element */
+	while ((0 == state->ownerDone) || !state->deque->isEmpty()) {
+		void *element = state->deque->steal();
+		if (NULL != element) {
+			recordTaken(state, element);
+			stolen += 1;
+		} else {
+			omrthread_yield();
+		}
+	}
+
+	omrthread_monitor_enter(state->monitor);
+	state->stolen += stolen;
+	state->threadsRunning -= 1;
+	omrthread_monitor_notify_all(state->monitor);
+	omrthread_monitor_exit(state->monitor);
+	return 0;
+}
+
+TEST_F(WorkStealingDequeTest, capacityIsRoundedToPowerOfTwo)
+{
+	MM_WorkStealingDeque *deque = MM_WorkStealingDeque::newInstance(env, 5);
+	ASSERT_TRUE(NULL != deque);
+
+	ASSERT_EQ((uintptr_t)8, deque->getCapacity());
+	for (uintptr_t i = 0; i < 8; i++) {
+		ASSERT_TRUE(deque->push(ELEMENT(i)));
+	}
+	/* the deque does not grow */
+	ASSERT_FALSE(deque->push(ELEMENT(8)));
+	ASSERT_EQ((uintptr_t)8, deque->getSize());
+
+	/* taking an element from either end frees a slot */
+	ASSERT_EQ(ELEMENT(0), deque->steal());
+	ASSERT_TRUE(deque->push(ELEMENT(8)));
+	ASSERT_FALSE(deque->push(ELEMENT(9)));
+
+	deque->reset();
+	ASSERT_TRUE(deque->isEmpty());
+	ASSERT_TRUE(NULL == deque->pop());
+
+	deque->kill(env);
+}
+
+TEST_F(WorkStealingDequeTest, ownerPopsLifoThievesStealFifo)
+{
+	MM_WorkStealingDeque *deque = MM_WorkStealingDeque::newInstance(env, 16);
+	ASSERT_TRUE(NULL != deque);
+
+	for (uintptr_t i = 0; i < 8; i++) {
+		ASSERT_TRUE(deque->push(ELEMENT(i)));
+	}
+	for (uintptr_t i = 0; i < 4; i++) {
+		ASSERT_EQ(ELEMENT(7 - i), deque->pop());
+		ASSERT_EQ(ELEMENT(i), deque->steal());
+	}
+	ASSERT_TRUE(deque->isEmpty());
+
+	deque->kill(env);
+}
+
+TEST_F(WorkStealingDequeTest, emptyDeque)
+{
+	MM_WorkStealingDeque *deque = MM_WorkStealingDeque::newInstance(env, 4);
+	ASSERT_TRUE(NULL != deque);
+
+	ASSERT_TRUE(NULL == deque->pop());
+	ASSERT_TRUE(NULL == deque->steal());
+	/* a failed pop must restore the bottom index */
+	ASSERT_TRUE(deque->isEmpty());
+	ASSERT_EQ((uintptr_t)0, deque->getSize());
+
+	/* last element taken by a thief: the owner then finds the deque empty */
+	ASSERT_TRUE(deque->push(ELEMENT(0)));
+	ASSERT_EQ(ELEMENT(0), deque->steal());
+	ASSERT_TRUE(NULL == deque->pop());
+	ASSERT_TRUE(NULL == deque->steal());
+	ASSERT_TRUE(deque->isEmpty());
+
+	/* last element taken by the owner: thieves then find the deque empty */
+	ASSERT_TRUE(deque->push(ELEMENT(1)));
+	ASSERT_EQ(ELEMENT(1), deque->pop());
+	ASSERT_TRUE(NULL == deque->steal());
+	ASSERT_TRUE(NULL == deque->pop());
+	ASSERT_TRUE(deque->isEmpty());
+
+	deque->kill(env);
+}
+
+TEST_F(WorkStealingDequeTest, slotReuseAcrossWraparound)
+{
+	MM_WorkStealingDeque *deque = MM_WorkStealingDeque::newInstance(env, 4);
+	ASSERT_TRUE(NULL != deque);
+
+	/*
+	 * Cycle the indices around the circular storage many times. Every slot is reused with a new
+	 * element, and an element from an earlier lap must never be returned again.
+	 */
+	uintptr_t next = 0;
+	for (uintptr_t lap = 0; lap < 10000; lap++) {
+		uintptr_t first = next;
+		for (uintptr_t i = 0; i < 3; i++) {
+			ASSERT_TRUE(deque->push(ELEMENT(next)));
+			next += 1;
+		}
+		ASSERT_EQ(ELEMENT(first), deque->steal());
+		ASSERT_EQ(ELEMENT(first + 2), deque->pop());
+		ASSERT_EQ(ELEMENT(first + 1), deque->pop());
+		ASSERT_TRUE(NULL == deque->pop());
+		ASSERT_TRUE(NULL == deque->steal());
+	}
+
+	deque->kill(env);
+}
+
+TEST_F(WorkStealingDequeTest, concurrentPushPopSteal)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	DequeTestState state;
+
+	memset(&state, 0, sizeof(state));
+	/* a small deque keeps the owner and thieves racing for the same slots */
+	state.deque = MM_WorkStealingDeque::newInstance(env, CONCURRENT_CAPACITY);
+	ASSERT_TRUE(NULL != state.deque);
+	state.takenCounts = (volatile uintptr_t *)omrmem_allocate_memory(CONCURRENT_ELEMENTS * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != state.takenCounts);
+	memset((void *)state.takenCounts, 0, CONCURRENT_ELEMENTS * sizeof(uintptr_t));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&state.monitor, 0, "work stealing deque test"));
+
+	for (uintptr_t i = 0; i < THIEF_THREADS; i++) {
+		omrthread_t thread = NULL;
+		if (0 == omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, thiefThread, &state)) {
+			omrthread_monitor_enter(state.monitor);
+			state.threadsRunning += 1;
+			omrthread_monitor_exit(state.monitor);
+		}
+	}
+
+	/* the owner pushes in bursts and pops part of each burst back, racing the thieves for the last element */
+	uintptr_t next = 0;
+	uintptr_t popped = 0;
+	for (uintptr_t burst = 0; next < CONCURRENT_ELEMENTS; burst++) {
+		for (uintptr_t i = 0; (i < CONCURRENT_CAPACITY) && (next < CONCURRENT_ELEMENTS); i++) {
+			if (!state.deque->push(ELEMENT(next))) {
+				/* let the thieves drain the deque rather than spinning on it, which matters on a single CPU */
+				omrthread_yield();
+				break;
+			}
+			next += 1;
+		}
+		for (uintptr_t i = 0; i <= (burst % CONCURRENT_CAPACITY); i++) {
+			void *element = state.deque->pop();
+			if (NULL == element) {
+				break;
+			}
+			recordTaken(&state, element);
+			popped += 1;
+		}
+	}
+	for (void *element = state.deque->pop(); NULL != element; element = state.deque->pop()) {
+		recordTaken(&state, element);
+		popped += 1;
+	}
+	state.ownerDone = 1;
+
+	omrthread_monitor_enter(state.monitor);
+	while (0 != state.threadsRunning) {
+		omrthread_monitor_wait(state.monitor);
+	}
+	omrthread_monitor_exit(state.monitor);
+
+	ASSERT_TRUE(state.deque->isEmpty());
+	gcTestEnv->log(LEVEL_VERBOSE, "concurrentPushPopSteal: popped %zu, stolen %zu\n", popped, state.stolen);
+	ASSERT_EQ((uintptr_t)CONCURRENT_ELEMENTS, popped + state.stolen);
+	for (uintptr_t i = 0; i < CONCURRENT_ELEMENTS; i++) {
+		ASSERT_EQ((uintptr_t)1, state.takenCounts[i]) << "element " << i << " was not taken exactly once";
+	}
+
+	omrthread_monitor_destroy(state.monitor);
+	omrmem_free_memory((void *)state.takenCounts);
+	state.deque->kill(env);
+}
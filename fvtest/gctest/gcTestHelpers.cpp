@@ -20,6 +20,9 @@
  *******************************************************************************/
 
 #include "gcTestHelpers.hpp"
+#include "EnvironmentBase.hpp"
+#include "omrgc.h"
+#include "StartupManagerTestExample.hpp"
 #if defined(WIN32) || defined(WIN64)
 /* windows.h defined uintptr_t.  Ignore its definition */
 #define UDATA UDATA_win_
@@ -27,6 +30,13 @@
 #undef UDATA	/* this is safe because our UDATA is a typedef, not a macro */
 #include <psapi.h>
 #endif /* defined(WIN32) || defined(WIN64) */
+#if defined(LINUX)
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
 
 void
 GCTestEnvironment::initParams()
@@ -93,6 +103,42 @@ GCTestEnvironment::GCTestTearDown()
 
 }
 
+void
+GCUnitTest::SetUp()
+{
+	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/sample_GC_config.xml");
+
+	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+
+	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+
+	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+
+	env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+}
+
+void
+GCUnitTest::TearDown()
+{
+	omr_error_t rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+
+	rc = OMR_GC_ShutdownCollector(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownCollector failed, rc=" << rc;
+
+	rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+
+	rc = OMR_GC_ShutdownHeap(exampleVM->_omrVM);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownHeap failed, rc=" << rc;
+
+	exampleVM->_omrVMThread = NULL;
+	env = NULL;
+}
+
 void
 printMemUsed(const char *where, OMRPortLibrary *portLib)
 {
@@ -131,3 +177,82 @@ printMemUsed(const char *where, OMRPortLibrary *portLib)
 	/* memory info not supported */
 #endif
 }
+
+#if defined(LINUX)
+static int
+openHardwareCounter(uint64_t config)
+{
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = config;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	/* count for the calling thread on any CPU */
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static uint64_t
+readHardwareCounter(int fd)
+{
+	uint64_t count = 0;
+	if (sizeof(count) != read(fd, &count, sizeof(count))) {
+		count = 0;
+	}
+	return count;
+}
+#endif /* defined(LINUX) */
+
+GCTestCacheCounters::GCTestCacheCounters()
+	: _referencesFD(-1)
+	, _missesFD(-1)
+	, _references(0)
+	, _misses(0)
+{
+#if defined(LINUX)
+	_referencesFD = openHardwareCounter(PERF_COUNT_HW_CACHE_REFERENCES);
+	_missesFD = openHardwareCounter(PERF_COUNT_HW_CACHE_MISSES);
+#endif /* defined(LINUX) */
+}
+
+GCTestCacheCounters::~GCTestCacheCounters()
+{
+#if defined(LINUX)
+	if (-1 != _referencesFD) {
+		close(_referencesFD);
+	}
+	if (-1 != _missesFD) {
+		close(_missesFD);
+	}
+#endif /* defined(LINUX) */
+}
+
+void
+GCTestCacheCounters::start()
+{
+	_references = 0;
+	_misses = 0;
+#if defined(LINUX)
+	if (isAvailable()) {
+		ioctl(_referencesFD, PERF_EVENT_IOC_RESET, 0);
+		ioctl(_missesFD, PERF_EVENT_IOC_RESET, 0);
+		ioctl(_referencesFD, PERF_EVENT_IOC_ENABLE, 0);
+		ioctl(_missesFD, PERF_EVENT_IOC_ENABLE, 0);
+	}
+#endif /* defined(LINUX) */
+}
+
+void
+GCTestCacheCounters::stop()
+{
+#if defined(LINUX)
+	if (isAvailable()) {
+		ioctl(_referencesFD, PERF_EVENT_IOC_DISABLE, 0);
+		ioctl(_missesFD, PERF_EVENT_IOC_DISABLE, 0);
+		_references = readHardwareCounter(_referencesFD);
+		_misses = readHardwareCounter(_missesFD);
+	}
+#endif /* defined(LINUX) */
+}
@@ -73,6 +73,69 @@ public:
  */
 void printMemUsed(const char *where, OMRPortLibrary *portLib);
 
+/**
+ * Hardware cache reference and miss counters for the calling thread, used by perf tests to measure the
+ * memory locality of mutator code. The generic hardware events available to user code count references
+ * to and misses in the last level of the cache hierarchy. The counters are not available on all platforms
+ * or systems (see isAvailable()), in which case they always read zero.
+ */
+class GCTestCacheCounters
+{
+	/*
+	 * Data members
+	 */
+private:
+	int _referencesFD; /**< counter for cache references, or -1 */
+	int _missesFD; /**< counter for cache misses, or -1 */
+	uint64_t _references; /**< cache references counted between the last start() and stop() */
+	uint64_t _misses; /**< cache misses counted between the last start() and stop() */
+
+	/*
+	 * Function members
+	 */
+public:
+	bool isAvailable() { return (-1 != _referencesFD) && (-1 != _missesFD); }
+	void start();
+	void stop();
+	uint64_t getReferences() { return _references; }
+	uint64_t getMisses() { return _misses; }
+
+	GCTestCacheCounters();
+	~GCTestCacheCounters();
+};
+
 extern GCTestEnvironment *gcTestEnv;
 
+class MM_EnvironmentBase;
+
+/**
+ * Fixture for unit tests of GC components that need a GC environment (e.g. to allocate through the forge)
+ * but do not allocate objects or collect. Each test runs against a minimal heap brought up from the sample
+ * configuration, without a verbose manager or collector language interface.
+ */
+class GCUnitTest : public ::testing::Test
+{
+	/*
+	 * Data members
+	 */
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+
+	/*
+	 * Function members
+	 */
+protected:
+	virtual void SetUp();
+	virtual void TearDown();
+
+public:
+	GCUnitTest()
+		: ::testing::Test()
+		, exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+	{
+	}
+};
+
 #endif /* GCTESTHELPERS_HPP_INCLUDED */
@@ -49,7 +49,7 @@ omr_ddrtest:
 	./ddrgen ./ddrgentest --macrolist test/macroList
 
 omr_gctest:
-	./omrgctest --gtest_filter="gcFunctionalTest*"
+	./omrgctest --gtest_filter="gcFunctionalTest*:HeapMapScanTest*:WorkStealingDequeTest*"
 
 # jitbuilder can run different sets of tests on linux_x86 and osx than on other platforms
 # until we common this up, run "testall" on linux_x86 and osx but run "test" everywhere else
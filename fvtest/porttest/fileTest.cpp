@@ -147,6 +147,8 @@ TEST(PortInitializationTest, File)
 	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_blockingasync_flength);
 	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_blockingasync_shutdown);
 	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_blockingasync_startup);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_blockingasync_submit);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_blockingasync_drain);
 
 	/* Verify that the file function pointers are non NULL */
 
@@ -4785,6 +4785,116 @@ exit:
 }
 
 
+static void
+file_test41_callback(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *request)
+{
+	uintptr_t *callbackCount = (uintptr_t *)request->userData;
+	*callbackCount += 1;
+}
+
+/**
+ * Test omrfile_blockingasync_submit and omrfile_blockingasync_drain.
+ * A batch of appends, a positioned write and a close are queued on one file and must be
+ * performed in submission order; the file is then read back with a second batch.
+ */
+TEST_F(PortFileTest2, file_test41)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_test41";
+	const char *fileName = "tfileTest41.tst";
+	char lines[4][8] = {"line0\n", "line1\n", "line2\n", "line3\n"};
+	const char *expected = "line0\nLINE1\nline2\nline3\n";
+	char readBuffer[64];
+	OMRFileAsyncRequest requests[6];
+	uintptr_t callbackCount = 0;
+	intptr_t fd = -1;
+	intptr_t i = 0;
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrfile_unlink(fileName);
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed\n");
+		goto exit;
+	}
+
+	memset(requests, 0, sizeof(requests));
+	for (i = 0; i < 4; i++) {
+		requests[i].operation = OMRPORT_FILE_ASYNC_WRITE;
+		requests[i].fd = fd;
+		requests[i].buf = lines[i];
+		requests[i].nbytes = 6;
+		requests[i].offset = OMRPORT_FILE_ASYNC_OFFSET_CURRENT;
+		requests[i].callback = file_test41_callback;
+		requests[i].userData = &callbackCount;
+	}
+	requests[4].operation = OMRPORT_FILE_ASYNC_WRITE;
+	requests[4].fd = fd;
+	requests[4].buf = (void *)"LINE1";
+	requests[4].nbytes = 5;
+	requests[4].offset = 6;
+	requests[5].operation = OMRPORT_FILE_ASYNC_CLOSE;
+	requests[5].fd = fd;
+
+	rc = omrfile_blockingasync_submit(requests, 6);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_submit() returned %d expected 0\n", rc);
+		omrfile_close(fd);
+		goto exit;
+	}
+	omrfile_blockingasync_drain();
+
+	if (4 != callbackCount) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "callback invoked %zu times expected 4\n", callbackCount);
+	}
+	for (i = 0; i < 4; i++) {
+		if (6 != requests[i].result) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "write request %zd result %zd expected 6\n", i, requests[i].result);
+		}
+	}
+	if ((1 != requests[4].complete) || (5 != requests[4].result)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "positioned write complete=%zu result=%zd expected 1 and 5\n", requests[4].complete, requests[4].result);
+	}
+	if ((1 != requests[5].complete) || (0 != requests[5].result)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "close complete=%zu result=%zd expected 1 and 0\n", requests[5].complete, requests[5].result);
+	}
+
+	fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed to reopen the file\n");
+		goto exit;
+	}
+	memset(readBuffer, 0, sizeof(readBuffer));
+	memset(requests, 0, sizeof(requests));
+	requests[0].operation = OMRPORT_FILE_ASYNC_READ;
+	requests[0].fd = fd;
+	requests[0].buf = readBuffer;
+	requests[0].nbytes = sizeof(readBuffer) - 1;
+	requests[0].offset = 0;
+	requests[1].operation = OMRPORT_FILE_ASYNC_CLOSE;
+	requests[1].fd = fd;
+	rc = omrfile_blockingasync_submit(requests, 2);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_submit() returned %d expected 0\n", rc);
+		omrfile_close(fd);
+		goto exit;
+	}
+	omrfile_blockingasync_drain();
+
+	if ((intptr_t)strlen(expected) != requests[0].result) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "read request result %zd expected %zu\n", requests[0].result, strlen(expected));
+	} else if (0 != strcmp(expected, readBuffer)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "read back \"%s\" expected \"%s\"\n", readBuffer, expected);
+	}
+
+exit:
+	omrfile_unlink(fileName);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+
 
 
 
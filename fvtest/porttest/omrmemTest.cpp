@@ -1477,6 +1477,128 @@ TEST(PortMemTest, mem_test9_category_walk)
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+#define SLAB_TEST_ARENA_SIZE (1024 * 1024)
+#define SLAB_TEST_BLOCK_COUNT 64
+
+/**
+ * Verify the slab allocator enabled with OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE.
+ *
+ * Blocks allocated before the slab allocator is enabled must still be freed properly,
+ * reallocation must keep the contents when blocks move between size classes,
+ * and the port library category must count every live block.
+ *
+ * The test uses its own port library, since the slab allocator cannot be disabled again.
+ */
+TEST(PortMemTest, mem_test10_slab_allocator)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test10_slab_allocator";
+	OMRPortLibrary slabPortLibrary;
+	OMRPortLibrary *slabLib = &slabPortLibrary;
+	struct CategoriesState categoriesState;
+	uint8_t *blocks[SLAB_TEST_BLOCK_COUNT];
+	uintptr_t sizes[SLAB_TEST_BLOCK_COUNT];
+	uintptr_t initialBlocks = 0;
+	uintptr_t initialBytes = 0;
+	uintptr_t expectedBytes = 0;
+	void *basicBlock = NULL;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memset(blocks, 0, sizeof(blocks));
+	if (0 != omrport_init_library(slabLib, sizeof(OMRPortLibrary))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrport_init_library failed\n");
+		goto exit;
+	}
+
+	getCategoriesState(slabLib, &categoriesState);
+	initialBlocks = categoriesState.portLibraryBlocks;
+	initialBytes = categoriesState.portLibraryBytes;
+
+	/* allocated by the basic allocator, freed once the slab allocator is enabled */
+	basicBlock = slabLib->mem_allocate_memory(slabLib, 64, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == basicBlock) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected native OOM\n");
+		goto shutdown;
+	}
+
+	if (0 == slabLib->port_control(slabLib, OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE, 0)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Slab allocator enabled with an empty arena\n");
+		goto shutdown;
+	}
+	if (0 != slabLib->port_control(slabLib, OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE, SLAB_TEST_ARENA_SIZE)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Failed to enable the slab allocator\n");
+		goto shutdown;
+	}
+	if (0 == slabLib->port_control(slabLib, OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE, SLAB_TEST_ARENA_SIZE)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Slab allocator enabled twice\n");
+		goto shutdown;
+	}
+
+	for (i = 0; i < SLAB_TEST_BLOCK_COUNT; i++) {
+		sizes[i] = (i * 37) % 1100;
+		blocks[i] = (uint8_t *)slabLib->mem_allocate_memory(slabLib, sizes[i], OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == blocks[i]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected native OOM\n");
+			goto shutdown;
+		}
+		memset(blocks[i], (int)i, sizes[i]);
+		expectedBytes += sizes[i];
+	}
+
+	getCategoriesState(slabLib, &categoriesState);
+	if (categoriesState.portLibraryBlocks != (initialBlocks + SLAB_TEST_BLOCK_COUNT + 1)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of blocks after allocate. Expected %zd, got %zd.\n",
+			initialBlocks + SLAB_TEST_BLOCK_COUNT + 1, categoriesState.portLibraryBlocks);
+	}
+	if (categoriesState.portLibraryBytes < (initialBytes + expectedBytes)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of bytes after allocate. Expected at least %zd, got %zd.\n",
+			initialBytes + expectedBytes, categoriesState.portLibraryBytes);
+	}
+
+	/* grow every block into a larger size class, some of them past the largest one */
+	for (i = 0; i < SLAB_TEST_BLOCK_COUNT; i++) {
+		uint8_t *newBlock = (uint8_t *)slabLib->mem_reallocate_memory(slabLib, blocks[i], (sizes[i] * 3) + 1, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == newBlock) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected native OOM\n");
+			goto shutdown;
+		}
+		blocks[i] = newBlock;
+		for (j = 0; j < sizes[i]; j++) {
+			if ((uint8_t)i != newBlock[j]) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "Block %zd changed at offset %zd by reallocate\n", i, j);
+				break;
+			}
+		}
+	}
+
+	for (i = 0; i < SLAB_TEST_BLOCK_COUNT; i++) {
+		slabLib->mem_free_memory(slabLib, blocks[i]);
+		blocks[i] = NULL;
+	}
+	slabLib->mem_free_memory(slabLib, basicBlock);
+	basicBlock = NULL;
+
+	getCategoriesState(slabLib, &categoriesState);
+	if (categoriesState.portLibraryBlocks != initialBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of blocks after free. Expected %zd, got %zd.\n", initialBlocks, categoriesState.portLibraryBlocks);
+	}
+	if (categoriesState.portLibraryBytes != initialBytes) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of bytes after free. Expected %zd, got %zd.\n", initialBytes, categoriesState.portLibraryBytes);
+	}
+
+shutdown:
+	for (i = 0; i < SLAB_TEST_BLOCK_COUNT; i++) {
+		slabLib->mem_free_memory(slabLib, blocks[i]);
+	}
+	slabLib->mem_free_memory(slabLib, basicBlock);
+	slabLib->port_shutdown_library(slabLib);
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 #if !(defined(OSX) && defined(OMR_ENV_DATA64))
 /* attempt to free all mem pointers stored in memPtrs array with length */
 static void
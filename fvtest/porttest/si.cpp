@@ -2158,3 +2158,202 @@ TEST(PortSysinfoTest, sysinfo_cgroup_get_memlimit)
 	reportTestExit(OMRPORTLIB, testName);
 	return;
 }
+
+/**
+ * Test omrsysinfo_cgroup_get_cpulimit.
+ */
+TEST(PortSysinfoTest, sysinfo_cgroup_get_cpulimit)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrsysinfo_cgroup_get_cpulimit";
+	uintptr_t cgroupCPULimit = 0;
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	/* The CPU quota does not depend on cgroup limits being enabled */
+	rc = omrsysinfo_cgroup_get_cpulimit(&cgroupCPULimit);
+
+#if defined(LINUX)
+	if (0 == rc) {
+		uintptr_t targetCPUs = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET);
+
+		portTestEnv->log("omrsysinfo_cgroup_get_cpulimit returned %zu\n", cgroupCPULimit);
+		if (0 == cgroupCPULimit) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrsysinfo_cgroup_get_cpulimit returned a limit of 0 CPUs\n");
+		} else if (targetCPUs > cgroupCPULimit) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "OMRPORT_CPU_TARGET is %zu, more than the cgroup CPU limit of %zu\n", targetCPUs, cgroupCPULimit);
+		}
+	} else if (OMRPORT_ERROR_SYSINFO_CGROUP_CPULIMIT_NOT_SET != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrsysinfo_cgroup_get_cpulimit returned %d, expected 0 or %d\n", rc, OMRPORT_ERROR_SYSINFO_CGROUP_CPULIMIT_NOT_SET);
+	}
+#else
+	if (OMRPORT_ERROR_SYSINFO_CGROUP_UNSUPPORTED_PLATFORM != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrsysinfo_cgroup_get_cpulimit returned %d, expected %d on platform that does not support cgroups\n", rc, OMRPORT_ERROR_SYSINFO_CGROUP_UNSUPPORTED_PLATFORM);
+	}
+#endif
+	reportTestExit(OMRPORTLIB, testName);
+	return;
+}
+
+#if defined(LINUX)
+#define CGROUP_TEST_ROOT "sysinfoCgroupTest"
+
+/**
+ * Write a file of the cgroup test tree, creating its directories as needed.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] testName The name of the calling test
+ * @param[in] fileName Path of the file relative to the root of the test tree
+ * @param[in] contents Contents of the file
+ */
+static void
+writeCgroupTestFile(OMRPortLibrary *portLibrary, const char *testName, const char *fileName, const char *contents)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char path[EsMaxPath];
+	char *separator = NULL;
+	intptr_t fd = -1;
+
+	omrstr_printf(path, sizeof(path), "%s/%s", CGROUP_TEST_ROOT, fileName);
+	for (separator = strchr(path, '/'); NULL != separator; separator = strchr(separator + 1, '/')) {
+		/* fails harmlessly if the directory exists */
+		*separator = '\0';
+		omrfile_mkdir(path);
+		*separator = '/';
+	}
+
+	fd = omrfile_open(path, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "failed to create %s\n", path);
+		return;
+	}
+	if ((intptr_t)strlen(contents) != omrfile_write(fd, contents, strlen(contents))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "failed to write %s\n", path);
+	}
+	omrfile_close(fd);
+}
+
+/**
+ * Write the /proc/<pid>/cgroup file of the cgroup test tree for the current process.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] testName The name of the calling test
+ * @param[in] contents Contents of the file
+ */
+static void
+writeCgroupTestProcessFile(OMRPortLibrary *portLibrary, const char *testName, const char *contents)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char fileName[EsMaxPath];
+
+	omrstr_printf(fileName, sizeof(fileName), "proc/%zu/cgroup", omrsysinfo_get_pid());
+	writeCgroupTestFile(OMRPORTLIB, testName, fileName, contents);
+}
+
+/**
+ * Read the CPU limit from the cgroup test tree, and remove the tree.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] testName The name of the calling test
+ * @param[in] expectedLimit Expected limit, 0 if no limit should be found
+ */
+static void
+checkCgroupTestCPULimit(OMRPortLibrary *portLibrary, const char *testName, uintptr_t expectedLimit)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t cgroupCPULimit = 0;
+	int32_t rc = 0;
+
+	omrport_control(OMRPORT_CTLDATA_CGROUP_ROOT, (uintptr_t)CGROUP_TEST_ROOT);
+	rc = omrsysinfo_cgroup_get_cpulimit(&cgroupCPULimit);
+	omrport_control(OMRPORT_CTLDATA_CGROUP_ROOT, 0);
+	deleteControlDirectory(OMRPORTLIB, (char *)CGROUP_TEST_ROOT);
+
+	if (0 == expectedLimit) {
+		if (OMRPORT_ERROR_SYSINFO_CGROUP_CPULIMIT_NOT_SET != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrsysinfo_cgroup_get_cpulimit returned %d with a limit of %zu, expected %d\n", rc, cgroupCPULimit, OMRPORT_ERROR_SYSINFO_CGROUP_CPULIMIT_NOT_SET);
+		}
+	} else if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrsysinfo_cgroup_get_cpulimit returned %d, expected a limit of %zu\n", rc, expectedLimit);
+	} else if (expectedLimit != cgroupCPULimit) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrsysinfo_cgroup_get_cpulimit returned a limit of %zu, expected %zu\n", cgroupCPULimit, expectedLimit);
+	}
+}
+
+/**
+ * Test that a cgroup v2 quota of "max" is read as no limit.
+ */
+TEST(PortSysinfoTest, sysinfo_cgroup_get_cpulimit_unlimited)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrsysinfo_cgroup_get_cpulimit_unlimited";
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	deleteControlDirectory(OMRPORTLIB, (char *)CGROUP_TEST_ROOT);
+	writeCgroupTestProcessFile(OMRPORTLIB, testName, "0::/app.slice/app\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/cgroup.controllers", "cpuset cpu io memory pids\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/app.slice/cpu.max", "max 100000\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/app.slice/app/cpu.max", "max 100000\n");
+	checkCgroupTestCPULimit(OMRPORTLIB, testName, 0);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Test that a quota for part of a CPU is rounded up to a whole CPU.
+ */
+TEST(PortSysinfoTest, sysinfo_cgroup_get_cpulimit_fractional)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrsysinfo_cgroup_get_cpulimit_fractional";
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	/* cgroup v1 cpu controller of a hybrid system, which also lists the v2 hierarchy */
+	deleteControlDirectory(OMRPORTLIB, (char *)CGROUP_TEST_ROOT);
+	writeCgroupTestProcessFile(OMRPORTLIB, testName, "4:cpu,cpuacct:/app\n3:memory:/app\n0::/app\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/cpu/cpu.cfs_quota_us", "-1\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/cpu/cpu.cfs_period_us", "100000\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/cpu/app/cpu.cfs_quota_us", "150000\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/cpu/app/cpu.cfs_period_us", "100000\n");
+	checkCgroupTestCPULimit(OMRPORTLIB, testName, 2);
+
+	/* cgroup v2 */
+	writeCgroupTestProcessFile(OMRPORTLIB, testName, "0::/app\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/cgroup.controllers", "cpu memory\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/app/cpu.max", "50000 100000\n");
+	checkCgroupTestCPULimit(OMRPORTLIB, testName, 1);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Test that the smallest quota of the cgroup of the process and its ancestors is found, including
+ * when the cgroup of the process is not visible under the mount point.
+ */
+TEST(PortSysinfoTest, sysinfo_cgroup_get_cpulimit_ancestors)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrsysinfo_cgroup_get_cpulimit_ancestors";
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	/* cgroup v1 container without a cgroup namespace: the host path does not exist under the mount point */
+	deleteControlDirectory(OMRPORTLIB, (char *)CGROUP_TEST_ROOT);
+	writeCgroupTestProcessFile(OMRPORTLIB, testName, "5:cpuacct,cpu:/docker/0123456789ab\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/cpu/cpu.cfs_quota_us", "400000\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/cpu/cpu.cfs_period_us", "100000\n");
+	checkCgroupTestCPULimit(OMRPORTLIB, testName, 4);
+
+	/* cgroup v2: the parent has a smaller quota than the cgroup of the process */
+	writeCgroupTestProcessFile(OMRPORTLIB, testName, "0::/parent/child\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/cgroup.controllers", "cpu memory\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/parent/cpu.max", "200000 100000\n");
+	writeCgroupTestFile(OMRPORTLIB, testName, "sys/fs/cgroup/parent/child/cpu.max", "400000 100000\n");
+	checkCgroupTestCPULimit(OMRPORTLIB, testName, 2);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+#endif /* defined(LINUX) */
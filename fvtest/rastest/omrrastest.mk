@@ -35,6 +35,7 @@ OBJECTS := \
   traceLifecycleTest \
   traceLogTest \
   traceRecordHelpers \
+  traceRingFileTest \
   traceTest \
   ut_omr_test
 OBJECTS := $(addsuffix $(OBJEXT),$(OBJECTS))
@@ -64,6 +64,7 @@ typedef struct FailingSubscriberData {
 	uint32_t alarmCount;
 } FailingSubscriberData;
 
+static void stressTraceBufferManagement(const char *trcOpts);
 static void startChildThread(OMRTestVM *testVM, omrthread_t *childThread, omrthread_entrypoint_t entryProc, TestChildThreadData *childData);
 static omr_error_t waitForChildThread(OMRTestVM *testVM, omrthread_t childThread, TestChildThreadData *childData);
 static int J9THREAD_PROC childThreadMain(void *entryArg);
@@ -140,6 +141,27 @@ static const char *ibmText2[] = {
 };
 
 TEST(TraceLogTest, stressTraceBufferManagement)
+{
+	/* Trace options:
+	 *
+	 * buffers=1k: Use small buffers to exercise buffer wrapping.
+	 *
+	 * maximal=!j9thr: Disable j9thr tracepoints because the trace engine uses monitors, and it is unsafe
+	 * to log tracepoints from a omrthread function that manipulates monitor state. In particular, j9thr.17
+	 * is fired from unblock_spinlock_threads() via omrthread_monitor_exit(omrVM->_vmThreadListMutex) in
+	 * OMR_Thread_FirstInit().
+	 */
+	stressTraceBufferManagement("buffers=1k:maximal=all:maximal=!j9thr");
+}
+
+TEST(TraceLogTest, stressTraceBufferManagementAsync)
+{
+	/* buffers=1k,async: Full buffers are handed to the trace publisher thread. */
+	stressTraceBufferManagement("buffers=1k,async:maximal=all:maximal=!j9thr");
+}
+
+static void
+stressTraceBufferManagement(const char *trcOpts)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
 	OMRTestVM testVM;
@@ -171,17 +193,7 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 	childData[3].traceData = ibmText2;
 
 	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
-
-	/* Trace options:
-	 *
-	 * buffers=1k: Use small buffers to exercise buffer wrapping.
-	 *
-	 * maximal=!j9thr: Disable j9thr tracepoints because the trace engine uses monitors, and it is unsafe
-	 * to log tracepoints from a omrthread function that manipulates monitor state. In particular, j9thr.17
-	 * is fired from unblock_spinlock_threads() via omrthread_monitor_exit(omrVM->_vmThreadListMutex) in
-	 * OMR_Thread_FirstInit().
-	 */
-	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "buffers=1k:maximal=all:maximal=!j9thr", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, trcOpts, NULL));
 	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "stressBufferManagement"));
 
 	/* load traceagent */
@@ -208,7 +220,10 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
 		OMRTEST_ASSERT_ERROR_NONE(waitForChildThread(&testVM, childThread[i], &childData[i]));
 	}
-	/* All tracepoints from the child threads should have been published when they terminated */
+	/* All tracepoints from the child threads should have been published when they terminated,
+	 * or be queued for asynchronous publication.
+	 */
+	OMRTEST_ASSERT_ERROR_NONE(ti->FlushTraceData(vmthread));
 
 	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
 
@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include <string.h>
+
+#include "omrport.h"
+#include "omr.h"
+#include "omrrasinit.h"
+#include "omrTest.h"
+#include "omrTestHelpers.h"
+#include "omrtrace.h"
+#include "omrtraceformat.h"
+#include "omrvm.h"
+#include "ut_omr_test.h"
+
+#include "rasTestHelpers.hpp"
+
+/*
+ * This test covers:
+ * - Writing published trace buffers to a memory-mapped trace ring file
+ * - Tailing the ring file with the streaming formatter while trace is running
+ * - Detecting buffers overwritten before they were read
+ * - Rejecting a new ring file once trace is running
+ */
+
+#define RING_FILE_NAME "traceRingFileTest.trc"
+#define OTHER_RING_FILE_NAME "traceRingFileTest2.trc"
+#define RING_TEST_STRING "ring file tracepoint"
+
+static char *getRingFileFormatString(const char *componentName, int32_t tracepoint);
+static void fillTraceBuffers(OMR_VMThread *vmthread, size_t count);
+static void countRingFileTracepoints(UtTraceRingFileIterator *ringIterator, size_t *tracepointCount, size_t *bufferCount);
+
+TEST(TraceRingFileTest, tailRingFile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+	UtTraceRingFileIterator *ringIterator = NULL;
+	size_t tracepointCount = 0;
+	size_t bufferCount = 0;
+
+	omrfile_unlink(RING_FILE_NAME);
+	omrfile_unlink(OTHER_RING_FILE_NAME);
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+	/* 1k buffers in a 16k ring file leave room for a dozen or so buffers. */
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "buffers=1k:maximal=all:maximal=!j9thr:output=" RING_FILE_NAME ",16k", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "tailRingFile"));
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+
+	/* The file exists as soon as trace is running, and can be opened while it is written. */
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTraceRingFileIterator(OMRPORTLIB, RING_FILE_NAME, &ringIterator, getRingFileFormatString));
+	ASSERT_FALSE(NULL == ringIterator);
+
+	/* The ring file cannot be switched once trace is running. */
+	const char *outputOpts[] = {"output", OTHER_RING_FILE_NAME, NULL};
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_ILLEGAL_ARGUMENT,
+						 testVM.omrVM._trcEngine->omrTraceIntfS.SetOptions(OMR_TRACE_THREAD_FROM_VMTHREAD(vmthread), outputOpts));
+	ASSERT_GT(0, omrfile_attr(OTHER_RING_FILE_NAME));
+
+	/* Each pass reads only the buffers published since the previous one. */
+	ASSERT_NO_FATAL_FAILURE(countRingFileTracepoints(ringIterator, &tracepointCount, &bufferCount));
+	fillTraceBuffers(vmthread, 4);
+	ASSERT_NO_FATAL_FAILURE(countRingFileTracepoints(ringIterator, &tracepointCount, &bufferCount));
+	ASSERT_LT((size_t)0, tracepointCount);
+	ASSERT_LE((size_t)3, bufferCount);
+	ASSERT_NO_FATAL_FAILURE(countRingFileTracepoints(ringIterator, &tracepointCount, &bufferCount));
+	ASSERT_EQ((size_t)0, tracepointCount);
+	ASSERT_EQ((size_t)0, bufferCount);
+	ASSERT_EQ((uint64_t)0, omr_trc_getTraceRingFileLostBuffers(ringIterator));
+
+	/* Wrap the ring several times without reading it. */
+	fillTraceBuffers(vmthread, 64);
+	ASSERT_NO_FATAL_FAILURE(countRingFileTracepoints(ringIterator, &tracepointCount, &bufferCount));
+	ASSERT_LT((size_t)0, tracepointCount);
+	ASSERT_LT((uint64_t)0, omr_trc_getTraceRingFileLostBuffers(ringIterator));
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_freeTraceRingFileIterator(ringIterator));
+
+	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+
+	omrfile_unlink(RING_FILE_NAME);
+}
+
+TEST(TraceRingFileTest, invalidRingFile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	UtTraceRingFileIterator *ringIterator = NULL;
+	const char notARingFile[] = "This is not a trace ring file, but it is long enough to hold the header.";
+
+	omrfile_unlink(RING_FILE_NAME);
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_FILE_UNAVAILABLE,
+						 omr_trc_getTraceRingFileIterator(OMRPORTLIB, RING_FILE_NAME, &ringIterator, getRingFileFormatString));
+
+	intptr_t fd = omrfile_open(RING_FILE_NAME, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	ASSERT_NE(-1, fd);
+	ASSERT_EQ((intptr_t)sizeof(notARingFile), omrfile_write(fd, notARingFile, sizeof(notARingFile)));
+	omrfile_close(fd);
+
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_NOT_AVAILABLE,
+						 omr_trc_getTraceRingFileIterator(OMRPORTLIB, RING_FILE_NAME, &ringIterator, getRingFileFormatString));
+	ASSERT_TRUE(NULL == ringIterator);
+
+	omrfile_unlink(RING_FILE_NAME);
+}
+
+static char *
+getRingFileFormatString(const char *componentName, int32_t tracepoint)
+{
+	/* Only the test string tracepoint has parameters that the test formats. */
+	if ((0 == strcmp(componentName, "omr_test")) && (1 == tracepoint)) {
+		return (char *)"String: %s";
+	}
+	return (char *)"Tracepoint";
+}
+
+/*
+ * Log enough tracepoints to fill (and publish) about count 1k trace buffers.
+ */
+static void
+fillTraceBuffers(OMR_VMThread *vmthread, size_t count)
+{
+	const size_t tracepointsPerBuffer = 1024 / (sizeof(RING_TEST_STRING) + 8);
+	for (size_t i = 0; i < (count * tracepointsPerBuffer); i += 1) {
+		Trc_OMR_Test_String(vmthread, RING_TEST_STRING);
+	}
+}
+
+/*
+ * Format every buffer available from the ring file, and count the test string tracepoints.
+ */
+static void
+countRingFileTracepoints(UtTraceRingFileIterator *ringIterator, size_t *tracepointCount, size_t *bufferCount)
+{
+	UtTracePointIterator *bufferIterator = NULL;
+	char formatted[512];
+
+	*tracepointCount = 0;
+	*bufferCount = 0;
+	for (;;) {
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTracePointIteratorForNextRingBuffer(ringIterator, &bufferIterator));
+		if (NULL == bufferIterator) {
+			break;
+		}
+		*bufferCount += 1;
+		while (NULL != omr_trc_formatNextTracePoint(bufferIterator, formatted, sizeof(formatted))) {
+			if (NULL != strstr(formatted, RING_TEST_STRING)) {
+				*tracepointCount += 1;
+			}
+		}
+		omr_trc_freeTracePointIterator(bufferIterator);
+	}
+}
@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include <string.h>
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+#include "contentionprofiler.h"
+
+#if defined(OMR_THR_JLM) && defined(OMR_THR_JLM_HOLD_TIMES)
+
+#define CONTENTION_HOLD_MILLIS 100
+
+extern ThreadTestEnvironment *omrTestEnv;
+
+typedef struct ContentionInfo {
+	omrthread_monitor_t hot;
+	volatile uintptr_t released;
+	volatile uintptr_t drained;
+	volatile uintptr_t finished;
+} ContentionInfo;
+
+/* Enter the hot monitor, which the main thread holds, and keep the samples until they are drained. */
+static int J9THREAD_PROC
+contendedEnter(void *entryArg)
+{
+	ContentionInfo *info = (ContentionInfo *)entryArg;
+
+	omrthread_monitor_enter(info->hot);
+	omrthread_monitor_exit(info->hot);
+	info->released = 1;
+	while (0 == info->drained) {
+		omrthread_sleep(1);
+	}
+	info->finished = 1;
+	return 0;
+}
+
+/* Wait up to timeoutMillis for the periodic aggregations to reach count. */
+static BOOLEAN
+waitForAggregations(OMRContentionProfiler *profiler, uintptr_t count, uintptr_t timeoutMillis)
+{
+	uintptr_t waited = 0;
+
+	omrthread_monitor_enter(profiler->mutex);
+	while ((profiler->aggregations < count) && (waited < timeoutMillis)) {
+		omrthread_monitor_wait_timed(profiler->mutex, 10, 0);
+		waited += 10;
+	}
+	omrthread_monitor_exit(profiler->mutex);
+
+	return profiler->aggregations >= count;
+}
+
+/**
+ * Make another thread wait CONTENTION_HOLD_MILLIS to enter a monitor,
+ * then aggregate the samples, or let the aggregator thread aggregate
+ * them if aggregated is NULL.
+ */
+static void
+contend(OMRContentionProfiler *profiler, uintptr_t *aggregated)
+{
+	ContentionInfo info = {NULL, 0, 0, 0};
+	omrthread_t thread = NULL;
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.hot, 0, "contention test hot"));
+	omrthread_monitor_enter(info.hot);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, contendedEnter, &info));
+	omrthread_sleep(CONTENTION_HOLD_MILLIS);
+	omrthread_monitor_exit(info.hot);
+	while (0 == info.released) {
+		omrthread_sleep(1);
+	}
+
+	if (NULL != aggregated) {
+		*aggregated = contentionProfilerAggregate(profiler);
+	} else {
+		/* the sample was recorded before released was set, so the next aggregation after this one drains it */
+		uintptr_t aggregations = profiler->aggregations;
+		EXPECT_TRUE(waitForAggregations(profiler, aggregations + 2, 10000));
+	}
+
+	info.drained = 1;
+	while (0 == info.finished) {
+		omrthread_sleep(1);
+	}
+	omrthread_monitor_destroy(info.hot);
+}
+
+TEST(ContentionProfilerTest, HotSite)
+{
+	OMRContentionProfiler *profiler = contentionProfilerNew(omrTestEnv->getPortLibrary(), 4);
+	OMRContentionSite sites[4];
+	uintptr_t aggregated = 0;
+	uintptr_t count = 0;
+
+	ASSERT_TRUE(NULL != profiler);
+	ASSERT_EQ(0, omrthread_jlm_contention_sampling_start(1, 16));
+
+	contend(profiler, &aggregated);
+	omrthread_jlm_contention_sampling_stop();
+
+	EXPECT_LE((uintptr_t)1, aggregated);
+	count = contentionProfilerGetTopSites(profiler, sites, 4);
+	ASSERT_LE((uintptr_t)1, count);
+	/* no other monitor is entered for anywhere near as long */
+	EXPECT_STREQ("contention test hot", sites[0].monitorName);
+	EXPECT_LE((uintptr_t)1, sites[0].count);
+	EXPECT_LT((uint64_t)0, sites[0].waitTime);
+#if defined(__GNUC__)
+	EXPECT_TRUE(NULL != sites[0].callsite);
+#endif /* defined(__GNUC__) */
+	contentionProfilerReport(profiler);
+
+	contentionProfilerClear(profiler);
+	EXPECT_EQ((uintptr_t)0, contentionProfilerGetTopSites(profiler, sites, 4));
+	contentionProfilerFree(profiler);
+}
+
+TEST(ContentionProfilerTest, Stopped)
+{
+	OMRContentionProfiler *profiler = contentionProfilerNew(omrTestEnv->getPortLibrary(), 4);
+	uintptr_t aggregated = 0;
+
+	ASSERT_TRUE(NULL != profiler);
+	ASSERT_NE(0, omrthread_jlm_contention_sampling_start(0, 16));
+	ASSERT_NE(0, omrthread_jlm_contention_sampling_start(1, 0));
+
+	/* start and stop, to discard anything buffered by earlier tests */
+	ASSERT_EQ(0, omrthread_jlm_contention_sampling_start(1, 16));
+	omrthread_jlm_contention_sampling_stop();
+	contentionProfilerAggregate(profiler);
+	contentionProfilerClear(profiler);
+
+	contend(profiler, &aggregated);
+	EXPECT_EQ((uintptr_t)0, aggregated);
+	contentionProfilerFree(profiler);
+}
+
+TEST(ContentionProfilerTest, Aggregator)
+{
+	OMRContentionProfiler *profiler = contentionProfilerNew(omrTestEnv->getPortLibrary(), 4);
+	OMRContentionSite sites[4];
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+	BOOLEAN found = FALSE;
+
+	ASSERT_TRUE(NULL != profiler);
+	ASSERT_NE(0, contentionProfilerStartAggregator(profiler, 0));
+	ASSERT_EQ(0, omrthread_jlm_contention_sampling_start(1, 16));
+	ASSERT_EQ(0, contentionProfilerStartAggregator(profiler, 10));
+	ASSERT_NE(0, contentionProfilerStartAggregator(profiler, 10));
+
+	contend(profiler, NULL);
+	omrthread_jlm_contention_sampling_stop();
+	contentionProfilerStopAggregator(profiler);
+	EXPECT_EQ((uintptr_t)CONTENTION_PROFILER_AGGREGATOR_STOPPED, profiler->aggregatorState);
+
+	/* the aggregator can contend on the profiler too, so look for the hot site among the top ones */
+	count = contentionProfilerGetTopSites(profiler, sites, 4);
+	for (i = 0; i < count; i++) {
+		if (0 == strcmp("contention test hot", sites[i].monitorName)) {
+			found = TRUE;
+			EXPECT_LT((uint64_t)0, sites[i].waitTime);
+		}
+	}
+	EXPECT_TRUE(found);
+
+	/* free stops a running aggregator */
+	ASSERT_EQ(0, contentionProfilerStartAggregator(profiler, 10));
+	contentionProfilerFree(profiler);
+}
+
+#endif /* OMR_THR_JLM && OMR_THR_JLM_HOLD_TIMES */
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "thread_api.h"
+
+#define PARK_DELAY_MILLIS 50
+
+typedef struct ParkInfo {
+	omrthread_t parker;
+	BOOLEAN interrupt;
+	volatile uintptr_t finished;
+} ParkInfo;
+
+/* Give the parker time to park, then unpark or interrupt it. */
+static int J9THREAD_PROC
+wakeParker(void *entryArg)
+{
+	ParkInfo *info = (ParkInfo *)entryArg;
+
+	omrthread_sleep(PARK_DELAY_MILLIS);
+	if (info->interrupt) {
+		omrthread_interrupt(info->parker);
+	} else {
+		omrthread_unpark(info->parker);
+	}
+	info->finished = 1;
+	return 0;
+}
+
+static intptr_t
+parkUntilWoken(BOOLEAN interrupt)
+{
+	ParkInfo info = {omrthread_self(), interrupt, 0};
+	omrthread_t thread = NULL;
+	intptr_t rc = 0;
+
+	if (J9THREAD_SUCCESS != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, wakeParker, &info)) {
+		return -1;
+	}
+	rc = omrthread_park(0, 0);
+	while (0 == info.finished) {
+		omrthread_sleep(1);
+	}
+	return rc;
+}
+
+TEST(ParkTest, UnparkBeforePark)
+{
+	omrthread_unpark(omrthread_self());
+	omrthread_unpark(omrthread_self());
+	/* unparks are not counted */
+	EXPECT_EQ(0, omrthread_park(0, 0));
+	EXPECT_EQ(J9THREAD_TIMED_OUT, omrthread_park(1, 0));
+}
+
+TEST(ParkTest, TimedOut)
+{
+	EXPECT_EQ(J9THREAD_TIMED_OUT, omrthread_park(PARK_DELAY_MILLIS, 0));
+	EXPECT_EQ(J9THREAD_TIMED_OUT, omrthread_park(0, 1000));
+}
+
+TEST(ParkTest, Unparked)
+{
+	EXPECT_EQ(0, parkUntilWoken(FALSE));
+}
+
+TEST(ParkTest, Interrupted)
+{
+	EXPECT_EQ(J9THREAD_INTERRUPTED, parkUntilWoken(TRUE));
+	omrthread_clear_interrupted();
+}
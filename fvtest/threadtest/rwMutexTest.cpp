@@ -25,6 +25,7 @@
 #include "omrTest.h"
 #include "testHelper.hpp"
 #include "thread_api.h"
+#include "omrutilbase.h"
 
 #define MILLI_TIMEOUT	1000
 #define NANO_TIMEOUT	0
@@ -91,10 +92,11 @@ runRequest(SupportThreadInfo *info)
  * @param functionsToRun an array of functions pointers. Each function will be run one in sequence synchronized
  *        using the monitor within the SupporThreadInfo
  * @param numberFunctions the number of functions in the functionsToRun array
+ * @param flags the flags to create the rwmutex with
  * @returns a pointer to the newly created SupporThreadInfo
  */
 SupportThreadInfo *
-createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions, uintptr_t flags)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
 	SupportThreadInfo *info = (SupportThreadInfo *)omrmem_allocate_memory(sizeof(SupportThreadInfo), OMRMEM_CATEGORY_THREADS);
@@ -103,7 +105,7 @@ createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t number
 	info->functionsToRun = functionsToRun;
 	info->numberFunctions = numberFunctions;
 	info->done = FALSE;
-	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, 0, "supportThreadInfo rwmutex");
+	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, flags, "supportThreadInfo rwmutex");
 	omrthread_monitor_init_with_name(&info->synchronization, 0, "supportThreadAInfo monitor");
 	return info;
 }
@@ -258,14 +260,28 @@ J9THREAD_PROC nop(SupportThreadInfo *info)
 	return 0;
 }
 
+/* every existing behaviour must hold for both the monitor based and the reader biased implementation */
+class RWMutexTest: public ::testing::TestWithParam<uintptr_t>
+{
+};
+
+INSTANTIATE_TEST_CASE_P(RWMutex, RWMutexTest, ::testing::Values((uintptr_t)0, (uintptr_t)J9THREAD_RWMUTEX_READER_BIASED));
+
+class RWMutexWriterPreferenceTest: public ::testing::TestWithParam<uintptr_t>
+{
+};
+
+INSTANTIATE_TEST_CASE_P(RWMutex, RWMutexWriterPreferenceTest,
+	::testing::Values((uintptr_t)J9THREAD_RWMUTEX_WRITER_PREFERENCE, (uintptr_t)(J9THREAD_RWMUTEX_READER_BIASED | J9THREAD_RWMUTEX_WRITER_PREFERENCE)));
+
 /**
  * validate that we can create a reate/write mutex successfully
  */
-TEST(RWMutex, CreateTest)
+TEST_P(RWMutexTest, CreateTest)
 {
 	intptr_t result;
 	omrthread_rwmutex_t handle;
-	uintptr_t flags = 0;
+	uintptr_t flags = GetParam();
 	const char *mutexName = "test_mutex";
 
 	result = omrthread_rwmutex_init(&handle, flags, mutexName);
@@ -279,11 +295,11 @@ TEST(RWMutex, CreateTest)
 /**
  * Validate that we can enter/exit a RWMutex for read
  */
-TEST(RWMutex, RWReadEnterExitTest)
+TEST_P(RWMutexTest, RWReadEnterExitTest)
 {
 	intptr_t result;
 	omrthread_rwmutex_t handle;
-	uintptr_t flags = 0;
+	uintptr_t flags = GetParam();
 	const char *mutexName = "test_mutex";
 
 	result = omrthread_rwmutex_init(&handle, flags, mutexName);
@@ -303,11 +319,11 @@ TEST(RWMutex, RWReadEnterExitTest)
 /**
  * Validate that we can enter/exit a RWMutex for write
  */
-TEST(RWMutex, RWWriteEnterExitTest)
+TEST_P(RWMutexTest, RWWriteEnterExitTest)
 {
 	intptr_t result;
 	omrthread_rwmutex_t handle;
-	uintptr_t flags = 0;
+	uintptr_t flags = GetParam();
 	const char *mutexName = "test_mutex";
 
 	result = omrthread_rwmutex_init(&handle, flags, mutexName);
@@ -333,11 +349,11 @@ TEST(RWMutex, RWWriteEnterExitTest)
 /**
  * Validate that is_writelocked return true in writing state
  */
-TEST(RWMutex, IsWriteLockedTest)
+TEST_P(RWMutexTest, IsWriteLockedTest)
 {
 	intptr_t result;
 	omrthread_rwmutex_t handle;
-	uintptr_t flags = 0;
+	uintptr_t flags = GetParam();
 	BOOLEAN ret;
 	const char *mutexName = "test_mutex";
 
@@ -370,13 +386,13 @@ TEST(RWMutex, IsWriteLockedTest)
 	ASSERT_TRUE(0 == result);
 }
 
-TEST(RWMutex, MultipleReadersTest)
+TEST_P(RWMutexTest, MultipleReadersTest)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
 	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
 	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
-	info = createSupportThreadInfo(functionsToRun, 2);
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
 	startConcurrentThread(info);
 
 	/* now the concurrent thread should have acquired the rwmutex
@@ -401,13 +417,13 @@ TEST(RWMutex, MultipleReadersTest)
  * readers are excludes while another thread holds the rwmutex for write
  * once writer exits, reader can enter
  */
-TEST(RWMutex, ReadersExcludedTest)
+TEST_P(RWMutexTest, ReadersExcludedTest)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
 	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
 	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
-	info = createSupportThreadInfo(functionsToRun, 2);
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
 
 	/* first enter the mutex for write */
 	ASSERT_TRUE(0 == info->readCounter);
@@ -438,13 +454,13 @@ TEST(RWMutex, ReadersExcludedTest)
  * readers are excludes while another thread holds the rwmutex for write entered using try_enter
  * once writer exits, reader can enter
  */
-TEST(RWMutex, ReadersExcludedTesttryenter)
+TEST_P(RWMutexTest, ReadersExcludedTesttryenter)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
 	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
 	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
-	info = createSupportThreadInfo(functionsToRun, 2);
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
 
 	/* first enter the mutex for write */
 	ASSERT_TRUE(0 == info->readCounter);
@@ -475,13 +491,13 @@ TEST(RWMutex, ReadersExcludedTesttryenter)
  * writer is excluded while another thread holds the rwmutex for read
  * once reader exits writer can enter
  */
-TEST(RWMutex, WritersExcludedTest)
+TEST_P(RWMutexTest, WritersExcludedTest)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
 	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
 	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
-	info = createSupportThreadInfo(functionsToRun, 2);
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
 
 	/* first enter the mutex for read */
 	ASSERT_TRUE(0 == info->writeCounter);
@@ -512,13 +528,13 @@ TEST(RWMutex, WritersExcludedTest)
  * writer is excluded while another thread holds the rwmutex for write
  * once writer exits second writer can enter
  */
-TEST(RWMutex, WriterExcludesWriterTest)
+TEST_P(RWMutexTest, WriterExcludesWriterTest)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
 	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
 	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
-	info = createSupportThreadInfo(functionsToRun, 2);
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
 
 	/* first enter the mutex for write */
 	ASSERT_TRUE(0 == info->writeCounter);
@@ -548,13 +564,13 @@ TEST(RWMutex, WriterExcludesWriterTest)
  * writer is excluded while another thread holds the rwmutex for write
  * once writer exits second writer can enter
  */
-TEST(RWMutex, WriterExcludesWriterTesttryenter)
+TEST_P(RWMutexTest, WriterExcludesWriterTesttryenter)
 {
 	SupportThreadInfo *info;
 	omrthread_entrypoint_t functionsToRun[2];
 	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
 	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
-	info = createSupportThreadInfo(functionsToRun, 2);
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
 
 	/* first enter the mutex for write */
 	ASSERT_TRUE(0 == info->writeCounter);
@@ -583,7 +599,7 @@ TEST(RWMutex, WriterExcludesWriterTesttryenter)
  * reader can enter rwmutex even if write is pending (waiting on another reader)
  * 2nd reader to enter rwmutex continues to block write after first thread exits
  */
-TEST(RWMutex, SecondReaderExcludesWrite)
+TEST_P(RWMutexTest, SecondReaderExcludesWrite)
 {
 	omrthread_rwmutex_t saveHandle;
 	SupportThreadInfo *info;
@@ -597,8 +613,8 @@ TEST(RWMutex, SecondReaderExcludesWrite)
 	functionsToRunReader[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
 	functionsToRunReader[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
 
-	info = createSupportThreadInfo(functionsToRun, 2);
-	infoReader = createSupportThreadInfo(functionsToRunReader, 2);
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
+	infoReader = createSupportThreadInfo(functionsToRunReader, 2, GetParam());
 
 	/* set the two SupporThreadInfo structures so that they use the same rwmutex */
 	saveHandle = infoReader->handle;
@@ -653,7 +669,7 @@ TEST(RWMutex, SecondReaderExcludesWrite)
  * readers are excludes while another thread holds the rwmutex for write
  * once writer exits, all readers wake up and can enter
  */
-TEST(RWMutex, AllReadersProceedTest)
+TEST_P(RWMutexTest, AllReadersProceedTest)
 {
 	omrthread_rwmutex_t saveHandle;
 	SupportThreadInfo *infoReader1;
@@ -667,8 +683,8 @@ TEST(RWMutex, AllReadersProceedTest)
 	functionsToRunReader2[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
 	functionsToRunReader2[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
 
-	infoReader1 = createSupportThreadInfo(functionsToRunReader1, 2);
-	infoReader2 = createSupportThreadInfo(functionsToRunReader2, 2);
+	infoReader1 = createSupportThreadInfo(functionsToRunReader1, 2, GetParam());
+	infoReader2 = createSupportThreadInfo(functionsToRunReader2, 2, GetParam());
 
 	/* set the two SupporThreadInfo structures so that they use the same rwmutex */
 	saveHandle = infoReader2->handle;
@@ -730,7 +746,7 @@ TEST(RWMutex, AllReadersProceedTest)
  * a thread waiting to enter a rwmutex wakes up and enter when the last exit for
  *   a series of recusive enters is called
  */
-TEST(RWMutex, RecursiveReadTest)
+TEST_P(RWMutexTest, RecursiveReadTest)
 {
 	int i;
 	omrthread_rwmutex_t saveHandle;
@@ -750,8 +766,8 @@ TEST(RWMutex, RecursiveReadTest)
 	functionsToRunWriter1[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
 	functionsToRunWriter1[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
 
-	infoReader1 = createSupportThreadInfo(functionsToRunReader1, 7);
-	infoWriter1 = createSupportThreadInfo(functionsToRunWriter1, 2);
+	infoReader1 = createSupportThreadInfo(functionsToRunReader1, 7, GetParam());
+	infoWriter1 = createSupportThreadInfo(functionsToRunWriter1, 2, GetParam());
 
 	/* set the two SupporThreadInfo structures so that they use the same rwmutex */
 	saveHandle = infoWriter1->handle;
@@ -825,7 +841,7 @@ TEST(RWMutex, RecursiveReadTest)
  * 		exits to enters have been called
  * threads waiting to enter for read wake up and enter when the last exit for read occurs
  */
-TEST(RWMutex, RecursiveWriteTest)
+TEST_P(RWMutexTest, RecursiveWriteTest)
 {
 	int i;
 	omrthread_rwmutex_t saveHandle;
@@ -845,8 +861,8 @@ TEST(RWMutex, RecursiveWriteTest)
 	functionsToRunReader[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
 	functionsToRunReader[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
 
-	infoWriter = createSupportThreadInfo(functionsToRunWriter, 7);
-	infoReader = createSupportThreadInfo(functionsToRunReader, 2);
+	infoWriter = createSupportThreadInfo(functionsToRunWriter, 7, GetParam());
+	infoReader = createSupportThreadInfo(functionsToRunReader, 2, GetParam());
 
 	/* set the two SupporThreadInfo structures so that they use the same rwmutex */
 	saveHandle = infoReader->handle;
@@ -913,7 +929,7 @@ TEST(RWMutex, RecursiveWriteTest)
  * threads waiting to enter for read wake up and enter when the last exit for read occurs
  * 		when try_enter was used for one of the enters
  */
-TEST(RWMutex, RecursiveWriteTesttryenter)
+TEST_P(RWMutexTest, RecursiveWriteTesttryenter)
 {
 	int i;
 	omrthread_rwmutex_t saveHandle;
@@ -933,8 +949,8 @@ TEST(RWMutex, RecursiveWriteTesttryenter)
 	functionsToRunReader[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
 	functionsToRunReader[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
 
-	infoWriter = createSupportThreadInfo(functionsToRunWriter, 7);
-	infoReader = createSupportThreadInfo(functionsToRunReader, 2);
+	infoWriter = createSupportThreadInfo(functionsToRunWriter, 7, GetParam());
+	infoReader = createSupportThreadInfo(functionsToRunReader, 2, GetParam());
 
 	/* set the two SupporThreadInfo structures so that they use the same rwmutex */
 	saveHandle = infoReader->handle;
@@ -996,7 +1012,7 @@ TEST(RWMutex, RecursiveWriteTesttryenter)
  * This test validates that
  * a thread can enter a rwmutex for read after it already has it for write
  */
-TEST(RWMutex, ReadAfterWriteTest)
+TEST_P(RWMutexTest, ReadAfterWriteTest)
 {
 	omrthread_rwmutex_t saveHandle;
 	SupportThreadInfo *infoWriter;
@@ -1012,8 +1028,8 @@ TEST(RWMutex, ReadAfterWriteTest)
 	functionsToRunReader[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
 	functionsToRunReader[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
 
-	infoWriter = createSupportThreadInfo(functionsToRunWriter, 4);
-	infoReader = createSupportThreadInfo(functionsToRunReader, 2);
+	infoWriter = createSupportThreadInfo(functionsToRunWriter, 4, GetParam());
+	infoReader = createSupportThreadInfo(functionsToRunReader, 2, GetParam());
 
 	/* set the two SupporThreadInfo structures so that they use the same rwmutex */
 	saveHandle = infoReader->handle;
@@ -1083,7 +1099,7 @@ TEST(RWMutex, ReadAfterWriteTest)
  * writer is excluded while another thread holds the rwmutex for read but
  * does not block if try_enter_write was used instead of enter_write
  */
-TEST(RWMutex, WritersExcludedNonBlockTest)
+TEST_P(RWMutexTest, WritersExcludedNonBlockTest)
 {
 	intptr_t result = 0;
 	SupportThreadInfo *info;
@@ -1091,7 +1107,7 @@ TEST(RWMutex, WritersExcludedNonBlockTest)
 	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
 	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
 
-	info = createSupportThreadInfo(functionsToRun, 2);
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
 
 	/* start the concurrent thread that will try to enter for read */
 	startConcurrentThread(info);
@@ -1113,7 +1129,7 @@ TEST(RWMutex, WritersExcludedNonBlockTest)
  * writer is excluded while another thread holds the rwmutex for write but
  * does not block if try_enter_write was used instead of enter_write
  */
-TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
+TEST_P(RWMutexTest, WritersExcludedByWriterNonBlockTest)
 {
 	intptr_t result = 0;
 	SupportThreadInfo *info;
@@ -1121,7 +1137,7 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
 	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
 
-	info = createSupportThreadInfo(functionsToRun, 2);
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
 
 	/* start the concurrent thread that will try to enter for write */
 	startConcurrentThread(info);
@@ -1136,3 +1152,172 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	triggerNextStepDone(info);
 	freeSupportThreadInfo(info);
 }
+
+/**
+ * validates the following
+ *
+ * with writer preference, a reader waits for a writer which is waiting for another reader
+ * the writer enters before the waiting reader once the first reader exits
+ * the waiting reader enters once the writer exits
+ */
+TEST_P(RWMutexWriterPreferenceTest, PendingWriterExcludesReadersTest)
+{
+	omrthread_rwmutex_t saveHandle;
+	SupportThreadInfo *info;
+	SupportThreadInfo *infoReader;
+	omrthread_entrypoint_t functionsToRun[2];
+	omrthread_entrypoint_t functionsToRunReader[2];
+
+	/* set up the steps for the 2 concurrent threads */
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
+	functionsToRunReader[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRunReader[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+
+	info = createSupportThreadInfo(functionsToRun, 2, GetParam());
+	infoReader = createSupportThreadInfo(functionsToRunReader, 2, GetParam());
+
+	/* set the two SupporThreadInfo structures so that they use the same rwmutex */
+	saveHandle = infoReader->handle;
+	infoReader->handle = info->handle;
+
+	/* first enter the mutex for read */
+	omrthread_rwmutex_enter_read(info->handle);
+
+	/* start the concurrent thread that will try to enter for write and check that it is blocked */
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	/* start the concurrent thread that will try to enter for read and check that it is blocked too */
+	startConcurrentThread(infoReader);
+	ASSERT_TRUE(0 == infoReader->readCounter);
+
+	/* now release the rwmutex and validate that the writer enters ahead of the reader */
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_read(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->writeCounter);
+	ASSERT_TRUE(0 == infoReader->readCounter);
+
+	/* now let the writer exit and validate that the reader enters */
+	omrthread_monitor_enter(infoReader->synchronization);
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+	omrthread_monitor_wait_interruptable(infoReader->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(infoReader->synchronization);
+	ASSERT_TRUE(1 == infoReader->readCounter);
+
+	/* ok now let the reader exit */
+	triggerNextStepDone(infoReader);
+	ASSERT_TRUE(0 == infoReader->readCounter);
+
+	/* now let the threads clean up. First fix up handle in infoReader so that we
+	 * can clean up properly
+	 */
+	infoReader->handle = saveHandle;
+	freeSupportThreadInfo(info);
+	freeSupportThreadInfo(infoReader);
+}
+
+#define STRESS_THREADS 8
+#define STRESS_ITERATIONS 20000
+#define STRESS_WRITE_INTERVAL 64
+
+/* structure shared by the threads of ExclusionStressTest */
+typedef struct StressInfo {
+	omrthread_rwmutex_t handle;
+	omrthread_monitor_t synchronization;
+	volatile uintptr_t readers;
+	volatile uintptr_t writers;
+	volatile uintptr_t writes;
+	volatile uintptr_t violations;
+	uintptr_t threadsRunning;
+} StressInfo;
+
+/**
+ * Enter the rwmutex for read most of the time and for write every STRESS_WRITE_INTERVAL
+ * iterations, counting any time a reader sees a writer or a writer sees anyone else.
+ */
+static intptr_t J9THREAD_PROC
+stressRWMutex(StressInfo *info)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < STRESS_ITERATIONS; i++) {
+		if (0 == (i % STRESS_WRITE_INTERVAL)) {
+			omrthread_rwmutex_enter_write(info->handle);
+			info->writers += 1;
+			if ((1 != info->writers) || (0 != info->readers)) {
+				info->violations += 1;
+			}
+			info->writes += 1;
+			info->writers -= 1;
+			omrthread_rwmutex_exit_write(info->handle);
+		} else {
+			omrthread_rwmutex_enter_read(info->handle);
+			addAtomic(&info->readers, 1);
+			if (0 != info->writers) {
+				addAtomic(&info->violations, 1);
+			}
+			subtractAtomic(&info->readers, 1);
+			omrthread_rwmutex_exit_read(info->handle);
+		}
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	info->threadsRunning -= 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	omrthread_monitor_exit(info->synchronization);
+
+	return 0;
+}
+
+/**
+ * Run STRESS_THREADS threads through stressRWMutex on a rwmutex created with flags,
+ * and check that readers and writers excluded each other.
+ */
+static void
+exclusionStress(uintptr_t flags)
+{
+	StressInfo info;
+	uintptr_t i = 0;
+
+	info.readers = 0;
+	info.writers = 0;
+	info.writes = 0;
+	info.violations = 0;
+	info.threadsRunning = STRESS_THREADS;
+	ASSERT_TRUE(0 == omrthread_rwmutex_init(&info.handle, flags, "stress rwmutex"));
+	ASSERT_TRUE(0 == omrthread_monitor_init_with_name(&info.synchronization, 0, "stress monitor"));
+
+	for (i = 0; i < STRESS_THREADS; i++) {
+		omrthread_t newThread = NULL;
+		ASSERT_TRUE(0 == omrthread_create_ex(&newThread, J9THREAD_ATTR_DEFAULT, 0, (omrthread_entrypoint_t)stressRWMutex, (void *)&info));
+	}
+
+	omrthread_monitor_enter(info.synchronization);
+	while (0 != info.threadsRunning) {
+		omrthread_monitor_wait(info.synchronization);
+	}
+	omrthread_monitor_exit(info.synchronization);
+
+	ASSERT_TRUE(0 == info.violations);
+	ASSERT_TRUE(((STRESS_ITERATIONS + STRESS_WRITE_INTERVAL - 1) / STRESS_WRITE_INTERVAL) * STRESS_THREADS == info.writes);
+
+	omrthread_monitor_destroy(info.synchronization);
+	ASSERT_TRUE(0 == omrthread_rwmutex_destroy(info.handle));
+}
+
+/**
+ * validates that readers and writers exclude each other while many threads use the rwmutex at once
+ */
+TEST_P(RWMutexTest, ExclusionStressTest)
+{
+	exclusionStress(GetParam());
+}
+
+TEST_P(RWMutexWriterPreferenceTest, ExclusionStressTest)
+{
+	exclusionStress(GetParam());
+}
@@ -0,0 +1,241 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrTest.h"
+#include "thread_api.h"
+#include "thrtypes.h"
+#include "common/threaddef.h"
+
+#if defined(OMR_THR_JLM) && defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING)
+
+#include <time.h>
+
+/* system loads (runnable threads as a percentage of the online CPUs) fed to the tuner */
+#define IDLE_LOAD 0
+#define BUSY_LOAD ADAPT_SPIN_TUNE_RESTORE_LOAD_PERCENT
+#define OVERLOAD ADAPT_SPIN_TUNE_MAX_LOAD_PERCENT
+
+/**
+ * Fake the spin statistics of a monitor and the system load, and let the next exit of
+ * the monitor run the tuner. The monitor must have been created with spin tuning enabled.
+ *
+ * The tuner caches the load for the current second, so the cache is pre-set for the current
+ * second. If the second changes before the tuner runs, it may have read the real load, in
+ * which case the tuning decision is undone and the call is repeated.
+ */
+static void
+tuneWith(omrthread_monitor_t monitor, uintptr_t attempts, uintptr_t successes, uintptr_t loadPercent)
+{
+	omrthread_library_t lib = omrthread_self()->library;
+	J9ThreadMonitorTracing *tracing = monitor->tracing;
+	ASSERT_TRUE(NULL != tracing);
+
+	const uintptr_t spinCount2 = monitor->spinCount2;
+	const uintptr_t spinCount3 = monitor->spinCount3;
+	const J9ThreadMonitorTracing saved = *tracing;
+
+	for (;;) {
+		uintptr_t now = (uintptr_t)time(NULL);
+		lib->adaptSpinLoadPercent = loadPercent;
+		lib->adaptSpinLoadTime = now;
+
+		tracing->spin_attempt_count += attempts;
+		tracing->spin_success_count += successes;
+		monitor->flags &= ~J9THREAD_MONITOR_STOP_SAMPLING;
+		monitor->sampleCounter = 0;
+
+		omrthread_monitor_enter(monitor);
+		omrthread_monitor_exit(monitor);
+
+		if (now == (uintptr_t)time(NULL)) {
+			break;
+		}
+		monitor->spinCount2 = spinCount2;
+		monitor->spinCount3 = spinCount3;
+		*tracing = saved;
+	}
+}
+
+class SpinTuneTest : public ::testing::Test
+{
+protected:
+	uintptr_t *_enable;
+	uintptr_t _adaptSpinHoldtime;
+	omrthread_library_t _lib;
+	omrthread_monitor_t _monitor;
+
+	virtual void
+	SetUp()
+	{
+		_enable = omrthread_global((char *)"adaptSpinTuneEnable");
+		ASSERT_TRUE(NULL != _enable);
+		*_enable = 1;
+		ASSERT_EQ(0, jlm_adaptive_spin_init());
+
+		/* growing spinning also depends on the average hold time: take it out of the decisions */
+		_lib = omrthread_self()->library;
+		_adaptSpinHoldtime = _lib->adaptSpinHoldtime;
+		_lib->adaptSpinHoldtime = 0;
+
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&_monitor, 0, "spin tune test"));
+		ASSERT_EQ(_lib->defaultMonitorSpinCount2, _monitor->spinCount2);
+		ASSERT_EQ(_lib->defaultMonitorSpinCount3, _monitor->spinCount3);
+	}
+
+	virtual void
+	TearDown()
+	{
+		if (NULL != _monitor) {
+			omrthread_monitor_destroy(_monitor);
+		}
+		_lib->adaptSpinHoldtime = _adaptSpinHoldtime;
+		_lib->adaptSpinLoadTime = 0;
+		*_enable = 0;
+		omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_JLM_SPIN_TUNING_ENABLED);
+	}
+
+	/**
+	 * Cut spinCount2 and spinCount3 back to 1 by reporting spins that never succeed.
+	 */
+	void
+	cutBack()
+	{
+		for (uintptr_t i = 0; i < 64; i++) {
+			tuneWith(_monitor, 100, 0, IDLE_LOAD);
+		}
+		ASSERT_EQ((uintptr_t)1, _monitor->spinCount2);
+		ASSERT_EQ((uintptr_t)1, _monitor->spinCount3);
+	}
+
+public:
+	SpinTuneTest()
+		: ::testing::Test()
+		, _enable(NULL)
+		, _adaptSpinHoldtime(0)
+		, _lib(NULL)
+		, _monitor(NULL)
+	{
+	}
+};
+
+TEST_F(SpinTuneTest, Tune)
+{
+	uintptr_t spinCount1 = _monitor->spinCount1;
+	uintptr_t spinCount2 = _monitor->spinCount2;
+	uintptr_t spinCount3 = _monitor->spinCount3;
+
+	/* too few spinning acquires to decide anything */
+	tuneWith(_monitor, ADAPT_SPIN_TUNE_MIN_ATTEMPTS - 1, 0, IDLE_LOAD);
+	EXPECT_EQ(spinCount2, _monitor->spinCount2);
+	EXPECT_EQ(spinCount3, _monitor->spinCount3);
+	EXPECT_EQ((uintptr_t)0, _monitor->tracing->spin_tune_count);
+
+	/* spinning never succeeds: spinCount2 is cut back first */
+	tuneWith(_monitor, 100, 0, IDLE_LOAD);
+	EXPECT_EQ(OMR_MAX(spinCount2 / 2, (uintptr_t)1), _monitor->spinCount2);
+	EXPECT_EQ(spinCount3, _monitor->spinCount3);
+	EXPECT_EQ(spinCount1, _monitor->spinCount1);
+	EXPECT_EQ((uintptr_t)1, _monitor->tracing->spin_tune_count);
+	EXPECT_EQ(_monitor->tracing->spin_attempt_count, _monitor->tracing->spin_tune_attempt_count);
+
+	/* then spinCount3, but no count drops below 1 */
+	ASSERT_NO_FATAL_FAILURE(cutBack());
+	EXPECT_EQ(spinCount1, _monitor->spinCount1);
+}
+
+TEST_F(SpinTuneTest, CutBackWhenOverloaded)
+{
+	uintptr_t spinCount2 = _monitor->spinCount2;
+
+	/* every spin succeeds, but there are more runnable threads than CPUs */
+	tuneWith(_monitor, 100, 100, OVERLOAD);
+	EXPECT_EQ(OMR_MAX(spinCount2 / 2, (uintptr_t)1), _monitor->spinCount2);
+	EXPECT_EQ(_lib->defaultMonitorSpinCount3, _monitor->spinCount3);
+}
+
+TEST_F(SpinTuneTest, Grow)
+{
+	const uintptr_t defaultSpinCount2 = _lib->defaultMonitorSpinCount2;
+	const uintptr_t defaultSpinCount3 = _lib->defaultMonitorSpinCount3;
+	const uintptr_t maxSpinCount2 = defaultSpinCount2 * ADAPT_SPIN_TUNE_MAX_SPIN2_FACTOR;
+
+	ASSERT_NO_FATAL_FAILURE(cutBack());
+
+	/* spinning succeeds half of the time: spinCount3 is brought back to its default first... */
+	uintptr_t expected3 = 1;
+	while (expected3 < defaultSpinCount3) {
+		expected3 = OMR_MIN(expected3 * 2, defaultSpinCount3);
+		tuneWith(_monitor, 100, 50, IDLE_LOAD);
+		ASSERT_EQ(expected3, _monitor->spinCount3);
+		ASSERT_EQ((uintptr_t)1, _monitor->spinCount2);
+	}
+
+	/* ...then spinCount2 grows past its default, up to ADAPT_SPIN_TUNE_MAX_SPIN2_FACTOR times it */
+	uintptr_t expected2 = 1;
+	while (expected2 < maxSpinCount2) {
+		expected2 = OMR_MIN(expected2 * 2, maxSpinCount2);
+		tuneWith(_monitor, 100, 50, IDLE_LOAD);
+		ASSERT_EQ(expected2, _monitor->spinCount2);
+		ASSERT_EQ(defaultSpinCount3, _monitor->spinCount3);
+	}
+
+	/* and no further */
+	uintptr_t tuneCount = _monitor->tracing->spin_tune_count;
+	tuneWith(_monitor, 100, 50, IDLE_LOAD);
+	EXPECT_EQ(maxSpinCount2, _monitor->spinCount2);
+	EXPECT_EQ(defaultSpinCount3, _monitor->spinCount3);
+	EXPECT_EQ(tuneCount, _monitor->tracing->spin_tune_count);
+}
+
+TEST_F(SpinTuneTest, RestoreOnHighSuccess)
+{
+	const uintptr_t defaultSpinCount2 = _lib->defaultMonitorSpinCount2;
+	const uintptr_t defaultSpinCount3 = _lib->defaultMonitorSpinCount3;
+
+	ASSERT_NO_FATAL_FAILURE(cutBack());
+
+	/* nearly every spin succeeds, but the system is too busy to restore spinning */
+	uintptr_t tuneCount = _monitor->tracing->spin_tune_count;
+	tuneWith(_monitor, 100, 100, BUSY_LOAD);
+	EXPECT_EQ((uintptr_t)1, _monitor->spinCount2);
+	EXPECT_EQ((uintptr_t)1, _monitor->spinCount3);
+	EXPECT_EQ(tuneCount, _monitor->tracing->spin_tune_count);
+
+	/* on a lightly loaded system both counts are restored together, towards but not past their defaults */
+	uintptr_t expected2 = 1;
+	uintptr_t expected3 = 1;
+	while ((expected2 < defaultSpinCount2) || (expected3 < defaultSpinCount3)) {
+		expected2 = OMR_MIN(expected2 * 2, defaultSpinCount2);
+		expected3 = OMR_MIN(expected3 * 2, defaultSpinCount3);
+		tuneWith(_monitor, 100, 100, IDLE_LOAD);
+		ASSERT_EQ(expected2, _monitor->spinCount2);
+		ASSERT_EQ(expected3, _monitor->spinCount3);
+	}
+
+	tuneCount = _monitor->tracing->spin_tune_count;
+	tuneWith(_monitor, 100, 100, IDLE_LOAD);
+	EXPECT_EQ(defaultSpinCount2, _monitor->spinCount2);
+	EXPECT_EQ(defaultSpinCount3, _monitor->spinCount3);
+	EXPECT_EQ(tuneCount, _monitor->tracing->spin_tune_count);
+}
+
+#endif /* OMR_THR_JLM && OMR_THR_ADAPTIVE_SPIN && OMR_THR_THREE_TIER_LOCKING */
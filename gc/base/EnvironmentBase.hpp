@@ -69,7 +69,8 @@ typedef enum {
 	WRITE_BARRIER_THREAD,
 	CON_MARK_HELPER_THREAD,
 	GC_SLAVE_THREAD,
-	GC_MASTER_THREAD
+	GC_MASTER_THREAD,
+	CON_SWEEP_HELPER_THREAD
 } ThreadType;
 
 /**
@@ -138,6 +139,8 @@ public:
 	bool _failAllocOnExcessiveGC;
 
 	MM_Task *_currentTask;
+	uintptr_t _stealVictimSeed; /**< State of the pseudo-random sequence used to select work-stealing victims (0 until first use) */
+	uintptr_t _gcNumaNodeIndex; /**< Index (starting at 1) of the NUMA affinity leader this GC thread is bound to, or 0 if the thread is not bound to a node */
 	
 	MM_WorkPacketStats _workPacketStats;
 	MM_WorkPacketStats _workPacketStatsRSScan;   /**< work packet Stats specifically for RS Scan Phase of Concurrent STW GC */
@@ -627,6 +630,8 @@ public:
 		,_isInNoGCAllocationCall(false)
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
+		,_stealVictimSeed(0)
+		,_gcNumaNodeIndex(0)
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
@@ -675,6 +680,8 @@ public:
 		,_isInNoGCAllocationCall(false)
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
+		,_stealVictimSeed(0)
+		,_gcNumaNodeIndex(0)
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
@@ -240,6 +240,7 @@ public:
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	/* Temporary move from the leaf implementation */
 	bool concurrentSweep;
+	uintptr_t concurrentSweepBackground; /**< number of background threads sweeping the heap between global collections when concurrentSweep is enabled (0 leaves all sweeping to allocating threads) */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	bool largePageWarnOnError;
@@ -298,6 +299,8 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	bool tlhAdaptiveSizing; /**< if true, each thread's TLH refresh size is chosen after every GC from the bytes that thread allocated since the previous GC */
+	uintptr_t tlhTargetRefreshCount; /**< number of TLH refreshes per thread between GCs that adaptive TLH sizing aims for */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 
@@ -353,6 +356,7 @@ public:
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	uintptr_t markingPrefetchDistance; /**< number of popped objects the marking scheme prefetches ahead of the one being scanned (0 disables the prefetching scan loop) */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 
@@ -398,6 +402,8 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool workStealingEnabled; /**< true if the dispatcher provides per-thread work-stealing deques to parallel tasks */
+	uintptr_t workStealingDequeCapacity; /**< Number of elements held by each GC thread's work-stealing deque (rounded up to a power of 2) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -487,9 +493,11 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool parallelSlidingCompact; /**< use the parallel sliding compactor, driven by a per-block forwarding summary table, instead of the sub area compactor */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
+	bool vectorHeapMapScan; /**< scan the heap map with vector instructions (256/512 bits at a time) when the processor supports them */
 
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 	bool concurrentMark;
@@ -579,6 +587,9 @@ public:
 	uintptr_t managedAllocationContextCount; /**< The number of allocation contexts which will be instantiated and managed by the GlobalAllocationManagerRealtime (currently 2*cpu_count) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	bool segregatedGenerational; /**< if true, the segregated collector runs minor collections of the nursery regions between full collections */
+	uintptr_t segregatedGenerationalMajorFreeRatio; /**< free heap percentage below which a minor segregated collection requests a full collection next */
+	bool lockFreeRegionFreeList; /**< if true, the segregated region pool keeps its single free regions on a lock-free list */
 #endif
 
 /* OMR_GC_REALTIME (in for all -- see 82589) */
@@ -629,6 +640,8 @@ public:
 	};
 	HeapInitializationFailureReason heapInitializationFailureReason; /**< Error code provided additional information about heap initialization failure */
 	bool scavengerAlignHotFields; /**< True if the scavenger is to check the hot field description for an object in order to better cache align it when tenuring (enabled with the -Xgc:hotAlignment option) */
+	bool scavengerHotFieldCopyDepthFirst; /**< True if the scavenger copies the referents of hot fields (as declared by the object scanner hot fields descriptor) immediately after their parent, co-locating parent and child */
+	uintptr_t scavengerHotFieldCopyMaxDepth; /**< The maximum length of a chain of hot field referents copied depth-first behind a parent object */
 	uintptr_t suballocatorInitialSize; /**< the initial chunk size in bytes for the J9Heap suballocator (enabled with the -Xgc:suballocatorInitialSize option) */
 	uintptr_t suballocatorCommitSize; /**< the commit size in bytes for the J9Heap suballocator (enabled with the -Xgc:suballocatorCommitSize option) */
 
@@ -644,6 +657,7 @@ public:
 	uintptr_t regionSize; /**< The size, in bytes, of a fixed-size table-backed region of the heap (does not apply to AUX regions) */
 	MM_NUMAManager _numaManager; /**< The object which abstracts the details of our NUMA support so that the GCExtensions and the callers don't need to duplicate the support to interpret our intention */
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
+	bool numaAwareGCThreads; /**< if true, GC slave threads are bound round-robin to the NUMA affinity leaders and node-partitioned work lists (such as the scavenger copy-scan cache lists) prefer node-local work */
 
 	bool padToPageSize;
 	
@@ -1211,6 +1225,7 @@ public:
 		, environments(NULL)
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		, concurrentSweep(false)
+		, concurrentSweepBackground(1)
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 		, largePageWarnOnError(false)
 		, largePageFailOnError(false)
@@ -1252,6 +1267,8 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, tlhAdaptiveSizing(false)
+		, tlhTargetRefreshCount(64)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
 		, allocationStats()
@@ -1291,6 +1308,7 @@ public:
 		, cacheListSplit(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingPrefetchDistance(0)
 		, rootScannerStatsEnabled(false)
 		, fvtest_forceOldResize(0)
 		, fvtest_oldResizeCounter(0)
@@ -1323,6 +1341,8 @@ public:
 		, softMx(0) /* softMx only set if specified */
 		, batchClearTLH(0)
 		, gcThreadCountForced(false)
+		, workStealingEnabled(false)
+		, workStealingDequeCapacity(4096)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 		, scavengerTraceHotFields(false)
@@ -1394,8 +1414,10 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, parallelSlidingCompact(false)
 		, payAllocationTax(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
+		, vectorHeapMapScan(true)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 		, concurrentMark(false)
 		, concurrentKickoffEnabled(true)
@@ -1472,11 +1494,12 @@ public:
 		, instrumentableAllocateHookEnabled(false) /* by default the hook J9HOOK_VM_OBJECT_ALLOCATE_INSTRUMENTABLE is disabled */
 		, previousMarkMap(NULL)
 		, globalAllocationManager(NULL)
-#if defined (OMR_GC_REALTIME)
 		, managedAllocationContextCount(0)
-#endif /* OMR_GC_REALTIME */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, segregatedGenerational(false)
+		, segregatedGenerationalMajorFreeRatio(20)
+		, lockFreeRegionFreeList(true)
 #endif
 		, distanceToYieldTimeCheck(0)
 		, traceCostToCheckYield(500) /* weighted sum of marked objects and scanned pointers before we check yield in main tracing loop */
@@ -1510,6 +1533,8 @@ public:
 #endif
 		, heapInitializationFailureReason(HEAP_INITIALIZATION_FAILURE_REASON_NO_ERROR)
 		, scavengerAlignHotFields(true) /* VM Design 1774: hot field alignment is on by default */
+		, scavengerHotFieldCopyDepthFirst(false)
+		, scavengerHotFieldCopyMaxDepth(8)
 #if defined(OMR_GC_COMPRESSED_POINTERS)
 		, suballocatorInitialSize(SUBALLOCATOR_INITIAL_SIZE) /* default for J9Heap suballocator initial size is 200 MB */
 		, suballocatorCommitSize(SUBALLOCATOR_COMMIT_SIZE) /* default for J9Heap suballocator commit size is 50 MB */
@@ -1522,6 +1547,7 @@ public:
 		, regionSize(0)
 		, _numaManager()
 		, numaForced(false)
+		, numaAwareGCThreads(false)
 		, padToPageSize(false)
 		, fvtest_disableExplictMasterThread(false)
 #if defined(OMR_GC_VLHGC)
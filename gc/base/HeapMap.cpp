@@ -28,6 +28,7 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapScan.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
@@ -62,6 +63,7 @@ MM_HeapMap::initialize(MM_EnvironmentBase *env)
 		_heapMapBits = (uintptr_t *)memoryManager->getHeapBase(&_heapMapMemoryHandle);
 		_heapBase = _extensions->heap->getHeapBase();
 		_heapMapBaseDelta = (uintptr_t)_heapBase;
+		MM_HeapMapScan::initialize(env);
 		result = true;
 	}
 	return result;
@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapScan.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -131,6 +132,16 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip the run of empty mark map slots in bulk rather than one slot per iteration */
+				uintptr_t remainingMapSlots = MM_Math::roundToCeiling(J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT, _heapChunkTop - _heapSlotCurrent) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+				uintptr_t *heapMapSlotNonEmpty = MM_HeapMapScan::findNonEmptySlot(_heapMapSlotCurrent + 1, _heapMapSlotCurrent + remainingMapSlots);
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNonEmpty - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNonEmpty;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "HeapMapScan.hpp"
+
+#include "Bits.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+/* Vector implementations are only provided for x86-64 compilers which support per-function target selection */
+#if defined(LINUX) && defined(J9HAMMER) && defined(__GNUC__)
+#define J9MODRON_HEAP_MAP_SCAN_VECTOR
+#include <immintrin.h>
+#endif /* defined(LINUX) && defined(J9HAMMER) && defined(__GNUC__) */
+
+MM_HeapMapScan::ScanFunction MM_HeapMapScan::_findNonEmptySlot = MM_HeapMapScan::findNonEmptySlotScalar;
+MM_HeapMapScan::ScanFunction MM_HeapMapScan::_findEmptySlot = MM_HeapMapScan::findEmptySlotScalar;
+uintptr_t MM_HeapMapScan::_vectorWidth = 0;
+
+uintptr_t *
+MM_HeapMapScan::findNonEmptySlotScalar(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop)
+{
+	while ((heapMapSlotCurrent < heapMapSlotTop) && (0 == *heapMapSlotCurrent)) {
+		heapMapSlotCurrent += 1;
+	}
+	return heapMapSlotCurrent;
+}
+
+uintptr_t *
+MM_HeapMapScan::findEmptySlotScalar(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop)
+{
+	while ((heapMapSlotCurrent < heapMapSlotTop) && (0 != *heapMapSlotCurrent)) {
+		heapMapSlotCurrent += 1;
+	}
+	return heapMapSlotCurrent;
+}
+
+#if defined(J9MODRON_HEAP_MAP_SCAN_VECTOR)
+/**
+ * AVX2 variant of findNonEmptySlot(): tests 512 bits (two 256-bit blocks) per step.
+ */
+__attribute__((target("avx2"))) static uintptr_t *
+findNonEmptySlotAVX2(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop)
+{
+	while ((heapMapSlotCurrent + 8) <= heapMapSlotTop) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)heapMapSlotCurrent);
+		__m256i high = _mm256_loadu_si256((const __m256i *)(heapMapSlotCurrent + 4));
+		__m256i combined = _mm256_or_si256(low, high);
+		if (!_mm256_testz_si256(combined, combined)) {
+			break;
+		}
+		heapMapSlotCurrent += 8;
+	}
+	while ((heapMapSlotCurrent + 4) <= heapMapSlotTop) {
+		__m256i block = _mm256_loadu_si256((const __m256i *)heapMapSlotCurrent);
+		uintptr_t nonEmptyMask = (uintptr_t)(~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(block, _mm256_setzero_si256()))) & 0xF);
+		if (0 != nonEmptyMask) {
+			return heapMapSlotCurrent + MM_Bits::leadingZeroes(nonEmptyMask);
+		}
+		heapMapSlotCurrent += 4;
+	}
+	return MM_HeapMapScan::findNonEmptySlotScalar(heapMapSlotCurrent, heapMapSlotTop);
+}
+
+/**
+ * AVX2 variant of findEmptySlot(): tests 256 bits per step.
+ */
+__attribute__((target("avx2"))) static uintptr_t *
+findEmptySlotAVX2(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop)
+{
+	while ((heapMapSlotCurrent + 4) <= heapMapSlotTop) {
+		__m256i block = _mm256_loadu_si256((const __m256i *)heapMapSlotCurrent);
+		uintptr_t emptyMask = (uintptr_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(block, _mm256_setzero_si256())));
+		if (0 != emptyMask) {
+			return heapMapSlotCurrent + MM_Bits::leadingZeroes(emptyMask);
+		}
+		heapMapSlotCurrent += 4;
+	}
+	return MM_HeapMapScan::findEmptySlotScalar(heapMapSlotCurrent, heapMapSlotTop);
+}
+
+/**
+ * AVX-512 variant of findNonEmptySlot(): tests 512 bits per step.
+ */
+__attribute__((target("avx512f"))) static uintptr_t *
+findNonEmptySlotAVX512(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop)
+{
+	while ((heapMapSlotCurrent + 8) <= heapMapSlotTop) {
+		__m512i block = _mm512_loadu_si512((const void *)heapMapSlotCurrent);
+		uintptr_t nonEmptyMask = (uintptr_t)_mm512_test_epi64_mask(block, block);
+		if (0 != nonEmptyMask) {
+			return heapMapSlotCurrent + MM_Bits::leadingZeroes(nonEmptyMask);
+		}
+		heapMapSlotCurrent += 8;
+	}
+	return MM_HeapMapScan::findNonEmptySlotScalar(heapMapSlotCurrent, heapMapSlotTop);
+}
+
+/**
+ * AVX-512 variant of findEmptySlot(): tests 512 bits per step.
+ */
+__attribute__((target("avx512f"))) static uintptr_t *
+findEmptySlotAVX512(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop)
+{
+	while ((heapMapSlotCurrent + 8) <= heapMapSlotTop) {
+		__m512i block = _mm512_loadu_si512((const void *)heapMapSlotCurrent);
+		uintptr_t emptyMask = (uintptr_t)_mm512_testn_epi64_mask(block, block);
+		if (0 != emptyMask) {
+			return heapMapSlotCurrent + MM_Bits::leadingZeroes(emptyMask);
+		}
+		heapMapSlotCurrent += 8;
+	}
+	return MM_HeapMapScan::findEmptySlotScalar(heapMapSlotCurrent, heapMapSlotTop);
+}
+#endif /* J9MODRON_HEAP_MAP_SCAN_VECTOR */
+
+void
+MM_HeapMapScan::initialize(MM_EnvironmentBase *env)
+{
+	_findNonEmptySlot = findNonEmptySlotScalar;
+	_findEmptySlot = findEmptySlotScalar;
+	_vectorWidth = 0;
+
+#if defined(J9MODRON_HEAP_MAP_SCAN_VECTOR)
+	if (env->getExtensions()->vectorHeapMapScan) {
+		/* the compiler's processor feature checks also verify that the OS preserves the extended register state */
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f")) {
+			_findNonEmptySlot = findNonEmptySlotAVX512;
+			_findEmptySlot = findEmptySlotAVX512;
+			_vectorWidth = 512;
+		} else if (__builtin_cpu_supports("avx2")) {
+			_findNonEmptySlot = findNonEmptySlotAVX2;
+			_findEmptySlot = findEmptySlotAVX2;
+			_vectorWidth = 256;
+		}
+	}
+#endif /* J9MODRON_HEAP_MAP_SCAN_VECTOR */
+}
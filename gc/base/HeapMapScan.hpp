@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCAN_HPP_)
+#define HEAPMAPSCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+class MM_EnvironmentBase;
+
+/**
+ * Bulk scanning of heap map (mark map) slots.
+ * Finds the boundaries of runs of empty and non-empty heap map slots, examining several slots per step
+ * (256 or 512 bits at a time on processors that support it), so that callers can skip over free or
+ * densely marked areas of the heap without looking at every heap map slot individually.
+ * The implementation is selected once, at startup, based on the features of the processor; until then
+ * (and on platforms without vector support) a scalar implementation is used.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapScan
+{
+	/*
+	 * Data members
+	 */
+public:
+	typedef uintptr_t *(*ScanFunction)(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop);
+
+private:
+	static ScanFunction _findNonEmptySlot; /**< Implementation of findNonEmptySlot() selected for this processor */
+	static ScanFunction _findEmptySlot; /**< Implementation of findEmptySlot() selected for this processor */
+	static uintptr_t _vectorWidth; /**< Number of bits examined per step by the selected implementation (0 if scalar) */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Select the scan implementation best suited to the processor.
+	 * Safe to call more than once; the vector implementations are only selected if vectorHeapMapScan is enabled.
+	 * @param env[in] the current thread
+	 */
+	static void initialize(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the first non-empty heap map slot in the range [heapMapSlotCurrent, heapMapSlotTop).
+	 * @param heapMapSlotCurrent[in] first heap map slot to examine
+	 * @param heapMapSlotTop[in] heap map slot at which to stop
+	 * @return the first non-empty heap map slot, or heapMapSlotTop if all slots in the range are empty
+	 */
+	MMINLINE static uintptr_t *
+	findNonEmptySlot(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop)
+	{
+		return _findNonEmptySlot(heapMapSlotCurrent, heapMapSlotTop);
+	}
+
+	/**
+	 * Find the first empty heap map slot in the range [heapMapSlotCurrent, heapMapSlotTop).
+	 * @param heapMapSlotCurrent[in] first heap map slot to examine
+	 * @param heapMapSlotTop[in] heap map slot at which to stop
+	 * @return the first empty heap map slot, or heapMapSlotTop if no slot in the range is empty
+	 */
+	MMINLINE static uintptr_t *
+	findEmptySlot(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop)
+	{
+		return _findEmptySlot(heapMapSlotCurrent, heapMapSlotTop);
+	}
+
+	/**
+	 * @return the number of heap map bits examined per step by the selected implementation, or 0 if it is scalar
+	 */
+	MMINLINE static uintptr_t getVectorWidth() { return _vectorWidth; }
+
+	static uintptr_t *findNonEmptySlotScalar(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop);
+	static uintptr_t *findEmptySlotScalar(uintptr_t *heapMapSlotCurrent, uintptr_t *heapMapSlotTop);
+};
+
+#endif /* HEAPMAPSCAN_HPP_ */
@@ -209,6 +209,10 @@ public:
 	{
 		return _tableRegionCount;
 	}
+	MMINLINE uintptr_t getTableDescriptorSize() const
+	{
+		return _tableDescriptorSize;
+	}
 	uintptr_t getHeapSize()
 	{
 		return (uintptr_t)_highTableEdge - (uintptr_t)_lowTableEdge;
@@ -42,6 +42,15 @@
 #include "WorkPacketsStandard.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(__GNUC__)
+#define MARKING_PREFETCH(addr) __builtin_prefetch((const void *)(addr))
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#define MARKING_PREFETCH(addr) _mm_prefetch((const char *)(addr), _MM_HINT_T0)
+#else
+#define MARKING_PREFETCH(addr)
+#endif
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -316,9 +325,48 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	if (0 != _extensions->markingPrefetchDistance) {
+		completeScanPrefetching(env);
+	} else {
+		do {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+			}
+		} while (_workPackets->handleWorkPacketOverflow(env));
+	}
+}
+
+void
+MM_MarkingScheme::completeScanPrefetching(MM_EnvironmentBase *env)
+{
+	omrobjectptr_t ring[MARKING_PREFETCH_DISTANCE_MAX];
+	uintptr_t distance = OMR_MIN(_extensions->markingPrefetchDistance, MARKING_PREFETCH_DISTANCE_MAX);
+
 	do {
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+		uintptr_t head = 0;
+		uintptr_t count = 0;
+		while (true) {
+			omrobjectptr_t objectPtr = NULL;
+			/* top up the ring from the work stack without blocking, prefetching each object as it is queued */
+			while ((count < distance) && (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.popNoWait(env)))) {
+				MARKING_PREFETCH(objectPtr);
+				ring[(head + count) % distance] = objectPtr;
+				count += 1;
+			}
+			if (0 == count) {
+				/* the ring has drained, so this thread holds no work and may join the other threads waiting for packets */
+				objectPtr = (omrobjectptr_t )env->_workStack.pop(env);
+				if (NULL == objectPtr) {
+					break;
+				}
+				ring[head] = objectPtr;
+				count = 1;
+			}
+			objectPtr = ring[head];
+			head = (head + 1) % distance;
+			count -= 1;
 			env->_markStats._bytesScanned += scanObject(env, objectPtr);
 			env->_markStats._objectsScanned += 1;
 		}
@@ -38,6 +38,11 @@
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
 
+/**
+ * Upper bound on MM_GCExtensionsBase::markingPrefetchDistance, sizing the ring buffer of popped objects in completeScan().
+ */
+#define MARKING_PREFETCH_DISTANCE_MAX 16
+
 /**
  * @todo Provide class documentation
  */
@@ -233,6 +238,13 @@ public:
 	 * until the work stack is empty.
 	 */
 	void completeScan(MM_EnvironmentBase *env);
+
+	/**
+	 * Software-pipelined variant of completeScan(), used when markingPrefetchDistance is non-zero. Popped objects
+	 * are held in a small ring buffer and prefetched when they enter it, so that by the time an object reaches
+	 * the head of the ring and is scanned its header is likely to be in cache.
+	 */
+	void completeScanPrefetching(MM_EnvironmentBase *env);
 	
 	/**
 	 * Public object scanning method. Called from external context, eg concurrent GC. Scans object slots
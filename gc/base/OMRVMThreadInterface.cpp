@@ -44,7 +44,8 @@ GC_OMRVMThreadInterface::flushNonAllocationCaches(MM_EnvironmentBase *env)
 	env->flushNonAllocationCaches();
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
-	if (env->getExtensions()->isStandardGC()) {
+	/* the segregated heap also runs as a standard GC, but its environments are not MM_EnvironmentStandard */
+	if (env->getExtensions()->isStandardGC() && !env->getExtensions()->isSegregatedHeap()) {
 		((MM_EnvironmentStandard *)env)->flushRememberedSet();
 	}
 #endif
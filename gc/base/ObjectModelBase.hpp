@@ -190,6 +190,17 @@ public:
 		return _delegate.getObjectHeaderSizeInBytes(objectPtr);
 	}
 
+	/**
+	 * Returns the hot fields descriptor of an object (bit n set if the nth slot following the header is hot).
+	 * @param objectPtr Pointer to an object
+	 * @return The hot fields descriptor, or 0 if the object has no hot fields
+	 */
+	MMINLINE uintptr_t
+	getHotFieldsDescriptor(omrobjectptr_t objectPtr)
+	{
+		return _delegate.getHotFieldsDescriptor(objectPtr);
+	}
+
 	/**
 	 * Returns the size of an object, in bytes, excluding the header.
 	 * @param objectPtr Pointer to an object
@@ -37,6 +37,7 @@
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "Task.hpp"
+#include "WorkStealingDeque.hpp"
 
 #include "ParallelDispatcher.hpp"
 
@@ -89,6 +90,8 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 		env->setThreadType(GC_SLAVE_THREAD);
 	} else {
 		env->setThreadType(GC_SLAVE_THREAD);
+		/* only dispatcher-owned slaves are bound - see bindThreadToNumaNode() for why the master is not */
+		dispatcher->bindThreadToNumaNode(env);
 		dispatcher->slaveEntryPoint(env);
 	}
 
@@ -177,6 +180,27 @@ MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_slaveThreadMutex);	
 }
 
+void
+MM_ParallelDispatcher::bindThreadToNumaNode(MM_EnvironmentBase *env)
+{
+	env->_gcNumaNodeIndex = 0;
+
+	if (_extensions->numaAwareGCThreads) {
+		MM_NUMAManager *numaManager = &_extensions->_numaManager;
+		uintptr_t affinityLeaderCount = 0;
+		J9MemoryNodeDetail const *affinityLeaders = numaManager->getAffinityLeaders(&affinityLeaderCount);
+
+		if (1 < affinityLeaderCount) {
+			uintptr_t nodeIndex = env->getSlaveID() % affinityLeaderCount;
+			uintptr_t j9NodeNumber = affinityLeaders[nodeIndex].j9NodeNumber;
+			/* simulated NUMA only partitions the work logically - there is no physical node to bind to */
+			if (!numaManager->isPhysicalNUMASupported() || env->setNumaAffinity(&j9NodeNumber, 1)) {
+				env->_gcNumaNodeIndex = nodeIndex + 1;
+			}
+		}
+	}
+}
+
 void
 MM_ParallelDispatcher::masterEntryPoint(MM_EnvironmentBase *env)
 {
@@ -221,6 +245,16 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		_synchronizeMutex = NULL;
 	}
 
+	if(NULL != _workStealingDequeTable) {
+		for(uintptr_t index=0; index < _threadCountMaximum; index++) {
+			if(NULL != _workStealingDequeTable[index]) {
+				_workStealingDequeTable[index]->kill(env);
+			}
+		}
+		forge->free(_workStealingDequeTable);
+		_workStealingDequeTable = NULL;
+	}
+
 	if(_taskTable) {
 		forge->free(_taskTable);
 		_taskTable = NULL;
@@ -270,6 +304,21 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	if(_extensions->workStealingEnabled) {
+		_workStealingDequeTable = (MM_WorkStealingDeque **)forge->allocate(_threadCountMaximum * sizeof(MM_WorkStealingDeque *), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if(!_workStealingDequeTable) {
+			goto error_no_memory;
+		}
+		memset(_workStealingDequeTable, 0, _threadCountMaximum * sizeof(MM_WorkStealingDeque *));
+
+		for(uintptr_t index=0; index < _threadCountMaximum; index++) {
+			_workStealingDequeTable[index] = MM_WorkStealingDeque::newInstance(env, _extensions->workStealingDequeCapacity);
+			if(NULL == _workStealingDequeTable[index]) {
+				goto error_no_memory;
+			}
+		}
+	}
+
 	return true;
 
 error_no_memory:
@@ -468,10 +517,15 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 
 	task->setThreadCount(_activeThreadCount);
 	task->setSynchronizeMutex(_synchronizeMutex);
+	task->setWorkStealingDeques(_workStealingDequeTable);
 	
 	for(uintptr_t index=0; index < _activeThreadCount; index++) {
 		_statusTable[index] = slave_status_reserved;
 		_taskTable[index] = task;
+		if(NULL != _workStealingDequeTable) {
+			/* Elements left behind by a previous task must not leak into this one */
+			_workStealingDequeTable[index]->reset();
+		}
 	}
 	wakeUpThreads(_activeThreadCount);
 	omrthread_monitor_exit(_slaveThreadMutex);
@@ -550,6 +604,13 @@ MM_ParallelDispatcher::reinitAfterFork(MM_EnvironmentBase *env, uintptr_t newThr
 	}
 
 	if (newThreadCount < _threadCountMaximum) {
+		if (NULL != _workStealingDequeTable) {
+			/* Deques of threads beyond the new maximum will never be used again */
+			for (uintptr_t index = newThreadCount; index < _threadCountMaximum; index++) {
+				_workStealingDequeTable[index]->kill(env);
+				_workStealingDequeTable[index] = NULL;
+			}
+		}
 		_threadCountMaximum = newThreadCount;
 	}
 
@@ -39,6 +39,7 @@
 #include "GCExtensionsBase.hpp"
 
 class MM_EnvironmentBase;
+class MM_WorkStealingDeque;
 
 class MM_ParallelDispatcher : public MM_Dispatcher
 {
@@ -69,6 +70,8 @@ protected:
 	/* Task as they are dispatched.  For now, since there is only one task active at any time, a */
 	/* single mutex is sufficient */
 	omrthread_monitor_t _synchronizeMutex;
+
+	MM_WorkStealingDeque **_workStealingDequeTable; /**< Per-thread work-stealing deques handed to each task (NULL if work stealing is disabled) */
 	
 	bool _slaveThreadsReservedForGC;  /**< States whether or not the slave threads are currently taking part in a GC */
 	bool _inShutdown;  /**< Shutdown request is received */
@@ -111,6 +114,17 @@ protected:
 	virtual void recomputeActiveThreadCount(MM_EnvironmentBase *env);
 	
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
+
+	/**
+	 * Bind a GC slave thread to one of the NUMA affinity leaders, distributing slaves round-robin across the nodes.
+	 * Only done when numaAwareGCThreads is set and more than one affinity leader is known.
+	 * The master thread (slaveID 0) is deliberately never bound: it is the thread that requested the collection,
+	 * so changing its affinity would pin an application thread to a node after the collection ends. It runs
+	 * unbound (_gcNumaNodeIndex 0), hashing across the copy cache sublists of all nodes and allocating copy
+	 * caches directly from the memory subspaces rather than from the node-local copy chunks.
+	 * @param env[in] the slave thread to bind
+	 */
+	void bindThreadToNumaNode(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
 	
@@ -142,6 +156,7 @@ public:
 		,_slaveThreadMutex(NULL)
 		,_dispatcherMonitor(NULL)
 		,_synchronizeMutex(NULL)
+		,_workStealingDequeTable(NULL)
 		,_slaveThreadsReservedForGC(false)
 		,_inShutdown(false)
 		,_threadCountMaximum(1)
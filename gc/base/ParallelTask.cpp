@@ -30,6 +30,7 @@
 #include "AtomicOperations.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
+#include "WorkStealingDeque.hpp"
 
 #include "ModronAssertions.h"
 
@@ -283,6 +284,53 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 	}
 }
 
+void *
+MM_ParallelTask::stealWork(MM_EnvironmentBase *env)
+{
+	void *element = NULL;
+
+	if ((NULL != _workStealingDeques) && (1 < _totalThreadCount)) {
+		uintptr_t slaveID = env->getSlaveID();
+		uintptr_t stealAttempts = 0;
+
+		/* xorshift sequence, seeded from the slave ID so that threads start from different victims */
+		uintptr_t seed = env->_stealVictimSeed;
+		if (0 == seed) {
+			seed = slaveID + 1;
+		}
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		env->_stealVictimSeed = seed;
+
+		uintptr_t firstVictim = seed % _totalThreadCount;
+		for (uintptr_t i = 0; (NULL == element) && (i < _totalThreadCount); i++) {
+			uintptr_t victimID = (firstVictim + i) % _totalThreadCount;
+			if (victimID != slaveID) {
+				MM_WorkStealingDeque *victim = _workStealingDeques[victimID];
+				/* a NULL result with a non-empty deque means we lost a race - try the same victim again */
+				while ((NULL == element) && !victim->isEmpty()) {
+					stealAttempts += 1;
+					element = victim->steal();
+				}
+			}
+		}
+
+		recordStealStats(env, stealAttempts, (NULL == element) ? 0 : 1);
+	}
+
+	return element;
+}
+
+void
+MM_ParallelTask::recordStealStats(MM_EnvironmentBase *env, uintptr_t stealAttempts, uintptr_t steals)
+{
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_workPacketStats._stealAttemptCount += stealAttempts;
+	env->_workPacketStats._stealCount += steals;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+}
+
 /**
  * Return true if threads are currently syncronized, false otherwise
  * @return true if threads are currently syncronized, false otherwise
@@ -36,6 +36,7 @@
 #include "Task.hpp"
 
 class MM_EnvironmentBase;
+class MM_WorkStealingDeque;
 
 /**
  * @todo Provide class documentation
@@ -59,6 +60,7 @@ protected:
 	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
 	omrthread_monitor_t _synchronizeMutex;
+	MM_WorkStealingDeque **_workStealingDeques; /**< Per-thread work-stealing deques indexed by slave ID, or NULL if work stealing is disabled */
 public:
 	
 	/*
@@ -76,6 +78,28 @@ public:
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex) { _synchronizeMutex = synchronizeMutex; }
 	virtual void complete(MM_EnvironmentBase *env);
 
+	MMINLINE virtual void setWorkStealingDeques(MM_WorkStealingDeque **workStealingDeques) { _workStealingDeques = workStealingDeques; }
+	MMINLINE virtual MM_WorkStealingDeque *getWorkStealingDeque(uintptr_t slaveID)
+	{
+		return (NULL == _workStealingDeques) ? NULL : _workStealingDeques[slaveID];
+	}
+
+	/**
+	 * Steal an element from the deque of another thread participating in this task.
+	 * Victims are visited starting from a randomly selected thread. A victim is retried for as
+	 * long as it has elements, so a NULL return means every other deque was observed empty.
+	 * Tasks that generate new work while stealing must provide their own termination protocol.
+	 * @return the stolen element, or NULL if there was nothing to steal
+	 */
+	virtual void *stealWork(MM_EnvironmentBase *env);
+
+	/**
+	 * Record the outcome of a call to stealWork() in the per-thread statistics of the task.
+	 * @param stealAttempts number of steal operations attempted
+	 * @param steals number of elements successfully stolen
+	 */
+	virtual void recordStealStats(MM_EnvironmentBase *env, uintptr_t stealAttempts, uintptr_t steals);
+
 	/**
 	 * @note This should not be called by anyone but Dispatcher or ParallelDispatcher 
 	 **/
@@ -101,6 +125,7 @@ public:
 		,_synchronizeIndex(0)
 		,_synchronizeCount(0)
 		,_synchronizeMutex(NULL)
+		,_workStealingDeques(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
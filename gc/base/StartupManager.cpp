@@ -37,6 +37,8 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCPARALLELSLIDINGCOMPACT "-Xgc:parallelSlidingCompact"
+#define OMR_XGCPARALLELSLIDINGCOMPACT_LENGTH 27
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,8 +50,24 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCNOVECTORHEAPMAPSCAN "-Xgc:noVectorHeapMapScan"
+#define OMR_XGCNOVECTORHEAPMAPSCAN_LENGTH 24
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCSEGREGATEDGENERATIONAL "-Xgc:segregatedGenerational"
+#define OMR_XGCSEGREGATEDGENERATIONAL_LENGTH 27
+#define OMR_XGCNOLOCKFREEREGIONFREELIST "-Xgc:noLockFreeRegionFreeList"
+#define OMR_XGCNOLOCKFREEREGIONFREELIST_LENGTH 29
+#endif /* OMR_GC_SEGREGATED_HEAP */
+#define OMR_XGCTLHADAPTIVESIZING "-Xgc:tlhAdaptiveSizing"
+#define OMR_XGCTLHADAPTIVESIZING_LENGTH 22
+#define OMR_XGCTLHTARGETREFRESHCOUNT "-Xgc:tlhTargetRefreshCount="
+#define OMR_XGCTLHTARGETREFRESHCOUNT_LENGTH 27
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCNUMAAWAREGCTHREADS "-Xgc:numaAwareGCThreads"
+#define OMR_XGCNUMAAWAREGCTHREADS_LENGTH 23
+#define OMR_XGCWORKSTEALING "-Xgc:workStealing"
+#define OMR_XGCWORKSTEALING_LENGTH 17
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,6 +282,9 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCPARALLELSLIDINGCOMPACT, OMR_XGCPARALLELSLIDINGCOMPACT_LENGTH)) {
+		extensions->parallelSlidingCompact = true;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +297,28 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCNOVECTORHEAPMAPSCAN, OMR_XGCNOVECTORHEAPMAPSCAN_LENGTH)) {
+		extensions->vectorHeapMapScan = false;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLHADAPTIVESIZING, OMR_XGCTLHADAPTIVESIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLHTARGETREFRESHCOUNT, OMR_XGCTLHTARGETREFRESHCOUNT_LENGTH)) {
+		uintptr_t targetRefreshCount = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCTLHTARGETREFRESHCOUNT_LENGTH, &targetRefreshCount)) || (0 == targetRefreshCount)) {
+			result = false;
+		} else {
+			extensions->tlhTargetRefreshCount = targetRefreshCount;
+		}
+	}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCSEGREGATEDGENERATIONAL, OMR_XGCSEGREGATEDGENERATIONAL_LENGTH)) {
+		extensions->segregatedGenerational = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNOLOCKFREEREGIONFREELIST, OMR_XGCNOLOCKFREEREGIONFREELIST_LENGTH)) {
+		extensions->lockFreeRegionFreeList = false;
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -295,6 +338,12 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 			extensions->gcThreadCount = forcedThreadCount;
 			extensions->gcThreadCountForced = true;
 		}
+	}
+	else if (0 == strncmp(option, OMR_XGCNUMAAWAREGCTHREADS, OMR_XGCNUMAAWAREGCTHREADS_LENGTH)) {
+		extensions->numaAwareGCThreads = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKSTEALING, OMR_XGCWORKSTEALING_LENGTH)) {
+		extensions->workStealingEnabled = true;
 	} else {
 		/* unknown option */
 		result = false;
@@ -40,6 +40,7 @@
 #include "Forge.hpp"
 #include "FrequentObjectsStats.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Math.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 
@@ -130,6 +131,7 @@ MM_TLHAllocationInterface::kill(MM_EnvironmentBase *env)
 		/* Since AllocationStats have been reset, reset the base */
 		_bytesAllocatedBase = 0;
 	}
+	_tlhBytesSinceRestart = 0;
 	
 	_tlhAllocationSupport.reconnect(env, shouldFlush);
 
@@ -290,6 +292,12 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	}	
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */		
 	
+	/* Remember what was allocated through TLHs before the stats are reset, to size the TLHs at the next restart */
+	uintptr_t tlhBytes = _stats._tlhAllocatedFresh + _stats._tlhAllocatedReused;
+	if (tlhBytes > _stats._tlhDiscardedBytes) {
+		_tlhBytesSinceRestart += tlhBytes - _stats._tlhDiscardedBytes;
+	}
+
 	extensions->allocationStats.merge(&_stats);
 	_stats.clear();
 	/* Since AllocationStats have been reset, reset the base as well*/
@@ -323,11 +331,46 @@ MM_TLHAllocationInterface::reconnectCache(MM_EnvironmentBase *env)
 void
 MM_TLHAllocationInterface::restartCache(MM_EnvironmentBase *env)
 {
-	_tlhAllocationSupport.restart(env);
-
+	if (env->getExtensions()->tlhAdaptiveSizing) {
+		uintptr_t refreshSize = adaptiveRefreshSize(env, _tlhAllocationSupport.getRefreshSize());
+		_tlhAllocationSupport.restart(env, refreshSize);
 #if defined(OMR_GC_NON_ZERO_TLH)
-	_tlhAllocationSupportNonZero.restart(env);
+		_tlhAllocationSupportNonZero.restart(env, refreshSize);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+	} else {
+		_tlhAllocationSupport.restart(env);
+#if defined(OMR_GC_NON_ZERO_TLH)
+		_tlhAllocationSupportNonZero.restart(env);
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+	}
+	_tlhBytesSinceRestart = 0;
+}
+
+uintptr_t
+MM_TLHAllocationInterface::adaptiveRefreshSize(MM_EnvironmentBase *env, uintptr_t currentRefreshSize)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	uintptr_t refreshSize = MM_Math::roundToCeiling(sizeof(uintptr_t), _tlhBytesSinceRestart / extensions->tlhTargetRefreshCount);
+	if (refreshSize < extensions->tlhMinimumSize) {
+		refreshSize = extensions->tlhMinimumSize;
+	} else if (refreshSize > extensions->tlhMaximumSize) {
+		refreshSize = extensions->tlhMaximumSize;
+	}
+
+	/* The decision is reported with the allocation stats of the interval it applies to */
+	_stats._tlhRefreshSizeDecisions += 1;
+	_stats._tlhRefreshSizeTotal += refreshSize;
+	if (refreshSize > currentRefreshSize) {
+		_stats._tlhRefreshSizeGrown += 1;
+	} else if (refreshSize < currentRefreshSize) {
+		_stats._tlhRefreshSizeShrunk += 1;
+	}
+	if (refreshSize > _stats._tlhRefreshSizeMax) {
+		_stats._tlhRefreshSizeMax = refreshSize;
+	}
+
+	return refreshSize;
 }
 
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
@@ -63,6 +63,7 @@ private:
 
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	uintptr_t _bytesAllocatedBase; /**< Bytes allocated at the start of an allocation request.  Relative to _stats.bytesAllocated(). */
+	uintptr_t _tlhBytesSinceRestart; /**< TLH bytes allocated since the caches were last restarted, accumulated from _stats each time it is flushed */
 
 public:
 	static MM_TLHAllocationInterface *newInstance(MM_EnvironmentBase *env);
@@ -94,6 +95,14 @@ private:
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
+	/**
+	 * Choose the refresh size for the next allocation interval so that allocating as many bytes as in the
+	 * last interval takes about tlhTargetRefreshCount refreshes, and record the decision in _stats.
+	 * @param[in] currentRefreshSize the refresh size the thread ended the last interval with
+	 * @return the new refresh size
+	 */
+	uintptr_t adaptiveRefreshSize(MM_EnvironmentBase *env, uintptr_t currentRefreshSize);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -105,7 +114,8 @@ private:
 		_tlhAllocationSupportNonZero(env, false),
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 		_cachedAllocationsEnabled(true),
-		_bytesAllocatedBase(0)
+		_bytesAllocatedBase(0),
+		_tlhBytesSinceRestart(0)
 	{
 		_typeId = __FUNCTION__;
 		_tlhAllocationSupport._objectAllocationInterface = this;
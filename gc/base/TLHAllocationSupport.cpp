@@ -120,6 +120,7 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	}
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+	_refreshCount = 0;
 };
 
 /**
@@ -143,6 +144,23 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	setAllZeroes();
 
 	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	_refreshCount = 0;
+};
+
+/**
+ * Restart the cache from its current start with a refresh size chosen by adaptive TLH sizing.
+ *
+ * @param refreshSize the refresh size to start from
+ * @note The previous cache contents are expected to have been flushed back to the heap.
+ */
+void
+MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env, uintptr_t refreshSize)
+{
+	/* Clear current information accumulated */
+	setAllZeroes();
+
+	_tlh->refreshSize = refreshSize;
+	_refreshCount = 0;
 };
 
 /**
@@ -285,8 +303,18 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
+			_refreshCount += 1;
 			if (getRefreshSize() < tlhMaximumSize) {
-				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+				if (!extensions->tlhAdaptiveSizing) {
+					setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+				} else if (_refreshCount > extensions->tlhTargetRefreshCount) {
+					/* The thread is allocating faster than it did before the last GC: double the refresh size
+					 * each time it overruns the target again, rather than waiting for the next GC to resize it.
+					 */
+					uintptr_t grownSize = getRefreshSize() * 2;
+					setRefreshSize((grownSize < tlhMaximumSize) ? grownSize : tlhMaximumSize);
+					_refreshCount = 0;
+				}
 			}
 		}
 	}
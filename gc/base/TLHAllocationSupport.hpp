@@ -80,6 +80,7 @@ private:
 
 	MM_HeapLinkedFreeHeaderTLH *_abandonedList; /**< List of abandoned TLHs. Shaped like a free list. */
 	uintptr_t _abandonedListSize; /**< Number of entries in the abandoned list. */
+	uintptr_t _refreshCount; /**< Number of refreshes since the cache was last restarted or reconnected (used by adaptive TLH sizing) */
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
@@ -136,6 +137,7 @@ private:
 	void clear(MM_EnvironmentBase *env);
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
 	void restart(MM_EnvironmentBase *env);
+	void restart(MM_EnvironmentBase *env, uintptr_t refreshSize);
 	bool refresh(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
@@ -185,6 +187,7 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
+		_refreshCount(0),
 		_zeroTLH(zeroTLH)
 	{};
 
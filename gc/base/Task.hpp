@@ -41,6 +41,7 @@
 
 class MM_Dispatcher;
 class MM_EnvironmentBase;
+class MM_WorkStealingDeque;
 
 /**
  * @todo Provide class documentation
@@ -81,6 +82,28 @@ public:
 		/* in a Task we don't need a mutex */
 	}
 
+	/**
+	 * @note This should not be called by anyone but Dispatcher or ParallelDispatcher
+	 **/
+	MMINLINE virtual void setWorkStealingDeques(MM_WorkStealingDeque **workStealingDeques)
+	{
+		/* in a Task there is nobody to steal from */
+	}
+
+	/**
+	 * Fetch the work-stealing deque of the given GC thread participating in this task.
+	 * @param slaveID the slave ID of the thread owning the deque
+	 * @return the deque, or NULL if work stealing is not available for this task
+	 */
+	MMINLINE virtual MM_WorkStealingDeque *getWorkStealingDeque(uintptr_t slaveID) { return NULL; }
+
+	/**
+	 * Steal an element from the work-stealing deque of another thread participating in this task.
+	 * @return the stolen element, or NULL if there was nothing to steal
+	 * @note no-op
+	 */
+	virtual void *stealWork(MM_EnvironmentBase *env) { return NULL; }
+
 	virtual void accept(MM_EnvironmentBase *env);
 	virtual void complete(MM_EnvironmentBase *env);
 
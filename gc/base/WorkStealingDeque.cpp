@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+
+#include "WorkStealingDeque.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "Math.hpp"
+#include "ModronAssertions.h"
+
+/**
+ * Allocate and initialize a new instance of the receiver.
+ * @param capacity number of elements the deque can hold, rounded up to a power of 2
+ * @return a new instance of the receiver, or NULL on failure.
+ */
+MM_WorkStealingDeque *
+MM_WorkStealingDeque::newInstance(MM_EnvironmentBase *env, uintptr_t capacity)
+{
+	MM_WorkStealingDeque *deque = NULL;
+	uintptr_t roundedCapacity = 1;
+
+	Assert_MM_true(0 < capacity);
+	while (roundedCapacity < capacity) {
+		roundedCapacity <<= 1;
+	}
+
+	deque = (MM_WorkStealingDeque *)env->getForge()->allocate(sizeof(MM_WorkStealingDeque), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL != deque) {
+		new(deque) MM_WorkStealingDeque(env, roundedCapacity);
+		if (!deque->initialize(env)) {
+			deque->kill(env);
+			deque = NULL;
+		}
+	}
+
+	return deque;
+}
+
+/**
+ * Free the receiver and all associated resources.
+ */
+void
+MM_WorkStealingDeque::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+/**
+ * Initialize the receivers internal structures and resources.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool
+MM_WorkStealingDeque::initialize(MM_EnvironmentBase *env)
+{
+	_buffer = (void **)env->getForge()->allocate(_capacity * sizeof(void *), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	return (NULL != _buffer);
+}
+
+/**
+ * Free the receivers internal structures and resources.
+ */
+void
+MM_WorkStealingDeque::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _buffer) {
+		env->getForge()->free(_buffer);
+		_buffer = NULL;
+	}
+}
@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Bounded Chase-Lev work-stealing deque.
+ * The owning GC thread pushes and pops elements at the bottom of the deque (LIFO) without
+ * taking any lock, while other GC threads may concurrently steal elements from the top (FIFO).
+ * Only the removal of the last remaining element requires an atomic operation by the owner.
+ * The deque does not grow: push() fails when the deque is full and the caller is expected
+ * to fall back to its shared work distribution mechanism.
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingDeque : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	void **_buffer; /**< Circular element storage, _capacity entries long */
+	uintptr_t _capacity; /**< Number of elements the deque can hold (power of 2) */
+	uintptr_t _mask; /**< _capacity - 1, used to index the circular storage */
+	volatile uintptr_t _top; /**< Index of the oldest element - advanced by thieves and by the owner taking the last element */
+	volatile uintptr_t _bottom; /**< Index one past the youngest element - only modified by the owner */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_WorkStealingDeque *newInstance(MM_EnvironmentBase *env, uintptr_t capacity);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Discard all elements.
+	 * @note Must only be called while no other thread is accessing the deque
+	 */
+	MMINLINE void reset()
+	{
+		_top = 0;
+		_bottom = 0;
+	}
+
+	MMINLINE uintptr_t getCapacity() { return _capacity; }
+
+	/**
+	 * Return an approximation of the number of elements in the deque. The result is exact
+	 * only when no other thread is concurrently modifying the deque.
+	 */
+	MMINLINE uintptr_t getSize()
+	{
+		intptr_t size = (intptr_t)(_bottom - _top);
+		return (size > 0) ? (uintptr_t)size : 0;
+	}
+
+	MMINLINE bool isEmpty() { return 0 == getSize(); }
+
+	/**
+	 * Push an element on the bottom of the deque.
+	 * @note Owner thread only
+	 * @param element[in] The element to push (must not be NULL)
+	 * @return true if the element was pushed, false if the deque is full
+	 */
+	MMINLINE bool push(void *element)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+		if ((bottom - top) >= _capacity) {
+			return false;
+		}
+		_buffer[bottom & _mask] = element;
+		/* the element must be visible before a thief can observe the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the youngest element from the bottom of the deque.
+	 * @note Owner thread only
+	 * @return the element, or NULL if the deque is empty (or the last element was stolen)
+	 */
+	MMINLINE void *pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* the store of bottom must be ordered before the load of top */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+		intptr_t size = (intptr_t)(bottom - top);
+		void *element = NULL;
+
+		if (size >= 0) {
+			element = _buffer[bottom & _mask];
+			if (0 == size) {
+				/* Last element - race against thieves for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					element = NULL;
+				}
+				_bottom = bottom + 1;
+			}
+		} else {
+			/* Deque was already empty - restore bottom */
+			_bottom = bottom + 1;
+		}
+
+		return element;
+	}
+
+	/**
+	 * Steal the oldest element from the top of the deque.
+	 * @note May be called by any thread
+	 * @return the element, or NULL if the deque was empty or another thread won the race for the element
+	 */
+	MMINLINE void *steal()
+	{
+		uintptr_t top = _top;
+		/* the load of top must be ordered before the load of bottom */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+		void *element = NULL;
+
+		if ((intptr_t)(bottom - top) > 0) {
+			element = _buffer[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				element = NULL;
+			}
+		}
+
+		return element;
+	}
+
+	/**
+	 * Create a WorkStealingDeque object.
+	 */
+	MM_WorkStealingDeque(MM_EnvironmentBase *env, uintptr_t capacity) :
+		MM_BaseVirtual()
+		,_buffer(NULL)
+		,_capacity(capacity)
+		,_mask(capacity - 1)
+		,_top(0)
+		,_bottom(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
@@ -247,7 +247,8 @@ MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::shouldPreMarkSmallCells(MM_EnvironmentBase *env)
 {
-	return true;
+	/* In generational mode a marked cell is a mature cell, so new objects must be allocated unmarked */
+	return !env->getExtensions()->segregatedGenerational;
 }
 
 /*
@@ -281,6 +282,7 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 				if (shouldPreMarkSmallCells(env)) {
 					_markingScheme->preMarkSmallCells(env, region, cellList, preAllocatedBytes);
 				}
+				region->setNursery(true);
 				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, preAllocatedBytes);
 				result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
 				done = true;
@@ -380,6 +382,7 @@ MM_AllocationContextSegregated::allocateLarge(MM_EnvironmentBase *env, uintptr_t
 
 		/* reset ACL counts */
 		region->getMemoryPoolACL()->resetCounts();
+		region->setNursery(true);
 	}
 
 	return result;
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(CARDCLEANERSEGREGATED_HPP_)
+#define CARDCLEANERSEGREGATED_HPP_
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP) && defined(OMR_GC_HEAP_CARD_TABLE)
+
+#include "CardCleaner.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "Math.hpp"
+#include "SegregatedMarkingScheme.hpp"
+
+/**
+ * Card cleaner for the minor collection of a generational segregated heap.
+ * Marked objects are mature (they survived an earlier collection); the ones found on a dirty card
+ * were written to since, so they are scanned for references into the nursery.
+ * @ingroup GC_Modron_Metronome
+ */
+class MM_CardCleanerSegregated : public MM_CardCleaner
+{
+public:
+protected:
+private:
+	MM_SegregatedMarkingScheme *_markingScheme;
+public:
+protected:
+	/**
+	 * Scan the mature objects starting on the card
+	 *
+	 * @param[in] env A GC thread
+	 * @param[in] lowAddress low address of the range to be cleaned
+	 * @param[in] highAddress high address of the range to be cleaned
+	 * @param cardToClean[in/out] The card which we are cleaning
+	 */
+	virtual void clean(MM_EnvironmentBase *env, void *lowAddress, void *highAddress, Card *cardToClean)
+	{
+		*cardToClean = CARD_CLEAN;
+
+		/* The segregated mark map is coarser than the one MM_HeapMapIterator walks, so the objects starting on the
+		 * card are found from the cell layout of the region. Unmarked (nursery) objects on the card are reached by
+		 * the trace if they are live.
+		 */
+		MM_HeapRegionDescriptorSegregated *region = (MM_HeapRegionDescriptorSegregated *)env->getExtensions()->heapRegionManager->tableDescriptorForAddress(lowAddress);
+		if (region->isSmall()) {
+			uintptr_t regionBase = (uintptr_t)region->getLowAddress();
+			uintptr_t cellSize = region->getCellSize();
+			uintptr_t cellTop = regionBase + (region->getNumCells() * cellSize);
+			uintptr_t cellTopOnCard = OMR_MIN(cellTop, (uintptr_t)highAddress);
+			uintptr_t cell = regionBase + MM_Math::roundToCeiling(cellSize, (uintptr_t)lowAddress - regionBase);
+			for (; cell < cellTopOnCard; cell += cellSize) {
+				if (_markingScheme->isMarked((omrobjectptr_t)cell)) {
+					_markingScheme->scanObject(env, (omrobjectptr_t)cell, SCAN_REASON_DIRTY_CARD);
+				}
+			}
+		} else if (region->isLarge() && (region->getRangeHead() == region) && (region->getLowAddress() == lowAddress)) {
+			/* a large object is dirtied through the card of its header, the first card of its region */
+			omrobjectptr_t object = (omrobjectptr_t)lowAddress;
+			if (_markingScheme->isMarked(object)) {
+				_markingScheme->scanObject(env, object, SCAN_REASON_DIRTY_CARD);
+			}
+		}
+	}
+
+	/**
+	 * @see MM_CardCleaner::getVMStateID()
+	 */
+	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_CARD_CLEANER_FOR_MINOR_MARKING; }
+
+public:
+
+	/**
+	 * Create a CardCleaner object for the minor collection of a generational segregated heap
+	 */
+	MM_CardCleanerSegregated(MM_SegregatedMarkingScheme *markingScheme)
+		: MM_CardCleaner()
+		, _markingScheme(markingScheme)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP && OMR_GC_HEAP_CARD_TABLE */
+
+#endif /* CARDCLEANERSEGREGATED_HPP_ */
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "CardTableSegregated.hpp"
+
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionIterator.hpp"
+#include "Task.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP) && defined(OMR_GC_HEAP_CARD_TABLE)
+
+/**
+ * Allocate and initialize a new instance of the receiver.
+ * @return a new instance of the receiver, or NULL on failure.
+ */
+MM_CardTableSegregated *
+MM_CardTableSegregated::newInstance(MM_EnvironmentBase *env, MM_Heap *heap)
+{
+	MM_CardTableSegregated *cardTable = (MM_CardTableSegregated *)env->getForge()->allocate(sizeof(MM_CardTableSegregated), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != cardTable) {
+		new(cardTable) MM_CardTableSegregated();
+		if (!cardTable->initialize(env, heap)) {
+			cardTable->kill(env);
+			cardTable = NULL;
+		}
+	}
+	return cardTable;
+}
+
+bool
+MM_CardTableSegregated::heapAddRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	/* Determine the current top of heap */
+	_heapAlloc = env->getExtensions()->heap->getHeapTop();
+
+	bool result = commitCardTableMemory(env, heapAddrToCardAddr(env, lowAddress), heapAddrToCardAddr(env, highAddress));
+	if (result) {
+		clearCardsInRange(env, lowAddress, highAddress);
+	}
+	return result;
+}
+
+bool
+MM_CardTableSegregated::heapRemoveRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	bool result = true;
+	/* No card has been committed if the heap has not been expanded yet */
+	if (NULL != _heapAlloc) {
+		Card *lowValidCard = (NULL == lowValidAddress) ? NULL : heapAddrToCardAddr(env, lowValidAddress);
+		Card *highValidCard = (NULL == highValidAddress) ? NULL : heapAddrToCardAddr(env, highValidAddress);
+		result = decommitCardTableMemory(env, heapAddrToCardAddr(env, lowAddress), heapAddrToCardAddr(env, highAddress), lowValidCard, highValidCard);
+		_heapAlloc = env->getExtensions()->heap->getHeapTop();
+	}
+	return result;
+}
+
+void
+MM_CardTableSegregated::clearAllCards(MM_EnvironmentBase *env)
+{
+	/* _heapAlloc is the reserved top of the heap; only the cards of the regions are committed */
+	GC_HeapRegionIterator regionIterator(env->getExtensions()->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		clearCardsInRange(env, region->getLowAddress(), region->getHighAddress());
+	}
+}
+
+void
+MM_CardTableSegregated::cleanCardsOfInUseRegions(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner)
+{
+	GC_HeapRegionIterator regionIterator(env->getExtensions()->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+	while (NULL != (region = (MM_HeapRegionDescriptorSegregated *)regionIterator.nextRegion())) {
+		/* A nursery region may also hold survivors of the previous collection, so it is cleaned as well */
+		if (region->isSmall() || region->isLarge()) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				cleanCardsInRegion(env, cardCleaner, region);
+			}
+		}
+	}
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP && OMR_GC_HEAP_CARD_TABLE */
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(CARDTABLESEGREGATED_HPP_)
+#define CARDTABLESEGREGATED_HPP_
+
+#include "omrcfg.h"
+
+#include "CardTable.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP) && defined(OMR_GC_HEAP_CARD_TABLE)
+
+class MM_CardCleaner;
+class MM_EnvironmentBase;
+class MM_Heap;
+
+/**
+ * Card table used as the remembered set of a generational segregated heap.
+ * The write barrier dirties the card of every object it stores a reference into, and the
+ * minor collection scans the marked (mature) objects on dirty cards for references into the nursery.
+ * @ingroup GC_Modron_Metronome
+ */
+class MM_CardTableSegregated : public MM_CardTable
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_CardTableSegregated *newInstance(MM_EnvironmentBase *env, MM_Heap *heap);
+
+	/**
+	 * Commit and clear the cards covering memory added to the heap.
+	 * @param[in] env The thread expanding the heap
+	 * @param[in] lowAddress The base address of the memory added to the heap
+	 * @param[in] highAddress The top address (non-inclusive) of the memory added to the heap
+	 * @return true if the cards were committed
+	 */
+	bool heapAddRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Decommit the cards covering memory removed from the heap.
+	 * @param[in] env The thread contracting the heap
+	 * @param[in] lowAddress The base address of the memory removed from the heap
+	 * @param[in] highAddress The top address (non-inclusive) of the memory removed from the heap
+	 * @param[in] lowValidAddress The first valid address below the removed range, or NULL
+	 * @param[in] highValidAddress The first valid address above the removed range, or NULL
+	 * @return true if the cards were decommitted
+	 */
+	bool heapRemoveRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Clear every card of the heap. Called before a full collection, which traces the whole heap and
+	 * so does not need the remembered set.
+	 * @param[in] env The master GC thread
+	 */
+	void clearAllCards(MM_EnvironmentBase *env);
+
+	/**
+	 * Clean the cards of the regions holding objects, handing every dirty card to the card cleaner.
+	 * Cards are only committed for the regions in the heap, so the table is walked region by region
+	 * rather than up to the reserved top of the heap. Regions are distributed as work units.
+	 * @param[in] env The thread cleaning cards
+	 * @param[in] cardCleaner The cleaner scanning the objects of each dirty card
+	 */
+	void cleanCardsOfInUseRegions(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner);
+
+protected:
+	MM_CardTableSegregated()
+		: MM_CardTable()
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP && OMR_GC_HEAP_CARD_TABLE */
+
+#endif /* CARDTABLESEGREGATED_HPP_ */
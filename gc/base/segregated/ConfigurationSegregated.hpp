@@ -67,7 +67,7 @@ public:
 	virtual void defaultMemorySpaceAllocated(MM_GCExtensionsBase *extensions, void* defaultMemorySpace);
 	
 	MM_ConfigurationSegregated(MM_EnvironmentBase *env)
-		: MM_Configuration(env, gc_policy_metronome, mm_regionAlignment, SEGREGATED_REGION_SIZE_BYTES, SEGREGATED_ARRAYLET_LEAF_SIZE_BYTES, gc_modron_wrtbar_none, gc_modron_allocation_type_segregated)
+		: MM_Configuration(env, gc_policy_metronome, mm_regionAlignment, SEGREGATED_REGION_SIZE_BYTES, SEGREGATED_ARRAYLET_LEAF_SIZE_BYTES, getWriteBarrierType(env), gc_modron_allocation_type_segregated)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -79,6 +79,17 @@ protected:
 	virtual bool initializeEnvironment(MM_EnvironmentBase *env);
 
 private:
+	static MM_GCWriteBarrierType getWriteBarrierType(MM_EnvironmentBase *env)
+	{
+		MM_GCWriteBarrierType writeBarrierType = gc_modron_wrtbar_none;
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+		if (env->getExtensions()->segregatedGenerational) {
+			/* the card table is the remembered set of the mature regions */
+			writeBarrierType = gc_modron_wrtbar_cardmark;
+		}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+		return writeBarrierType;
+	}
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
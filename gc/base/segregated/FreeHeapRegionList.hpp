@@ -96,6 +96,12 @@ public:
 	}
 
 	virtual uintptr_t getMaxRegions() = 0;
+
+	/**
+	 * @return true if the list is maintained without a lock, in which case its regions are only
+	 * linked through their next pointers and it can only be drained by popping
+	 */
+	virtual bool isLockFree() { return false; }
 		
 	/* Methods inherited from HeapRegionList */
 	virtual bool isEmpty() { return 0 == _length; }
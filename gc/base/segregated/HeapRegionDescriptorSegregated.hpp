@@ -51,6 +51,7 @@ private:
 	MM_HeapRegionManager *_regionManager;
 	OMR_SizeClasses *_segregatedSizeClasses;
 	uintptr_t _nextArrayletIndex; /**< next arraylet to use for allocation */
+	bool _nursery; /**< true if objects have been allocated into the region since it was last swept */
 	
 	/*
 	 * Function members
@@ -65,6 +66,7 @@ public:
 		,_regionManager(NULL)
 		,_segregatedSizeClasses(env->getOmrVM()->_sizeClasses)
 		,_nextArrayletIndex(0)
+		,_nursery(false)
 	{
 		_arrayletBackPointers = ((uintptr_t **)(this + 1));
 		_typeId = __FUNCTION__;
@@ -136,6 +138,12 @@ public:
 	void addBytesFreedToSmallSpineBackout(MM_EnvironmentBase* env);
 #endif /* defined(OMR_GC_ARRAYLETS) */
 
+	/**
+	 * In generational mode, nursery regions are the ones swept by a minor collection.
+	 */
+	MMINLINE bool isNursery() { return _nursery; }
+	MMINLINE void setNursery(bool nursery) { _nursery = nursery; }
+
 	void setLarge(uintptr_t range) { setRange(SEGREGATED_LARGE, range); }
 	void setSmall(uintptr_t sizeClass);
 	void setFree(uintptr_t range);
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronopt.h"
+#include "sizeclasses.h"
+
+#include "HeapRegionManager.hpp"
+#include "HeapRegionQueue.hpp"
+
+#include "LockFreeHeapRegionList.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeHeapRegionList *
+MM_LockFreeHeapRegionList::newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, MM_HeapRegionManager *regionManager)
+{
+	MM_LockFreeHeapRegionList *fpl = (MM_LockFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_LockFreeHeapRegionList), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (fpl) {
+		new (fpl) MM_LockFreeHeapRegionList(regionListKind, regionManager->physicalTableDescriptorForIndex(0), regionManager->getTableDescriptorSize());
+		if (!fpl->initialize(env)) {
+			fpl->kill(env);
+			return NULL;
+		}
+	}
+	return fpl;
+}
+
+void
+MM_LockFreeHeapRegionList::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeHeapRegionList::initialize(MM_EnvironmentBase *env)
+{
+	return (0 != _regionTable) && (0 != _descriptorSize);
+}
+
+void
+MM_LockFreeHeapRegionList::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+void
+MM_LockFreeHeapRegionList::push(MM_HeapRegionQueue *src)
+{
+	MM_HeapRegionDescriptorSegregated *head = src->dequeue();
+	if (NULL != head) {
+		MM_HeapRegionDescriptorSegregated *tail = head;
+		uintptr_t count = 1;
+		MM_HeapRegionDescriptorSegregated *region = src->dequeue();
+		while (NULL != region) {
+			Assert_MM_true(NULL == region->getPrev());
+			tail->setNext(region);
+			tail = region;
+			count += 1;
+			region = src->dequeue();
+		}
+		pushChain(head, tail, count);
+	}
+}
+
+void
+MM_LockFreeHeapRegionList::push(MM_FreeHeapRegionList *src)
+{
+	MM_HeapRegionDescriptorSegregated *head = src->pop();
+	if (NULL != head) {
+		MM_HeapRegionDescriptorSegregated *tail = head;
+		uintptr_t count = 1;
+		MM_HeapRegionDescriptorSegregated *region = src->pop();
+		while (NULL != region) {
+			Assert_MM_true(1 == region->getRange());
+			tail->setNext(region);
+			tail = region;
+			count += 1;
+			region = src->pop();
+		}
+		pushChain(head, tail, count);
+	}
+}
+
+void
+MM_LockFreeHeapRegionList::detach(MM_HeapRegionDescriptorSegregated *cur)
+{
+	uint64_t top = MM_AtomicOperations::getU64(&_top);
+	MM_HeapRegionDescriptorSegregated *prev = NULL;
+	MM_HeapRegionDescriptorSegregated *region = (0 == topIndex(top)) ? NULL : regionForIndex(topIndex(top));
+	while ((NULL != region) && (cur != region)) {
+		prev = region;
+		region = region->getNext();
+	}
+	Assert_MM_true(cur == region);
+
+	if (NULL == prev) {
+		MM_AtomicOperations::setU64(&_top, encodeTop(cur->getNext(), top));
+	} else {
+		prev->setNext(cur->getNext());
+	}
+	cur->setNext(NULL);
+	MM_AtomicOperations::subtract(&_length, 1);
+}
+
+void
+MM_LockFreeHeapRegionList::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t count = 0;
+	uint64_t top = MM_AtomicOperations::getU64(&_top);
+	omrtty_printf("LockFreeHeapRegionList 0x%x: ", this);
+	for (MM_HeapRegionDescriptorSegregated *cur = (0 == topIndex(top)) ? NULL : regionForIndex(topIndex(top)); cur != NULL; cur = cur->getNext()) {
+		omrtty_printf("  %d-%d-%d ", count, count, cur->getRange());
+		count += 1;
+	}
+	omrtty_printf("\n");
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
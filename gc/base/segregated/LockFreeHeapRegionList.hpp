@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#if !defined(LOCKFREEHEAPREGIONLIST_HPP_)
+#define LOCKFREEHEAPREGIONLIST_HPP_
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "FreeHeapRegionList.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_HeapRegionManager;
+
+/**
+ * A lock-free implementation of a FreeHeapRegionList holding single regions only.
+ * The regions form a stack linked through their next pointers. The top of the stack is
+ * a 64 bit word holding the table index of the top region (biased by one so that zero means
+ * empty) in its low half and a tag in its high half. The tag is bumped by every update so
+ * that a compare and swap racing with a pop and re-push of the same region fails (ABA).
+ * Region descriptors live in the region table for the lifetime of the heap, so reading the
+ * next pointer of a region that has just been popped by another thread is safe.
+ *
+ * detach() and the iterating methods expect no concurrent pushes or pops, which is how
+ * the sweep and coalesce phases use free lists.
+ */
+class MM_LockFreeHeapRegionList : public MM_FreeHeapRegionList
+{
+/* Data members & types */
+public:
+protected:
+private:
+	volatile uint64_t _top; /**< index + 1 of the top region in the low 32 bits, update tag in the high 32 bits */
+	uintptr_t _regionTable; /**< base of the region descriptor table used to map between regions and indices */
+	uintptr_t _descriptorSize; /**< size, in bytes, of one descriptor in the region table */
+
+/* Methods */
+public:
+	static MM_LockFreeHeapRegionList *newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, MM_HeapRegionManager *regionManager);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * @param regionTable the first descriptor of the region table all regions on this list belong to
+	 * @param descriptorSize the size, in bytes, of a descriptor in the region table
+	 */
+	MM_LockFreeHeapRegionList(MM_HeapRegionList::RegionListKind regionListKind, void *regionTable, uintptr_t descriptorSize) :
+		MM_FreeHeapRegionList(regionListKind, true),
+		_top(0),
+		_regionTable((uintptr_t)regionTable),
+		_descriptorSize(descriptorSize)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual void
+	push(MM_HeapRegionDescriptorSegregated *region)
+	{
+		Assert_MM_true(NULL == region->getNext() && NULL == region->getPrev());
+		pushChain(region, region, 1);
+	}
+
+	virtual void push(MM_HeapRegionQueue *src);
+	virtual void push(MM_FreeHeapRegionList *src);
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	pop()
+	{
+		MM_HeapRegionDescriptorSegregated *result = NULL;
+		uint64_t oldTop = MM_AtomicOperations::getU64(&_top);
+		while (0 != topIndex(oldTop)) {
+			MM_HeapRegionDescriptorSegregated *region = regionForIndex(topIndex(oldTop));
+			MM_HeapRegionDescriptorSegregated *next = region->getNext();
+			uint64_t newTop = encodeTop(next, oldTop);
+			uint64_t witness = MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, newTop);
+			if (witness == oldTop) {
+				region->setNext(NULL);
+				MM_AtomicOperations::subtract(&_length, 1);
+				result = region;
+				break;
+			}
+			oldTop = witness;
+		}
+		return result;
+	}
+
+	virtual void detach(MM_HeapRegionDescriptorSegregated *cur);
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess)
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		if (1 == numRegions) {
+			region = MM_FreeHeapRegionList::allocate(env, szClass);
+		}
+		return region;
+	}
+
+	virtual uintptr_t getTotalRegions() { return _length; }
+	virtual uintptr_t getMaxRegions() { return isEmpty() ? 0 : 1; }
+	virtual bool isLockFree() { return true; }
+
+	virtual void showList(MM_EnvironmentBase *env);
+
+protected:
+private:
+	MMINLINE uintptr_t topIndex(uint64_t top) { return (uintptr_t)(top & 0xFFFFFFFF); }
+
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	regionForIndex(uintptr_t index)
+	{
+		return (MM_HeapRegionDescriptorSegregated *)(_regionTable + ((index - 1) * _descriptorSize));
+	}
+
+	/**
+	 * Build the top of stack word for region, tagged one past the tag of the top it replaces.
+	 */
+	MMINLINE uint64_t
+	encodeTop(MM_HeapRegionDescriptorSegregated *region, uint64_t oldTop)
+	{
+		uint64_t index = 0;
+		if (NULL != region) {
+			index = (uint64_t)((((uintptr_t)region - _regionTable) / _descriptorSize) + 1);
+		}
+		return ((oldTop + ((uint64_t)1 << 32)) & ~(uint64_t)0xFFFFFFFF) | index;
+	}
+
+	/**
+	 * Push a chain of regions already linked from head to tail through their next pointers.
+	 */
+	void
+	pushChain(MM_HeapRegionDescriptorSegregated *head, MM_HeapRegionDescriptorSegregated *tail, uintptr_t count)
+	{
+		/* count before publishing so that a racing pop can never take the length below zero */
+		MM_AtomicOperations::add(&_length, count);
+		uint64_t oldTop = MM_AtomicOperations::getU64(&_top);
+		while (true) {
+			tail->setNext((0 == topIndex(oldTop)) ? NULL : regionForIndex(topIndex(oldTop)));
+			uint64_t witness = MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, encodeTop(head, oldTop));
+			if (witness == oldTop) {
+				break;
+			}
+			oldTop = witness;
+		}
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONLIST_HPP_ */
@@ -105,6 +105,17 @@ public:
 	virtual void 
 	push(MM_FreeHeapRegionList *srcAsFPL) 
 	{ 
+		if (srcAsFPL->isLockFree()) {
+			/* A lock-free list has no back links to splice with, so move its regions one at a time */
+			lock();
+			MM_HeapRegionDescriptorSegregated *region = srcAsFPL->pop();
+			while (NULL != region) {
+				pushInternal(region);
+				region = srcAsFPL->pop();
+			}
+			unlock();
+			return;
+		}
 		MM_LockingFreeHeapRegionList* src = MM_LockingFreeHeapRegionList::asLockingFreeHeapRegionList(srcAsFPL);
 		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
 			return;
@@ -112,7 +112,7 @@ MM_MemoryPoolSegregated::flushCachedFullRegions(MM_EnvironmentBase *env)
 }
 
 void
-MM_MemoryPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
+MM_MemoryPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env, bool nurseryOnly)
 {
 	assume(env->isMasterThread(), "only can be called by master thread");
 	/* Must flush allocation contexts as part of transfering inUseToSweep.
@@ -120,7 +120,7 @@ MM_MemoryPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 	 * put on a sweep list while mutators are still allocating into them.
 	 */
 	_globalAllocationManager->flushAllocationContexts(env);
-	_regionPool->moveInUseToSweep(env);
+	_regionPool->moveInUseToSweep(env, nurseryOnly);
 }
 
 #if defined(OMR_GC_ARRAYLETS)
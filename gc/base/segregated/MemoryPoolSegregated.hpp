@@ -108,7 +108,7 @@ public:
 	MMINLINE uintptr_t verbose(MM_EnvironmentBase *env) { return _extensions->verbose; }
 	MMINLINE uintptr_t debug(MM_EnvironmentBase *env) { return _extensions->debug; }
 
-	void moveInUseToSweep(MM_EnvironmentBase *env);
+	void moveInUseToSweep(MM_EnvironmentBase *env, bool nurseryOnly = false);
 	void flushCachedFullRegions(MM_EnvironmentBase *env);
 	
 	uintptr_t getUsedAndLiveObjectsSize(MM_EnvironmentBase *env, bool unmark_objects, bool unmark_live_alloc, 
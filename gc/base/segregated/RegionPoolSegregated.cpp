@@ -32,6 +32,7 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionManager.hpp"
+#include "LockFreeHeapRegionList.hpp"
 #include "LockingFreeHeapRegionList.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
@@ -141,6 +142,11 @@ MM_RegionPoolSegregated::allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_Hea
 MM_FreeHeapRegionList*
 MM_RegionPoolSegregated::allocateFreeHeapRegionList(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly)
 {
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (singleRegionsOnly && extensions->lockFreeRegionFreeList) {
+		/* Single free regions are popped on every size class refill, keep them off the list lock */
+		return MM_LockFreeHeapRegionList::newInstance(env, regionListKind, extensions->heapRegionManager);
+	}
 	return MM_LockingFreeHeapRegionList::newInstance(env, regionListKind, singleRegionsOnly);
 }
 
@@ -214,28 +220,53 @@ MM_RegionPoolSegregated::addSingleFree(MM_EnvironmentBase *env, MM_HeapRegionQue
 }
 
 void
-MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
+MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env, bool nurseryOnly)
 {
 	_currentTotalCountOfSweepRegions = 0;
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		_darkMatterCellCount[sizeClass] = 0;
-		_smallSweepRegions[sizeClass]->enqueue(_smallFullRegions[sizeClass]);
-		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[sizeClass][i];
-			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-				_smallSweepRegions[sizeClass]->enqueue(&regionQueue[j]);
+		if (nurseryOnly) {
+			/* Regions allocated into are normally flushed to the sweep queues by their allocation context,
+			 * only the ones returned to the full queue need to be picked out. Available regions have not
+			 * been allocated into since they were swept, so they hold mature objects only.
+			 */
+			moveNurseryToSweep(_smallFullRegions[sizeClass], _smallSweepRegions[sizeClass]);
+		} else {
+			_smallSweepRegions[sizeClass]->enqueue(_smallFullRegions[sizeClass]);
+			for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
+				MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[sizeClass][i];
+				for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
+					_smallSweepRegions[sizeClass]->enqueue(&regionQueue[j]);
+				}
 			}
 		}
 		_initialCountOfSweepRegions[sizeClass] = _currentCountOfSweepRegions[sizeClass] = _smallSweepRegions[sizeClass]->getTotalRegions();
 		_initialTotalCountOfSweepRegions = _currentTotalCountOfSweepRegions += _initialCountOfSweepRegions[sizeClass];
 	}
 
-	_largeSweepRegions->enqueue(_largeFullRegions);
+	if (nurseryOnly) {
+		moveNurseryToSweep(_largeFullRegions, _largeSweepRegions);
+	} else {
+		_largeSweepRegions->enqueue(_largeFullRegions);
+	}
 
 	_arrayletSweepRegions->enqueue(_arrayletFullRegions);
 	_arrayletSweepRegions->enqueue(_arrayletAvailableRegions);
 }
 
+void
+MM_RegionPoolSegregated::moveNurseryToSweep(MM_HeapRegionQueue *inUseRegions, MM_HeapRegionQueue *sweepRegions)
+{
+	for (uintptr_t count = inUseRegions->length(); 0 < count; count--) {
+		MM_HeapRegionDescriptorSegregated *region = inUseRegions->dequeue();
+		if (region->isNursery()) {
+			sweepRegions->enqueue(region);
+		} else {
+			inUseRegions->enqueue(region);
+		}
+	}
+}
+
 void
 MM_RegionPoolSegregated::countFreeRegions(uintptr_t *singleFree, uintptr_t *multiFree, uintptr_t *maxMultiFree, uintptr_t *coalesceFree)
 {
@@ -155,6 +155,11 @@ private:
 	{
 		MM_AtomicOperations::subtract(&_regionsInUse, value);
 	}
+
+	/**
+	 * Move the nursery regions of an "in use" queue to a "sweep" queue, leaving the mature regions in place.
+	 */
+	void moveNurseryToSweep(MM_HeapRegionQueue *inUseRegions, MM_HeapRegionQueue *sweepRegions);
 	
 protected:
 public:
@@ -177,8 +182,9 @@ public:
 	/**
  	 * For all size classes, move all regions in that size class from "in use"
  	 * region lists to "sweep" region lists.
+ 	 * @param nurseryOnly if true, only move the regions allocated into since they were last swept (minor collection)
  	 */
-	void moveInUseToSweep(MM_EnvironmentBase *env);
+	void moveInUseToSweep(MM_EnvironmentBase *env, bool nurseryOnly = false);
 	void countFreeRegions(uintptr_t *singleFree, uintptr_t *multiFree, uintptr_t *maxMultiFree, uintptr_t *coalesceFree);
 	void addFreeRange(void *lowAddress, void *highAddress);
 	void addFreeRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region, bool alreadyFree = false);
@@ -20,6 +20,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
  *******************************************************************************/
 
+#include "CardCleanerSegregated.hpp"
+#include "CardTableSegregated.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "Dispatcher.hpp"
@@ -32,6 +34,7 @@
 #include "ParallelMarkTask.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SegregatedMinorMarkTask.hpp"
 #include "SegregatedSweepTask.hpp"
 #include "SweepSchemeSegregated.hpp"
 #include "SweepStats.hpp"
@@ -94,6 +97,18 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (_extensions->segregatedGenerational) {
+		_cardTable = MM_CardTableSegregated::newInstance(env, _extensions->getHeap());
+		if (NULL == _cardTable) {
+			return false;
+		}
+		/* Set card table address in GC Extensions for the write barrier */
+		_extensions->cardTable = _cardTable;
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+
 	return true;
 }
 
@@ -112,18 +127,38 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _cardTable) {
+		_cardTable->kill(env);
+		_cardTable = NULL;
+		_extensions->cardTable = NULL;
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
 }
 
 bool
 MM_SegregatedGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
 {
-	return _markingScheme->heapAddRange(env, subspace, size, lowAddress, highAddress);
+	bool result = _markingScheme->heapAddRange(env, subspace, size, lowAddress, highAddress);
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (result && (NULL != _cardTable)) {
+		result = _cardTable->heapAddRange(env, lowAddress, highAddress);
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+	return result;
 }
 
 bool
 MM_SegregatedGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
 {
-	return _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (result && (NULL != _cardTable)) {
+		result = _cardTable->heapRemoveRange(env, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+	return result;
 }
 
 void MM_SegregatedGC::heapReconfigured(MM_EnvironmentBase* env)
@@ -208,10 +243,29 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 //		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
 //	}
 
-	/* run the mark */
-	bool initMarkMap = true; // reset the markmap?
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	bool minorCollection = false;
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _cardTable) {
+		minorCollection = isMinorCollection(env);
+		if (!minorCollection) {
+			/* A full collection traces the whole heap, so the remembered set is not needed */
+			_cardTable->clearAllCards(env);
+		}
+	}
+
+	if (minorCollection) {
+		/* Survivors of previous collections keep their mark, only the nursery is traced */
+		MM_CardCleanerSegregated cardCleaner(_markingScheme);
+		MM_SegregatedMinorMarkTask markTask(env, _dispatcher, _markingScheme, _cardTable, &cardCleaner, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+	} else
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+	{
+		/* run the mark */
+		bool initMarkMap = true; // reset the markmap?
+		MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+	}
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
@@ -227,8 +281,14 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
+	_sweepScheme->setSweepNurseryOnly(minorCollection);
 	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
 	_dispatcher->run(env, &sweepTask);
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _cardTable) {
+		updateMajorCollectionRequest(env, minorCollection);
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
 	/* We now have accurate free space statistics so recalculate any expand/contract amount */
@@ -252,6 +312,29 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	return true;
 }
 
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+bool
+MM_SegregatedGC::isMinorCollection(MM_EnvironmentBase *env)
+{
+	MM_GCCode gcCode = env->_cycleState->_gcCode;
+	return !_majorCollectionRequested && !gcCode.isExplicitGC() && !gcCode.isAggressiveGC();
+}
+
+void
+MM_SegregatedGC::updateMajorCollectionRequest(MM_EnvironmentBase *env, bool minorCollection)
+{
+	if (minorCollection) {
+		/* Objects surviving a minor collection are only reclaimed by a full collection */
+		MM_Heap *heap = _extensions->getHeap();
+		uintptr_t freeBytes = heap->getApproximateActiveFreeMemorySize();
+		uintptr_t activeBytes = heap->getActiveMemorySize();
+		_majorCollectionRequested = (freeBytes < ((activeBytes / 100) * _extensions->segregatedGenerationalMajorFreeRatio));
+	} else {
+		_majorCollectionRequested = false;
+	}
+}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+
 void
 MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
 {
@@ -26,6 +26,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 
+#include "CardTableSegregated.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "GlobalCollector.hpp"
 #include "MarkMap.hpp"
@@ -45,6 +46,10 @@ protected:
 	MM_SegregatedMarkingScheme *_markingScheme;
 	MM_SweepSchemeSegregated *_sweepScheme;
 	MM_Dispatcher *_dispatcher;
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	MM_CardTableSegregated *_cardTable; /**< Remembered set of the mature regions, only created in generational mode */
+	bool _majorCollectionRequested; /**< Set by a minor collection which left too little free memory, so the next collection is a full one */
+#endif /* OMR_GC_HEAP_CARD_TABLE */
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
@@ -73,6 +78,21 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	/**
+	 * In generational mode, decide if the collection being started only collects the nursery.
+	 * Explicit and aggressive (allocation failure escalation) collections are always full collections.
+	 * @return true if this is a minor collection
+	 */
+	bool isMinorCollection(MM_EnvironmentBase *env);
+
+	/**
+	 * Request a full collection next if the survivors of minor collections have filled the heap.
+	 * @param minorCollection true if the collection just completed was a minor collection
+	 */
+	void updateMajorCollectionRequest(MM_EnvironmentBase *env, bool minorCollection);
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -120,6 +140,10 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+		, _cardTable(NULL)
+		, _majorCollectionRequested(false)
+#endif /* OMR_GC_HEAP_CARD_TABLE */
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
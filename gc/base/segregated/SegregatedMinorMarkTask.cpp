@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "CardCleaner.hpp"
+#include "CardTableSegregated.hpp"
+#include "EnvironmentBase.hpp"
+#include "SegregatedMarkingScheme.hpp"
+#include "WorkStack.hpp"
+
+#include "SegregatedMinorMarkTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP) && defined(OMR_GC_HEAP_CARD_TABLE)
+
+void
+MM_SegregatedMinorMarkTask::run(MM_EnvironmentBase *env)
+{
+	env->_workStack.prepareForWork(env, _markingScheme->getWorkPackets());
+
+	_markingScheme->markLiveObjectsInit(env, false);
+	/* the remembered set is another source of roots for the nursery */
+	_cardTable->cleanCardsOfInUseRegions(env, _cardCleaner);
+	_markingScheme->markLiveObjectsRoots(env);
+	_markingScheme->markLiveObjectsScan(env);
+	_markingScheme->markLiveObjectsComplete(env);
+
+	env->_workStack.flush(env);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP && OMR_GC_HEAP_CARD_TABLE */
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDMINORMARKTASK_HPP_)
+#define SEGREGATEDMINORMARKTASK_HPP_
+
+#include "omrcfg.h"
+
+#include "ParallelMarkTask.hpp"
+#include "SegregatedMarkingScheme.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP) && defined(OMR_GC_HEAP_CARD_TABLE)
+
+class MM_CardCleaner;
+class MM_CardTableSegregated;
+class MM_Dispatcher;
+class MM_EnvironmentBase;
+
+/**
+ * Mark task for the minor collection of a generational segregated heap.
+ * The mark map is not cleared, so objects that survived earlier collections stay marked and the
+ * trace stops at them; mature objects on dirty cards are scanned in addition to the roots.
+ * @ingroup GC_Modron_Metronome
+ */
+class MM_SegregatedMinorMarkTask : public MM_ParallelMarkTask
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_SegregatedMarkingScheme *_markingScheme;
+	MM_CardTableSegregated *_cardTable; /**< Remembered set of the mature regions */
+	MM_CardCleaner *_cardCleaner; /**< Scans the marked objects on a dirty card */
+
+/* Methods */
+public:
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_SegregatedMinorMarkTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_SegregatedMarkingScheme *markingScheme, MM_CardTableSegregated *cardTable, MM_CardCleaner *cardCleaner, MM_CycleState *cycleState)
+		: MM_ParallelMarkTask(env, dispatcher, markingScheme, false /* initMarkMap */, cycleState)
+		, _markingScheme(markingScheme)
+		, _cardTable(cardTable)
+		, _cardCleaner(cardCleaner)
+	{
+		_typeId = __FUNCTION__;
+	};
+
+protected:
+private:
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP && OMR_GC_HEAP_CARD_TABLE */
+
+#endif /* SEGREGATEDMINORMARKTASK_HPP_ */
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#ifndef SEGREGATEDWRITEBARRIER_HPP_
+#define SEGREGATEDWRITEBARRIER_HPP_
+
+#include "objectdescription.h"
+
+#include "CardTable.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SlotObject.hpp"
+
+struct OMR_VMThread;
+
+/**
+ * Out-of-line write barrier for the segregated heap. In the absence of other (equivalent inline) write barrier,
+ * this method must be called whenever a child reference is assigned to a parent slot.
+ *
+ * In generational mode this dirties the card of the parent object, so that the next minor collection
+ * scans the parent if it is mature.
+ *
+ * @param omrThread The thread making the assignment of child reference into parent slot
+ * @param parentObject the parent object
+ * @param childObject THe child object reference
+ */
+MMINLINE void
+segregatedWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject)
+{
+#if defined(OMR_GC_SEGREGATED_HEAP) && defined(OMR_GC_HEAP_CARD_TABLE)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->segregatedGenerational && (NULL != childObject)) {
+		extensions->cardTable->dirtyCard(env, parentObject);
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) && defined(OMR_GC_HEAP_CARD_TABLE) */
+}
+
+/**
+ * Convenience method to effect the assignment of a child reference to a parent slot and call
+ * out-of-line write barrier.
+ *
+ * @param omrThread The thread making the assignment of child reference to parent slot
+ * @param parentObject the parent object
+ * @param parentSlot Points to the slot in the parent object that will receive the child reference
+ * @param childObject THe child object reference
+ * @see segregatedWriteBarrier(OMR_VMThread *, omrobjectptr_t, omrobjectptr_t)
+ */
+MMINLINE void
+segregatedWriteBarrierStore(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot, omrobjectptr_t childObject)
+{
+	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+	slotObject.writeReferenceToSlot(childObject);
+
+	segregatedWriteBarrier(omrThread, parentObject, childObject);
+}
+
+#endif /* SEGREGATEDWRITEBARRIER_HPP_ */
@@ -133,7 +133,7 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 void
 MM_SweepSchemeSegregated::preSweep(MM_EnvironmentBase *env)
 {
-	_memoryPool->moveInUseToSweep(env);
+	_memoryPool->moveInUseToSweep(env, _sweepNurseryOnly);
 }
 
 void
@@ -146,6 +146,7 @@ void
 MM_SweepSchemeSegregated::sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region)
 {
 	region->getMemoryPoolACL()->resetCounts();
+	region->setNursery(false);
 
 	switch (region->getRegionType()) {
 
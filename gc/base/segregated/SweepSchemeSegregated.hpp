@@ -53,6 +53,7 @@ protected:
 private:
 	bool _isFixHeapForWalk;
 	bool _clearMarkMapAfterSweep; /**< If a region should be unmarked after it is swept */
+	bool _sweepNurseryOnly; /**< If only the nursery regions should be swept (minor collection of a generational segregated heap) */
 
 	/*
 	 * Function members
@@ -68,6 +69,9 @@ public:
 
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
 	void setClearMarkMapAfterSweep(bool clearMarkMapAfterSweep) { _clearMarkMapAfterSweep = clearMarkMapAfterSweep; }
+
+	bool isSweepNurseryOnly() { return _sweepNurseryOnly; }
+	void setSweepNurseryOnly(bool sweepNurseryOnly) { _sweepNurseryOnly = sweepNurseryOnly; }
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
@@ -86,6 +90,7 @@ protected:
 		,_markMap(markMap)
 		,_isFixHeapForWalk(false)
 		,_clearMarkMapAfterSweep(true)
+		,_sweepNurseryOnly(false)
 	{
 		_typeId = __FUNCTION__;
 	};
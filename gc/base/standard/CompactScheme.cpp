@@ -801,6 +801,12 @@ MM_CompactScheme::addFreeEntry(MM_EnvironmentStandard *env, MM_MemorySubSpace *m
 	}
 }
 
+void
+MM_CompactScheme::addFreeRange(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, void *currentFreeBase, uintptr_t currentFreeSize)
+{
+	addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+}
+
 
 void
 MM_CompactScheme::moveObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &skippedObjectCount)
@@ -227,6 +227,16 @@ protected:
 					uintptr_t currentFreeSize);
 
 	/**
+	 * Add a free entry to the pool state, as addFreeEntry() does. addFreeEntry() is inlined into the
+	 * free list rebuilding of this class; subclasses rebuilding the free lists themselves call this instead.
+	 */
+	void addFreeRange(MM_EnvironmentStandard *env,
+					MM_MemorySubSpace *memorySubSpace,
+					MM_CompactMemoryPoolState *poolState,
+					void *currentFreeBase,
+					uintptr_t currentFreeSize);
+
+	/**
      * Return the page index for an object.
      * long int, always positive (in particular, -1 is an invalid value)
      */
@@ -310,9 +320,9 @@ public:
     void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded);
 	void masterSetupForGC(MM_EnvironmentStandard *env);
     virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive);
-    omrobjectptr_t getForwardingPtr(omrobjectptr_t objectPtr) const;
+    virtual omrobjectptr_t getForwardingPtr(omrobjectptr_t objectPtr) const;
 	void flushPool(MM_EnvironmentStandard *env, MM_CompactMemoryPoolState *freeListState);
-	void fixHeapForWalk(MM_EnvironmentBase *env);
+	virtual void fixHeapForWalk(MM_EnvironmentBase *env);
 	void parallelFixHeapForWalk(MM_EnvironmentBase *env);
 
 	/**
@@ -0,0 +1,432 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "modronbase.h"
+#include "modronopt.h"
+#include "ModronAssertions.h"
+#include "omr.h"
+
+#include <string.h>
+
+#include "ConcurrentSweepGC.hpp"
+#include "ConcurrentSweepScheme.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+
+typedef struct BackgroundSweepThreadInfo {
+	OMR_VM *omrVM;
+	uintptr_t threadID;
+	uintptr_t threadFlags;
+	MM_ConcurrentSweepGC *collector;
+} BackgroundSweepThreadInfo;
+
+#define BACKGROUND_SWEEP_INFO_FLAG_OK 1
+#define BACKGROUND_SWEEP_INFO_FLAG_FAIL 2
+
+extern "C" {
+
+/**
+ * Background sweep thread procedure
+ *
+ * @parm info Address of BackgroundSweepThreadInfo structure
+ */
+int J9THREAD_PROC
+background_sweep_thread_proc(void *info)
+{
+	BackgroundSweepThreadInfo *threadInfo = (BackgroundSweepThreadInfo *)info;
+	MM_ParallelDispatcher *dispatcher = (MM_ParallelDispatcher *)threadInfo->collector->_extensions->dispatcher;
+	OMRPORT_ACCESS_FROM_OMRVM(threadInfo->omrVM);
+
+	uintptr_t rc;
+	omrsig_protect(background_sweep_thread_proc2, info,
+		dispatcher->getSignalHandler(), dispatcher->getSignalHandlerArg(),
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	return 0;
+}
+
+/**
+ * Background sweep thread procedure
+ *
+ * @parm info Address of BackgroundSweepThreadInfo structure
+ * @return return code; always 0
+ */
+uintptr_t
+background_sweep_thread_proc2(OMRPortLibrary* portLib, void *info)
+{
+	BackgroundSweepThreadInfo *threadInfo = (BackgroundSweepThreadInfo *)info;
+	OMR_VM *omrVM = threadInfo->omrVM;
+	uintptr_t threadID = threadInfo->threadID;
+	MM_ConcurrentSweepGC *collector = threadInfo->collector;
+
+	OMR_VMThread *omrThread = MM_EnvironmentBase::attachVMThread(omrVM, "Concurrent Sweep Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	/* Signal that the background sweep thread has started (or not) */
+	threadInfo->threadFlags = NULL != omrThread ? BACKGROUND_SWEEP_INFO_FLAG_OK : BACKGROUND_SWEEP_INFO_FLAG_FAIL;
+	omrthread_monitor_enter(collector->_backgroundSweepMonitor);
+	omrthread_monitor_notify_all(collector->_backgroundSweepMonitor);
+	omrthread_monitor_exit(collector->_backgroundSweepMonitor);
+
+	/* If thread started invoke main entry point */
+	if (NULL != omrThread) {
+		collector->backgroundSweepEntryPoint(omrThread, threadID);
+	}
+
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_ConcurrentSweepGC *
+MM_ConcurrentSweepGC::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepGC *globalGC = (MM_ConcurrentSweepGC *)env->getForge()->allocate(sizeof(MM_ConcurrentSweepGC), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != globalGC) {
+		new(globalGC) MM_ConcurrentSweepGC(env);
+		if (!globalGC->initialize(env)) {
+			globalGC->kill(env);
+			globalGC = NULL;
+		}
+	}
+	return globalGC;
+}
+
+void
+MM_ConcurrentSweepGC::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+/**
+ * Initialize the collector and the state used to control the background sweep threads.
+ * @return true on success, false otherwise
+ */
+bool
+MM_ConcurrentSweepGC::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_ParallelGlobalGC::initialize(env)) {
+		return false;
+	}
+
+	/* Only the concurrent sweep scheme can carry the sweep past the end of the collection */
+	Assert_MM_true(_extensions->concurrentSweep);
+
+	_backgroundSweepThreads = _extensions->concurrentSweepBackground;
+	if (_backgroundSweepThreads > 0) {
+		_backgroundSweepTable = (omrthread_t *)env->getForge()->allocate(_backgroundSweepThreads * sizeof(omrthread_t), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _backgroundSweepTable) {
+			return false;
+		}
+		memset(_backgroundSweepTable, 0, _backgroundSweepThreads * sizeof(omrthread_t));
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_backgroundSweepMonitor, 0, "MM_ConcurrentSweepGC::backgroundSweep")) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_ConcurrentSweepGC::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _backgroundSweepMonitor) {
+		omrthread_monitor_destroy(_backgroundSweepMonitor);
+		_backgroundSweepMonitor = NULL;
+	}
+
+	if (NULL != _backgroundSweepTable) {
+		env->getForge()->free(_backgroundSweepTable);
+		_backgroundSweepTable = NULL;
+	}
+
+	MM_ParallelGlobalGC::tearDown(env);
+}
+
+/**
+ * @copydoc MM_ParallelGlobalGC::collectorStartup()
+ * Starts the background sweep threads once the rest of the collector is up.
+ */
+bool
+MM_ConcurrentSweepGC::collectorStartup(MM_GCExtensionsBase* extensions)
+{
+	bool result = MM_ParallelGlobalGC::collectorStartup(extensions);
+	if (result) {
+		result = initializeBackgroundSweepThreads(extensions);
+	}
+	return result;
+}
+
+/**
+ * @copydoc MM_ParallelGlobalGC::collectorShutdown()
+ * Stops the background sweep threads before the rest of the collector is shut down.
+ */
+void
+MM_ConcurrentSweepGC::collectorShutdown(MM_GCExtensionsBase *extensions)
+{
+	shutdownBackgroundSweepThreads(extensions);
+	MM_ParallelGlobalGC::collectorShutdown(extensions);
+}
+
+/**
+ * Start the background sweep threads.
+ * They are created at minimum priority, so that they only consume cycles the application threads leave idle.
+ * @return true if all requested threads were started, false otherwise
+ */
+bool
+MM_ConcurrentSweepGC::initializeBackgroundSweepThreads(MM_GCExtensionsBase *extensions)
+{
+	if (0 == _backgroundSweepThreads) {
+		return true;
+	}
+
+	uintptr_t threadCount = 0;
+	BackgroundSweepThreadInfo threadInfo;
+	threadInfo.omrVM = extensions->getOmrVM();
+	threadInfo.collector = this;
+
+	omrthread_monitor_enter(_backgroundSweepMonitor);
+	_backgroundSweepRequest = BACKGROUND_SWEEP_WAIT;
+
+	for (threadCount = 0; threadCount < _backgroundSweepThreads; threadCount++) {
+		threadInfo.threadFlags = 0;
+		threadInfo.threadID = threadCount;
+
+		IDATA threadForkResult = createThreadWithCategory(&(_backgroundSweepTable[threadCount]),
+							OMR_OS_STACK_SIZE,
+							J9THREAD_PRIORITY_MIN,
+							0,
+							background_sweep_thread_proc,
+							(void *)&threadInfo,
+							J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+		if (0 != threadForkResult) {
+			break;
+		}
+
+		do {
+			omrthread_monitor_wait(_backgroundSweepMonitor);
+		} while (0 == threadInfo.threadFlags);
+
+		if (BACKGROUND_SWEEP_INFO_FLAG_OK != threadInfo.threadFlags) {
+			break;
+		}
+	}
+	omrthread_monitor_exit(_backgroundSweepMonitor);
+	_backgroundSweepStarted = threadCount;
+
+	return (_backgroundSweepStarted == _backgroundSweepThreads);
+}
+
+/**
+ * Ask all background sweep threads to terminate, and wait until they have.
+ */
+void
+MM_ConcurrentSweepGC::shutdownBackgroundSweepThreads(MM_GCExtensionsBase *extensions)
+{
+	if (_backgroundSweepStarted > 0) {
+		omrthread_monitor_enter(_backgroundSweepMonitor);
+		_backgroundSweepRequest = BACKGROUND_SWEEP_SHUTDOWN;
+		_backgroundSweepShutdownCount = 0;
+		omrthread_monitor_notify_all(_backgroundSweepMonitor);
+		while (_backgroundSweepShutdownCount < _backgroundSweepStarted) {
+			omrthread_monitor_wait(_backgroundSweepMonitor);
+		}
+		omrthread_monitor_exit(_backgroundSweepMonitor);
+	}
+}
+
+/**
+ * Detach a background sweep thread and notify the shutdown requester if it is the last one to exit.
+ */
+void
+MM_ConcurrentSweepGC::shutdownAndExitBackgroundSweepThread(OMR_VMThread *omrThread)
+{
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	omrthread_monitor_enter(_backgroundSweepMonitor);
+	_backgroundSweepShutdownCount += 1;
+	if (_backgroundSweepShutdownCount == _backgroundSweepStarted) {
+		omrthread_monitor_notify(_backgroundSweepMonitor);
+	}
+
+	for (uintptr_t i = 0; i < _backgroundSweepStarted; i++) {
+		if (_backgroundSweepTable[i] == omrthread_self()) {
+			_backgroundSweepTable[i] = 0;
+			break;
+		}
+	}
+
+	/* Exit the monitor and terminate the thread */
+	omrthread_exit(_backgroundSweepMonitor);
+}
+
+/**
+ * Wake the background sweep threads, unless a collection is about to start.
+ */
+void
+MM_ConcurrentSweepGC::resumeBackgroundSweepThreads(MM_EnvironmentBase *env)
+{
+	if (_backgroundSweepStarted > 0) {
+		omrthread_monitor_enter(_backgroundSweepMonitor);
+		if (BACKGROUND_SWEEP_WAIT == _backgroundSweepRequest) {
+			_backgroundSweepRequest = BACKGROUND_SWEEP_SWEEP;
+			omrthread_monitor_notify_all(_backgroundSweepMonitor);
+		}
+		omrthread_monitor_exit(_backgroundSweepMonitor);
+	}
+}
+
+/**
+ * Fetch the current background sweep request, parking the threads if exclusive access is being requested.
+ */
+MM_ConcurrentSweepGC::BackgroundSweepRequest
+MM_ConcurrentSweepGC::getBackgroundSweepRequest(MM_EnvironmentBase *env)
+{
+	BackgroundSweepRequest result;
+
+	omrthread_monitor_enter(_backgroundSweepMonitor);
+	if (env->isExclusiveAccessRequestWaiting()) {
+		if (BACKGROUND_SWEEP_SWEEP == _backgroundSweepRequest) {
+			_backgroundSweepRequest = BACKGROUND_SWEEP_WAIT;
+		}
+	}
+	result = _backgroundSweepRequest;
+	omrthread_monitor_exit(_backgroundSweepMonitor);
+
+	return result;
+}
+
+void
+MM_ConcurrentSweepGC::backgroundSweepEntryPoint(OMR_VMThread *omrThread, uintptr_t threadID)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	BackgroundSweepRequest request = BACKGROUND_SWEEP_WAIT;
+
+	/* Thread not a mutator so identify its type */
+	env->setThreadType(CON_SWEEP_HELPER_THREAD);
+
+	while (BACKGROUND_SWEEP_SHUTDOWN != request) {
+		omrthread_monitor_enter(_backgroundSweepMonitor);
+		while (BACKGROUND_SWEEP_WAIT == (request = _backgroundSweepRequest)) {
+			omrthread_monitor_wait(_backgroundSweepMonitor);
+		}
+		omrthread_monitor_exit(_backgroundSweepMonitor);
+
+		if (BACKGROUND_SWEEP_SHUTDOWN == request) {
+			continue;
+		}
+
+		env->acquireVMAccess();
+		request = getBackgroundSweepRequest(env);
+		if (BACKGROUND_SWEEP_SWEEP == request) {
+			uintptr_t oldVMstate = env->pushVMstate(J9VMSTATE_GC_CONCURRENT_SWEEP);
+			/* Sweep a chunk at a time, stepping aside as soon as a collection wants exclusive access */
+			while ((BACKGROUND_SWEEP_SWEEP == request) && getConcurrentSweepScheme()->sweepNextChunkConcurrently(env)) {
+				request = getBackgroundSweepRequest(env);
+			}
+			env->popVMstate(oldVMstate);
+
+			/* Nothing left to sweep until the next collection */
+			omrthread_monitor_enter(_backgroundSweepMonitor);
+			if (BACKGROUND_SWEEP_SWEEP == _backgroundSweepRequest) {
+				_backgroundSweepRequest = BACKGROUND_SWEEP_WAIT;
+			}
+			request = _backgroundSweepRequest;
+			omrthread_monitor_exit(_backgroundSweepMonitor);
+		}
+		env->releaseVMAccess();
+	}
+
+	shutdownAndExitBackgroundSweepThread(omrThread);
+}
+
+void
+MM_ConcurrentSweepGC::completeConcurrentSweep(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepScheme *concurrentSweep = getConcurrentSweepScheme();
+	if (concurrentSweep->isConcurrentSweepActive()) {
+		concurrentSweep->completeSweep(env, ABOUT_TO_GC);
+	}
+}
+
+void
+MM_ConcurrentSweepGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
+{
+	/* Background sweepers hold no VM access at this point; make sure they stay parked for the collection */
+	if (_backgroundSweepStarted > 0) {
+		omrthread_monitor_enter(_backgroundSweepMonitor);
+		if (BACKGROUND_SWEEP_SWEEP == _backgroundSweepRequest) {
+			_backgroundSweepRequest = BACKGROUND_SWEEP_WAIT;
+		}
+		omrthread_monitor_exit(_backgroundSweepMonitor);
+	}
+
+	/* Finish the previous cycle's sweep so that the heap is walkable before marking starts */
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
+}
+
+void
+MM_ConcurrentSweepGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	MM_ParallelGlobalGC::internalPostCollect(env, subSpace);
+
+	/* Whatever the pause left unswept is handed to the background sweepers */
+	if (getConcurrentSweepScheme()->isConcurrentSweepActive()) {
+		resumeBackgroundSweepThreads(env);
+	}
+}
+
+void
+MM_ConcurrentSweepGC::prepareHeapForWalk(MM_EnvironmentBase *env)
+{
+	completeConcurrentSweep(env);
+	MM_ParallelGlobalGC::prepareHeapForWalk(env);
+}
+
+bool
+MM_ConcurrentSweepGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return getConcurrentSweepScheme()->replenishPoolForAllocate(env, memoryPool, size);
+}
+
+void
+MM_ConcurrentSweepGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	uintptr_t oldVMstate = env->pushVMstate(J9VMSTATE_GC_CONCURRENT_SWEEP);
+	getConcurrentSweepScheme()->payAllocationTax(env, baseSubSpace, allocDescription);
+	env->popVMstate(oldVMstate);
+}
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTSWEEPGC_HPP_)
+#define CONCURRENTSWEEPGC_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "ParallelGlobalGC.hpp"
+
+extern "C" {
+int background_sweep_thread_proc(void *info);
+uintptr_t background_sweep_thread_proc2(OMRPortLibrary* portLib, void *info);
+}
+
+class MM_ConcurrentSweepScheme;
+
+/**
+ * Stop-the-world mark collector whose sweep is deferred until after the collection.
+ * The pause only sweeps enough of the heap to satisfy the allocation that triggered the collection.  The
+ * remainder of the heap is swept lazily by allocating threads (as allocation tax and pool replenishment) and
+ * by low priority background sweep threads, which run between collections.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentSweepGC : public MM_ParallelGlobalGC
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum BackgroundSweepRequest {
+		BACKGROUND_SWEEP_WAIT = 1,
+		BACKGROUND_SWEEP_SWEEP,
+		BACKGROUND_SWEEP_SHUTDOWN
+	};
+
+private:
+	uintptr_t _backgroundSweepThreads; /**< Number of background sweep threads requested */
+	uintptr_t _backgroundSweepStarted; /**< Number of background sweep threads successfully started */
+	uintptr_t _backgroundSweepShutdownCount; /**< Number of background sweep threads which have completed shutdown */
+	omrthread_t *_backgroundSweepTable; /**< Thread handles of the background sweep threads */
+	omrthread_monitor_t _backgroundSweepMonitor; /**< Monitor used to activate, park and shut down the background sweep threads */
+	volatile BackgroundSweepRequest _backgroundSweepRequest; /**< Current request to the background sweep threads */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE MM_ConcurrentSweepScheme *getConcurrentSweepScheme() { return (MM_ConcurrentSweepScheme *)_sweepScheme; }
+
+	bool initializeBackgroundSweepThreads(MM_GCExtensionsBase *extensions);
+	void shutdownBackgroundSweepThreads(MM_GCExtensionsBase *extensions);
+	void resumeBackgroundSweepThreads(MM_EnvironmentBase *env);
+	BackgroundSweepRequest getBackgroundSweepRequest(MM_EnvironmentBase *env);
+	void shutdownAndExitBackgroundSweepThread(OMR_VMThread *omrThread);
+
+	/**
+	 * Finish any sweep work left over from the previous collection.
+	 * @note Expects exclusive access to be held.
+	 */
+	void completeConcurrentSweep(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
+	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+public:
+	static MM_ConcurrentSweepGC *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual bool collectorStartup(MM_GCExtensionsBase* extensions);
+	virtual void collectorShutdown(MM_GCExtensionsBase *extensions);
+
+	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
+
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
+
+	/**
+	 * Main loop of a background sweep thread.
+	 * @param omrThread the attached thread
+	 * @param threadID index of the thread in the background sweep thread table
+	 */
+	void backgroundSweepEntryPoint(OMR_VMThread *omrThread, uintptr_t threadID);
+
+	MM_ConcurrentSweepGC(MM_EnvironmentBase *env)
+		: MM_ParallelGlobalGC(env)
+		, _backgroundSweepThreads(0)
+		, _backgroundSweepStarted(0)
+		, _backgroundSweepShutdownCount(0)
+		, _backgroundSweepTable(NULL)
+		, _backgroundSweepMonitor(NULL)
+		, _backgroundSweepRequest(BACKGROUND_SWEEP_WAIT)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	/*
+	 * Friends
+	 */
+	friend int background_sweep_thread_proc(void *info);
+	friend uintptr_t background_sweep_thread_proc2(OMRPortLibrary* portLib, void *info);
+};
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+#endif /* CONCURRENTSWEEPGC_HPP_ */
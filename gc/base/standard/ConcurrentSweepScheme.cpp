@@ -37,6 +37,7 @@
 #include "Dispatcher.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
 #include "HeapMemoryPoolIterator.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceChildIterator.hpp"
@@ -514,6 +515,7 @@ MM_ConcurrentSweepScheme::initializeChunks(MM_EnvironmentBase *env)
 
 		/* add to the total size of all chunks in pool to be connected */
 		sweepState->_heapSizeToConnect += chunk->size();
+		_stats._totalChunkBytes += chunk->size();
 	} /* end of chunks */
 }
 
@@ -833,6 +835,7 @@ MM_ConcurrentSweepScheme::incrementalSweepChunk(
 	liveObjectFound = sweepChunk(env, chunk);	
 
 	MM_AtomicOperations::add((UDATA *)&_stats._totalChunkSweptCount, 1);
+	MM_AtomicOperations::add((UDATA *)&_stats._totalChunkSweptBytes, chunk->size());
 
 	/* Make sure all sweeping information is flushed to memory before marking the chunk as having been swept.
 	 * This is to avoid having the connector view the chunk as swept without all the data having been commited
@@ -1275,6 +1278,7 @@ MM_ConcurrentSweepScheme::completeSweep(MM_EnvironmentBase* envBase, SweepComple
 
 	/* Report that we have completed concurrent sweep  */
 	reportCompletedConcurrentSweep(env, reason);
+	recordSweepBacklog(env);
 	
 	/* The concurrent sweep has now completed - set mode indicating that it is inactive */
 	_stats.switchMode(concurrentsweep_mode_stw_complete_sweep, concurrentsweep_mode_off);
@@ -1525,6 +1529,7 @@ omrtty_printf("[");
 	}
 
 	_stats.switchMode(concurrentsweep_mode_stw_find_minimum_free_size, concurrentsweep_mode_on);
+	recordSweepBacklog(env);
 
 #if defined(CONCURRENT_SWEEP_TRACE)
 omrtty_printf("]");
@@ -1574,6 +1579,50 @@ MM_ConcurrentSweepScheme::completeSweepingConcurrently(MM_EnvironmentBase *envMo
 	return true;
 }
 
+/**
+ * Sweep (but do not connect) the next unswept chunk of any memory pool.
+ * This is the unit of work for background sweep threads: it can be called repeatedly, with VM access, until it
+ * reports that there is nothing left to sweep, and the caller is free to stop between calls (e.g., to let a
+ * pending exclusive access request through).  Connecting the swept chunks is left to allocating threads.
+ * @return true if a chunk was swept, false if no chunk was left to sweep.
+ */
+bool
+MM_ConcurrentSweepScheme::sweepNextChunkConcurrently(MM_EnvironmentBase *envModron)
+{
+	bool result = false;
+
+	if(isConcurrentSweepActive()) {
+		MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envModron);
+		MM_HeapMemoryPoolIterator poolIterator(envModron, _extensions->heap);
+		MM_MemoryPool *memoryPool;
+		while(!result && (NULL != (memoryPool = poolIterator.nextPool()))) {
+			MM_ConcurrentSweepPoolState *sweepState = (MM_ConcurrentSweepPoolState *)getPoolState(memoryPool);
+			if(!sweepState->_finalFlushed) {
+				result = concurrentSweepNextAvailableChunk(env, sweepState);
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Record the amount of sweep work left outstanding into the global sweep statistics, for verbose reporting.
+ */
+void
+MM_ConcurrentSweepScheme::recordSweepBacklog(MM_EnvironmentBase *env)
+{
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+
+	if(isConcurrentSweepActive()) {
+		sweepStats->sweepBacklogChunks = _stats.getBacklogChunkCount();
+		sweepStats->sweepBacklogBytes = _stats.getBacklogBytes();
+	} else {
+		sweepStats->sweepBacklogChunks = 0;
+		sweepStats->sweepBacklogBytes = 0;
+	}
+}
+
 /**
  * Add to the concurrently sweeping thread pool count.
  * 
@@ -135,6 +135,8 @@ private:
 
 	void calculateApproximateFree(MM_EnvironmentBase* env, MM_MemoryPool *memoryPool, MM_ConcurrentSweepPoolState *sweepState);
 
+	void recordSweepBacklog(MM_EnvironmentBase *env);
+
 protected:
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
@@ -161,6 +163,7 @@ public:
 	virtual void completeSweep(MM_EnvironmentBase* env, SweepCompletionReason reason);
 	virtual bool sweepForMinimumSize(MM_EnvironmentBase *env, MM_MemorySubSpace *baseMemorySubSpace, MM_AllocateDescription *allocateDescription);
 	bool completeSweepingConcurrently(MM_EnvironmentBase *envModron);
+	bool sweepNextChunkConcurrently(MM_EnvironmentBase *envModron);
 
 	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, UDATA size);
 	void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,  MM_AllocateDescription *allocDescriptionn);
@@ -39,8 +39,17 @@ MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *ca
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->cacheListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	Assert_MM_true(0 < extensions->cacheListSplit);
+	_nodeCount = 1;
+	if (extensions->numaAwareGCThreads) {
+		uintptr_t affinityLeaderCount = extensions->_numaManager.getAffinityLeaderCount();
+		if (1 < affinityLeaderCount) {
+			_nodeCount = affinityLeaderCount;
+		}
+	}
+	/* every node owns the same number of sublists */
+	_sublistsPerNode = (extensions->cacheListSplit + _nodeCount - 1) / _nodeCount;
+	_sublistCount = _sublistsPerNode * _nodeCount;
 
 	_sublists = (struct CopyScanCacheSublist *)extensions->getForge()->allocate(sizeof(struct CopyScanCacheSublist) * _sublistCount, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
@@ -317,34 +326,46 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 }
 
 MM_CopyScanCacheStandard *
-MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
+MM_CopyScanCacheList::popCacheFromSublist(MM_EnvironmentBase *env, CopyScanCacheSublist *list)
 {
-	uintptr_t index = getSublistIndex(env);
 	MM_CopyScanCacheStandard *cache = NULL;
 
-	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
-
-		if (NULL != list->_cacheHead) {
-			env->_scavengerStats._acquireListLockCount += 1;
-			list->_cacheLock.acquire();
-			cache = list->_cacheHead;
-			if (NULL != cache) {
-				list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
-				decrementCount(list, 1);
-
-				if (NULL == list->_cacheHead) {
-					Assert_MM_true(0 == list->_entryCount);
-				}
-			}
-			list->_cacheLock.release();
+	if (NULL != list->_cacheHead) {
+		env->_scavengerStats._acquireListLockCount += 1;
+		list->_cacheLock.acquire();
+		cache = list->_cacheHead;
+		if (NULL != cache) {
+			list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
+			decrementCount(list, 1);
 
-			if (NULL != cache) {
-				break;
+			if (NULL == list->_cacheHead) {
+				Assert_MM_true(0 == list->_entryCount);
 			}
 		}
+		list->_cacheLock.release();
+	}
 
-		index = (index + 1) % _sublistCount;
+	return cache;
+}
+
+MM_CopyScanCacheStandard *
+MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
+{
+	uintptr_t index = getSublistIndex(env);
+	uintptr_t nodeBase = index - (index % _sublistsPerNode);
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	/* search the sublists owned by the local node first */
+	for (uintptr_t i = 0; (NULL == cache) && (i < _sublistsPerNode); i++) {
+		cache = popCacheFromSublist(env, &_sublists[nodeBase + ((index - nodeBase + i) % _sublistsPerNode)]);
+	}
+
+	/* local work ran out - steal from the sublists of the other nodes */
+	for (uintptr_t i = _sublistsPerNode; (NULL == cache) && (i < _sublistCount); i++) {
+		cache = popCacheFromSublist(env, &_sublists[(nodeBase + i) % _sublistCount]);
+		if (NULL != cache) {
+			env->_scavengerStats._acquireRemoteNodeListCount += 1;
+		}
 	}
 
 	return cache;
@@ -62,6 +62,8 @@ private:
 	
 	struct CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _nodeCount; /**< the number of NUMA nodes the sublists are partitioned across (1 unless NUMA-aware GC threads are enabled) */
+	uintptr_t _sublistsPerNode; /**< the number of consecutive sublists owned by each node (_sublistCount / _nodeCount) */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -88,8 +90,21 @@ private:
 	 */
 	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
 	{
+		uintptr_t nodeIndex = env->_gcNumaNodeIndex;
+		if ((1 < _nodeCount) && (0 != nodeIndex) && (nodeIndex <= _nodeCount)) {
+			/* threads bound to a node only hash into the sublists owned by that node */
+			return ((nodeIndex - 1) * _sublistsPerNode) + (env->getEnvironmentId() % _sublistsPerNode);
+		}
 		return env->getEnvironmentId() % _sublistCount;
 	}
+
+	/**
+	 * Pop a cache entry from the specified sublist.
+	 * @param env[in] the current GC thread
+	 * @param list[in] the sublist to pop from
+	 * @return the cache entry, or NULL if the sublist is empty
+	 */
+	MM_CopyScanCacheStandard *popCacheFromSublist(MM_EnvironmentBase *env, CopyScanCacheSublist *list);
 	
 	/**
 	 * Increment the sublist counter by the specified amount
@@ -176,6 +191,8 @@ public:
 
 	/**
 	 * Pop a cache entry from this list.
+	 * The sublists of the NUMA node the thread is bound to are searched first, and the sublists
+	 * of other nodes are only searched once no local entry is left.
 	 * @param env[in] the current GC thread
 	 * @return the cache entry, or NULL if the list is empty
 	 */
@@ -189,6 +206,8 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _nodeCount(1)
+		, _sublistsPerNode(0)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
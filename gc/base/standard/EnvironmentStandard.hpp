@@ -53,6 +53,7 @@ public:
 	MM_CopyScanCacheStandard *_deferredCopyCache; /**< a copy cache about to be pushed to scan queue, but before that may be merged with some other caches that collectively form contiguous memory */
 	MM_CopyScanCacheStandard *_tenureCopyScanCache; /**< the current copy cache for tenuring */
 	MM_CopyScanCacheStandard *_effectiveCopyScanCache; /**< the the copy cache the received the most recently copied object, or NULL if no object copied in copy() */
+	uintptr_t _hotFieldCopyDepth; /**< the number of hot field referents currently being copied depth-first (nested in copy()) by this thread */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	J9VMGC_SublistFragment _scavengerRememberedSet;
 #endif
@@ -83,6 +84,7 @@ public:
 		,_deferredCopyCache(NULL)
 		,_tenureCopyScanCache(NULL)
 		,_effectiveCopyScanCache(NULL)
+		,_hotFieldCopyDepth(0)
 		,_tenureTLHRemainderBase(NULL)
 		,_tenureTLHRemainderTop(NULL)
 		,_loaAllocation(false)
@@ -34,6 +34,7 @@
 #include "CollectorLanguageInterface.hpp"
 #if defined(OMR_GC_MODRON_COMPACTION)
 #include "CompactScheme.hpp"
+#include "SlidingCompactScheme.hpp"
 #endif /* OMR_GC_MODRON_COMPACTION */
 #include "Configuration.hpp"
 #include "CycleState.hpp"
@@ -238,7 +239,15 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
 #if defined(OMR_GC_MODRON_COMPACTION)
-	_compactScheme = MM_CompactScheme::newInstance(env, _markingScheme);
+#if !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+	/* The sliding compactor derives forwarding addresses from object sizes before the move, so objects must not grow */
+	if (_extensions->parallelSlidingCompact) {
+		_compactScheme = MM_SlidingCompactScheme::newInstance(env, _markingScheme);
+	} else
+#endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+	{
+		_compactScheme = MM_CompactScheme::newInstance(env, _markingScheme);
+	}
 	if(NULL == _compactScheme) {
 		goto error_no_memory;
 	}
@@ -426,7 +435,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	 */
 	if (_delegate.isAllowUserHeapWalk() || env->_cycleState->_gcCode.isRASDumpGC()) {
 		if (!_fixHeapForWalkCompleted) {
-#if defined(J9VM_GC_MODRON_COMPACTION)
+#if defined(OMR_GC_MODRON_COMPACTION)
 			if (compactedThisCycle) {
 				OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 				U_64 startTime = omrtime_hires_clock();
@@ -434,7 +443,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 				_extensions->globalGCStats.fixHeapForWalkTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 				_extensions->globalGCStats.fixHeapForWalkReason = FIXUP_DEBUG_TOOLING;
 			} else
-#endif /* J9VM_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_COMPACTION */
 			{
 				fixHeapForWalk(env, MEMORY_TYPE_RAM, FIXUP_DEBUG_TOOLING, fixObject);
 			}
@@ -35,6 +35,7 @@
 #include "Heap.hpp"
 #include "HeapMemoryPoolIterator.hpp"
 #include "HeapLinkedFreeHeader.hpp"
+#include "HeapMapScan.hpp"
 #include "MemoryPool.hpp"
 #include "MemoryPoolAddressOrderedList.hpp"
 #include "MemorySpace.hpp"
@@ -45,6 +46,7 @@
 #include "SweepHeapSectioningSegmented.hpp"
 #include "SweepPoolManagerAddressOrderedList.hpp"
 #include "SweepPoolState.hpp"
+#include "WorkStealingDeque.hpp"
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
 #include "HeapMapWordIterator.hpp"
@@ -144,6 +146,16 @@ MM_ParallelSweepTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentB
 
 	return result;
 }
+
+/**
+ * Stats gathering for chunks stolen from other threads during sweep.
+ */
+void
+MM_ParallelSweepTask::recordStealStats(MM_EnvironmentBase *env, uintptr_t stealAttempts, uintptr_t steals)
+{
+	env->_sweepStats.sweepStealAttempts += stealAttempts;
+	env->_sweepStats.sweepChunksStolen += steals;
+}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 /**
@@ -341,14 +353,8 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		/* Skip the remainder of the free run in bulk */
+		markMapCurrent = MM_HeapMapScan::findNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -518,11 +524,23 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 		/* Check if the map slot is part of a candidate free list entry */
 		sweepMarkMapBody(markMapCurrent, markMapChunkTop, markMapFreeHead, heapSlotFreeCount, heapSlotFreeCurrent, heapSlotFreeHead);
 		if (0 == heapSlotFreeCount) {
-			darkMatterCandidates += 1;
-			if (0 == (darkMatterCandidates % darkMatterSampleRate)) {
-				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent, heapSlotFreeCurrent);
+			/* None of the map slots up to the next empty one can yield a free entry - skip the run in bulk,
+			 * sampling the map slots that fall on the dark matter sample rate along the way.
+			 */
+			uintptr_t *markMapRunTop = MM_HeapMapScan::findEmptySlot(markMapCurrent + 1, markMapChunkTop);
+			uintptr_t runLength = markMapRunTop - markMapCurrent;
+			uintptr_t nextSample = darkMatterSampleRate - (darkMatterCandidates % darkMatterSampleRate);
+			while (nextSample <= runLength) {
+				uintptr_t sampleIndex = nextSample - 1;
+				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent + sampleIndex, heapSlotFreeCurrent + (J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * sampleIndex));
 				darkMatterSamples += 1;
+				nextSample += darkMatterSampleRate;
 			}
+			darkMatterCandidates += runLength;
+
+			/* Position on the last map slot of the run; it is stepped over below */
+			markMapCurrent += runLength - 1;
+			heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * (runLength - 1);
 		} else {
 			/* There is at least a single free slot in the mark map - check the head and tail */
 			sweepMarkMapHead(markMapFreeHead, markMapChunkBase, heapSlotFreeHead, heapSlotFreeCount);
@@ -594,6 +612,72 @@ MM_ParallelSweepScheme::prepareAllChunks(MM_EnvironmentBase *env)
 	return _sweepHeapSectioning->reassignChunks(env);
 }
 
+/**
+ * Sweep a single chunk on behalf of the current thread.
+ * Flushes the thread local free entry stats whenever the chunk belongs to a different memory pool
+ * than the previously swept chunk.
+ *
+ * @param chunk the chunk to sweep
+ * @param prevChunk the chunk previously swept by this thread, or NULL if this is the first one
+ */
+void
+MM_ParallelSweepScheme::sweepChunkForThread(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_ParallelSweepChunk *prevChunk)
+{
+	/* if we are changing memory pool, flush the thread local stats to appropriate (previous) pool */
+	if ((NULL != prevChunk) && (prevChunk->memoryPool != chunk->memoryPool)) {
+		prevChunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+
+	/* if we are starting or changing memory pool, setup frequent allocation sizes in free entry stats for the pool we are about to sweep */
+	if ((NULL == prevChunk) || (prevChunk->memoryPool != chunk->memoryPool)) {
+		MM_MemoryPool *topLevelMemoryPool = chunk->memoryPool->getParent();
+		if (NULL == topLevelMemoryPool) {
+			topLevelMemoryPool = chunk->memoryPool;
+		}
+		env->_freeEntrySizeClassStats.initializeFrequentAllocation(topLevelMemoryPool->getLargeObjectAllocateStats());
+	}
+
+	/* Sweep the chunk */
+	sweepChunk(env, chunk);
+}
+
+/**
+ * Distribute all chunks to the work-stealing deques of the threads participating in the sweep.
+ * Each thread receives a contiguous range of chunks so that, in the absence of imbalance, threads
+ * sweep disjoint areas of the heap; threads that run out of chunks steal from the others.
+ * @note Must be called by a single thread while all other threads are synchronized
+ *
+ * @param totalChunkCount total number of chunks to be swept
+ * @return true if the chunks were queued, false if the sweep must use the shared work unit index instead
+ */
+bool
+MM_ParallelSweepScheme::queueAllChunksForStealing(MM_EnvironmentBase *env, uintptr_t totalChunkCount)
+{
+	MM_Task *task = env->_currentTask;
+	uintptr_t threadCount = task->getThreadCount();
+	MM_WorkStealingDeque *firstDeque = task->getWorkStealingDeque(0);
+
+	if ((NULL == firstDeque) || (1 == threadCount) || (0 == totalChunkCount)) {
+		return false;
+	}
+
+	uintptr_t chunksPerThread = (totalChunkCount + threadCount - 1) / threadCount;
+	if (chunksPerThread > firstDeque->getCapacity()) {
+		return false;
+	}
+
+	MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+	for (uintptr_t chunkNum = 0; chunkNum < totalChunkCount; chunkNum++) {
+		MM_ParallelSweepChunk *chunk = sectioningIterator.nextChunk();
+		Assert_MM_true(NULL != chunk);  /* Should never return NULL */
+
+		bool pushed = task->getWorkStealingDeque(chunkNum / chunksPerThread)->push(chunk);
+		Assert_MM_true(pushed);
+	}
+
+	return true;
+}
+
 /**
  * Sweep all chunks.
  * 
@@ -608,44 +692,54 @@ MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalC
 
 	MM_ParallelSweepChunk *chunk = NULL;
 	MM_ParallelSweepChunk *prevChunk = NULL;
-	MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
 
-	for (uintptr_t chunkNum = 0; chunkNum < totalChunkCount; chunkNum++) {
-		
-		chunk = sectioningIterator.nextChunk();
-			
-		Assert_MM_true (chunk != NULL);  /* Should never return NULL */
-		
-		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-			
-#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)                           
-			chunksProcessed += 1;
-#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
- 
- 			/* if we are changing memory pool, flush the thread local stats to appropriate (previous) pool */
-			if ((NULL != prevChunk) && (prevChunk->memoryPool != chunk->memoryPool)) {
-				prevChunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
-			}
+	if (_chunksQueuedForStealing) {
+		MM_WorkStealingDeque *deque = env->_currentTask->getWorkStealingDeque(env->getSlaveID());
 
- 			/* if we are starting or changing memory pool, setup frequent allocation sizes in free entry stats for the pool we are about to sweep */
-			if ((NULL == prevChunk) || (prevChunk->memoryPool != chunk->memoryPool)) {
-				MM_MemoryPool *topLevelMemoryPool = chunk->memoryPool->getParent();
-				if (NULL == topLevelMemoryPool) {
-					topLevelMemoryPool = chunk->memoryPool;
+		while (true) {
+			chunk = (MM_ParallelSweepChunk *)deque->pop();
+			if (NULL == chunk) {
+				/* No chunks are created during the sweep, so once stealing fails all deques are drained */
+				chunk = (MM_ParallelSweepChunk *)env->_currentTask->stealWork(env);
+				if (NULL == chunk) {
+					break;
 				}
-				env->_freeEntrySizeClassStats.initializeFrequentAllocation(topLevelMemoryPool->getLargeObjectAllocateStats());
 			}
- 
-        	/* Sweep the chunk */
-			sweepChunk(env, chunk);
 
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			chunksProcessed += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+			sweepChunkForThread(env, chunk, prevChunk);
 			prevChunk = chunk;
-		}	
+		}
+	} else {
+		MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+
+		for (uintptr_t chunkNum = 0; chunkNum < totalChunkCount; chunkNum++) {
+
+			chunk = sectioningIterator.nextChunk();
+
+			Assert_MM_true (chunk != NULL);  /* Should never return NULL */
+
+			if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				chunksProcessed += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+				sweepChunkForThread(env, chunk, prevChunk);
+				prevChunk = chunk;
+			}
+		}
 	}
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_sweepStats.sweepChunksProcessed = chunksProcessed;
 	env->_sweepStats.sweepChunksTotal = totalChunkCount;
+	if (_chunksQueuedForStealing) {
+		env->_sweepStats.sweepChunksDequeued = chunksProcessed;
+	}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	
 	/* flush the remaining stats (since the the last pool switch) */
@@ -767,6 +861,7 @@ MM_ParallelSweepScheme::internalSweep(MM_EnvironmentBase *env)
 		_extensions->heap->resetLargestFreeEntry();
 		
 		_chunksPrepared = prepareAllChunks(env);
+		_chunksQueuedForStealing = queueAllChunksForStealing(env, _chunksPrepared);
 		
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
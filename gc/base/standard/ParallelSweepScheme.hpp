@@ -72,6 +72,7 @@ public:
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
 	virtual bool synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, const char *id);
 	virtual bool synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id);
+	virtual void recordStealStats(MM_EnvironmentBase *env, uintptr_t stealAttempts, uintptr_t steals);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	/**
@@ -96,6 +97,7 @@ class MM_ParallelSweepScheme : public MM_BaseVirtual
 	 */
 private:
 	uintptr_t _chunksPrepared; 
+	bool _chunksQueuedForStealing; /**< true if the prepared chunks were distributed to the GC threads' work-stealing deques */
 
 protected:
 	MM_GCExtensionsBase *_extensions;
@@ -127,7 +129,9 @@ protected:
 	void sweepMarkMapTail(uintptr_t *markMapCurrent, uintptr_t *markMapChunkTop, uintptr_t &heapSlotFreeCount);
 
 	bool sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *sweepChunk);
+	void sweepChunkForThread(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_ParallelSweepChunk *prevChunk);
 	void sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
+	bool queueAllChunksForStealing(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
 	uintptr_t prepareAllChunks(MM_EnvironmentBase *env);
 	
 	virtual void connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
@@ -217,6 +221,7 @@ public:
 	MM_ParallelSweepScheme(MM_EnvironmentBase *env)
 		: MM_BaseVirtual()
 		, _chunksPrepared(0)
+		, _chunksQueuedForStealing(false)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
 		, _currentMarkMap(NULL)
@@ -105,6 +105,9 @@
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
+/* number of optimally sized copy caches a NUMA node copy chunk is refilled with */
+#define NODE_COPY_CHUNK_CACHE_COUNT 8
+
 /* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
  * a quick implementation
  */
@@ -225,6 +228,26 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* threads bound to a NUMA node copy into survivor and tenure chunks private to their node */
+	if (_extensions->numaAwareGCThreads && !IS_CONCURRENT_ENABLED) {
+		uintptr_t affinityLeaderCount = _extensions->_numaManager.getAffinityLeaderCount();
+		if (1 < affinityLeaderCount) {
+			uintptr_t chunkArraySize = sizeof(NodeCopyChunk) * affinityLeaderCount * 2;
+			_survivorNodeChunks = (NodeCopyChunk *)_extensions->getForge()->allocate(chunkArraySize, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _survivorNodeChunks) {
+				return false;
+			}
+			memset((void *)_survivorNodeChunks, 0, chunkArraySize);
+			_tenureNodeChunks = _survivorNodeChunks + affinityLeaderCount;
+			_nodeCopyChunkCount = affinityLeaderCount;
+			for (uintptr_t i = 0; i < (affinityLeaderCount * 2); i++) {
+				if (!_survivorNodeChunks[i]._lock.initialize(env, &_extensions->lnrlOptions, "MM_Scavenger:_nodeCopyChunks[]._lock")) {
+					return false;
+				}
+			}
+		}
+	}
+
 	if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_Scavenger::scanCacheMonitor")) {
 		return false;
 	}
@@ -285,6 +308,16 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _survivorNodeChunks) {
+		for (uintptr_t i = 0; i < (_nodeCopyChunkCount * 2); i++) {
+			_survivorNodeChunks[i]._lock.tearDown();
+		}
+		_extensions->getForge()->free(_survivorNodeChunks);
+		_survivorNodeChunks = NULL;
+		_tenureNodeChunks = NULL;
+		_nodeCopyChunkCount = 0;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -683,6 +716,7 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_backout |= scavStats->_backout;
 	finalGCStats->_tenureAggregateCount += scavStats->_tenureAggregateCount;
 	finalGCStats->_tenureAggregateBytes += scavStats->_tenureAggregateBytes;
+	finalGCStats->_hotFieldCopyCount += scavStats->_hotFieldCopyCount;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 	finalGCStats->_tenureLOACount += scavStats->_tenureLOACount;
 	finalGCStats->_tenureLOABytes += scavStats->_tenureLOABytes;
@@ -702,6 +736,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_acquireScanListCount += scavStats->_acquireScanListCount;
 	finalGCStats->_releaseScanListCount += scavStats->_releaseScanListCount;
 	finalGCStats->_acquireListLockCount += scavStats->_acquireListLockCount;
+	finalGCStats->_acquireRemoteNodeListCount += scavStats->_acquireRemoteNodeListCount;
+	finalGCStats->_nodeLocalCopyCacheCount += scavStats->_nodeLocalCopyCacheCount;
 	finalGCStats->_aliasToCopyCacheCount += scavStats->_aliasToCopyCacheCount;
 	finalGCStats->_arraySplitCount += scavStats->_arraySplitCount;
 	finalGCStats->_arraySplitAmount += scavStats->_arraySplitAmount;
@@ -947,7 +983,11 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				bool satisfiedInLOA = false;
+				allocateResult = allocateFromNodeCopyChunk(env, _survivorNodeChunks, _survivorMemorySubSpace, cacheSize, scanCacheSize, addrBase, addrTop, satisfiedInLOA);
+				if (!allocateResult) {
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1055,13 +1095,16 @@ MM_Scavenger::reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env,
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				allocDescription.setCollectorAllocateExpandOnFailure(true);
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				allocateResult = allocateFromNodeCopyChunk(env, _tenureNodeChunks, _tenureMemorySubSpace, cacheSize, scanCacheSize, addrBase, addrTop, satisfiedInLOA);
+				if (!allocateResult) {
+					allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
-				if (allocateResult && allocDescription.isLOAAllocation()) {
-					satisfiedInLOA = true;
-				}
+					if (allocateResult && allocDescription.isLOAAllocation()) {
+						satisfiedInLOA = true;
+					}
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
+				}
 				env->_scavengerStats._tenureSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1448,6 +1491,17 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 			scavStats->_flipBytes += objectCopySizeInBytes;
 			scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
 		}
+
+		if (_extensions->scavengerHotFieldCopyDepthFirst && (env->_hotFieldCopyDepth < _extensions->scavengerHotFieldCopyMaxDepth)) {
+			bool copiedToTenure = (0 != (copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_TENURESPACE));
+			if (0 != copyHotFieldReferents(env, destinationObjectPtr)) {
+				/* copyCache may have been released (or even reused) while copying the referents, so report the
+				 * copy cache currently receiving objects in the same space for the aliasing check of the caller */
+				env->_effectiveCopyScanCache = copiedToTenure ? env->_tenureCopyScanCache : env->_survivorCopyScanCache;
+			} else {
+				env->_effectiveCopyScanCache = copyCache;
+			}
+		}
 	} else {
 		/* We have not used the reserved space now, but we will for subsequent allocations. If this space was reserved for an individual object,
 		 * we might have created a TLH remainder from previous cache just before reserving this space. This space eventaully can create another remainder.
@@ -1467,6 +1521,44 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 	return destinationObjectPtr;
 }
 
+uintptr_t
+MM_Scavenger::copyHotFieldReferents(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	uintptr_t copiedCount = 0;
+	GC_ObjectScannerState objectScannerState;
+	GC_ObjectScanner *objectScanner = getObjectScanner(env, objectPtr, &objectScannerState, GC_ObjectScanner::scanHeap);
+
+	if ((NULL != objectScanner) && !objectScanner->isLeafObject() && !objectScanner->isIndexableObject()) {
+		uintptr_t hotFieldsDescriptor = objectScanner->getHotFieldsDescriptor();
+		if (0 != hotFieldsDescriptor) {
+			fomrobject_t *firstSlot = (fomrobject_t *)((uintptr_t)objectPtr + _extensions->objectModel.getHeaderSize(objectPtr));
+			GC_SlotObject *slotObject = NULL;
+
+			env->_hotFieldCopyDepth += 1;
+			while (NULL != (slotObject = objectScanner->getNextSlot())) {
+				/* slots are presented in increasing address order, so no hot slot follows once the descriptor is exhausted */
+				uintptr_t slotIndex = (uintptr_t)(slotObject->readAddressFromSlot() - firstSlot);
+				if (slotIndex >= (sizeof(hotFieldsDescriptor) * 8)) {
+					break;
+				}
+				if (0 != ((hotFieldsDescriptor >> slotIndex) & 1)) {
+					omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+					if ((NULL != referent) && isObjectInEvacuateMemory(referent)) {
+						copyAndForward(env, slotObject);
+						if (NULL != env->_effectiveCopyScanCache) {
+							copiedCount += 1;
+						}
+					}
+				}
+			}
+			env->_hotFieldCopyDepth -= 1;
+			env->_scavengerStats._hotFieldCopyCount += copiedCount;
+		}
+	}
+
+	return copiedCount;
+}
+
 /****************************************
  * Object scan and copy routines
  ****************************************
@@ -2082,6 +2174,14 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 	addCopyCachesToFreeList(env);
 	abandonTLHRemainders(env);
 
+	/* node copy chunks are shared by all threads of a node, so return them once every thread is done copying */
+	if (NULL != _survivorNodeChunks) {
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+			abandonNodeCopyChunks(env);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	}
+
 	/* If -Xgc:fvtest=forceScavengerBackout has been specified, set backout flag every 3rd scavenge */
 	if(_extensions->fvtest_forceScavengerBackout) {
 		if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
@@ -2937,6 +3037,78 @@ MM_Scavenger::abandonTLHRemainders(MM_EnvironmentStandard *env)
 	abandonTenureTLHRemainder(env);
 }
 
+bool
+MM_Scavenger::allocateFromNodeCopyChunk(MM_EnvironmentStandard *env, NodeCopyChunk *nodeChunks, MM_MemorySubSpace *subSpace, uintptr_t cacheSize, uintptr_t scanCacheSize, void *&addrBase, void *&addrTop, bool &satisfiedInLOA)
+{
+	uintptr_t nodeIndex = env->_gcNumaNodeIndex;
+	bool result = false;
+
+	if ((NULL != nodeChunks) && (0 != nodeIndex) && (nodeIndex <= _nodeCopyChunkCount)) {
+		NodeCopyChunk *chunk = &nodeChunks[nodeIndex - 1];
+
+		chunk->_lock.acquire();
+		if (((uintptr_t)chunk->_top - (uintptr_t)chunk->_base) < cacheSize) {
+			/* the chunk is used up - return what is left of it and refill it from the subspace */
+			abandonNodeCopyChunk(env, chunk, subSpace);
+
+			MM_AllocateDescription allocDescription(0, 0, false, true);
+			allocDescription.setCollectorAllocateExpandOnFailure(subSpace == _tenureMemorySubSpace);
+			void *chunkBase = NULL;
+			void *chunkTop = NULL;
+			if (NULL != subSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize * NODE_COPY_CHUNK_CACHE_COUNT, chunkBase, chunkTop)) {
+				chunk->_base = chunkBase;
+				chunk->_top = chunkTop;
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+				chunk->_loa = allocDescription.isLOAAllocation();
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+			}
+		}
+
+		uintptr_t chunkRemaining = (uintptr_t)chunk->_top - (uintptr_t)chunk->_base;
+		if (chunkRemaining >= cacheSize) {
+			uintptr_t copyCacheSize = OMR_MIN(OMR_MAX(scanCacheSize, cacheSize), chunkRemaining);
+			addrBase = chunk->_base;
+			addrTop = (void *)((uintptr_t)addrBase + copyCacheSize);
+			satisfiedInLOA = chunk->_loa;
+			chunk->_base = addrTop;
+			result = true;
+		}
+		chunk->_lock.release();
+
+		if (result) {
+			env->_scavengerStats._nodeLocalCopyCacheCount += 1;
+		}
+	}
+
+	return result;
+}
+
+void
+MM_Scavenger::abandonNodeCopyChunk(MM_EnvironmentStandard *env, NodeCopyChunk *chunk, MM_MemorySubSpace *subSpace)
+{
+	if (chunk->_base < chunk->_top) {
+		uintptr_t discardBytes = (uintptr_t)chunk->_top - (uintptr_t)chunk->_base;
+		if (subSpace == _tenureMemorySubSpace) {
+			env->_scavengerStats._tenureDiscardBytes += discardBytes;
+		} else {
+			env->_scavengerStats._flipDiscardBytes += discardBytes;
+		}
+		subSpace->abandonHeapChunk(chunk->_base, chunk->_top);
+	}
+	chunk->_base = NULL;
+	chunk->_top = NULL;
+	chunk->_loa = false;
+}
+
+void
+MM_Scavenger::abandonNodeCopyChunks(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; i < _nodeCopyChunkCount; i++) {
+		abandonNodeCopyChunk(env, &_survivorNodeChunks[i], _survivorMemorySubSpace);
+		abandonNodeCopyChunk(env, &_tenureNodeChunks[i], _tenureMemorySubSpace);
+	}
+}
+
 void
 MM_Scavenger::addCopyCachesToFreeList(MM_EnvironmentStandard *env)
 {
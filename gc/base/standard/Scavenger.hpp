@@ -38,6 +38,7 @@
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
+#include "LightweightNonReentrantLock.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MasterGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
@@ -101,6 +102,22 @@ private:
 
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
+
+	/**
+	 * A chunk of survivor or tenure memory that the GC threads bound to one NUMA node carve their copy caches from,
+	 * so that the objects copied by the threads of a node are kept together in memory touched by that node.
+	 */
+	struct NodeCopyChunk {
+		MM_LightweightNonReentrantLock _lock; /**< Lock for carving caches out of and refilling the chunk */
+		void *_base; /**< Start of the unused part of the chunk (NULL if there is no chunk) */
+		void *_top; /**< End of the chunk */
+		bool _loa; /**< True if the chunk was satisfied in the LOA (tenure chunks only) */
+	};
+
+	NodeCopyChunk *_survivorNodeChunks; /**< survivor copy chunk of each NUMA node, NULL unless numaAwareGCThreads is set and there is more than one node */
+	NodeCopyChunk *_tenureNodeChunks; /**< tenure copy chunk of each NUMA node, NULL unless numaAwareGCThreads is set and there is more than one node */
+	uintptr_t _nodeCopyChunkCount; /**< the number of NUMA nodes with copy chunks */
+
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
@@ -213,6 +230,17 @@ public:
 
 	MMINLINE omrobjectptr_t copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader);
 
+	/**
+	 * Copy the referents of the hot fields of a freshly copied object, so that they are placed immediately
+	 * after their parent (depth-first) rather than in breadth-first scan order. Hot fields are declared
+	 * by the language through the hot fields descriptor of the object scanner (bit n set if the nth slot
+	 * following the object header is hot).
+	 * @param env[in] the current GC thread
+	 * @param objectPtr[in] the new location of the object that was just copied
+	 * @return the number of referents copied
+	 */
+	uintptr_t copyHotFieldReferents(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -353,6 +381,34 @@ public:
 	 */
 	bool clearCache(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *cache);
 
+	/**
+	 * Carve a copy cache out of the survivor or tenure chunk of the NUMA node the thread is bound to.
+	 * The chunk is refilled from the subspace when it is too small for the request.
+	 * @param env[in] the current GC thread
+	 * @param nodeChunks[in] the survivor or tenure chunks of the nodes
+	 * @param subSpace[in] the subspace the chunks are refilled from
+	 * @param cacheSize[in] the minimum size of the copy cache
+	 * @param scanCacheSize[in] the optimum size of the copy cache
+	 * @param addrBase[out] the base of the copy cache
+	 * @param addrTop[out] the top of the copy cache
+	 * @param satisfiedInLOA[out] set to true if the copy cache is in the LOA
+	 * @return true if a copy cache was carved out, false if the thread is not bound to a node or the chunk could not be refilled
+	 */
+	bool allocateFromNodeCopyChunk(MM_EnvironmentStandard *env, NodeCopyChunk *nodeChunks, MM_MemorySubSpace *subSpace, uintptr_t cacheSize, uintptr_t scanCacheSize, void *&addrBase, void *&addrTop, bool &satisfiedInLOA);
+
+	/**
+	 * Return the unused part of a node copy chunk to its subspace.
+	 * @param env[in] the current GC thread
+	 * @param chunk[in] the chunk to abandon
+	 * @param subSpace[in] the subspace the chunk was allocated from
+	 */
+	void abandonNodeCopyChunk(MM_EnvironmentStandard *env, NodeCopyChunk *chunk, MM_MemorySubSpace *subSpace);
+
+	/**
+	 * Called by a single thread at the end of GC, once no thread copies anymore, to abandon the node copy chunks of all nodes
+	 */
+	void abandonNodeCopyChunks(MM_EnvironmentStandard *env);
+
 	/**
 	 * Called (typically at the end of GC) to explicitly abandon the TLH remainders (for the calling thread)
 	 */
@@ -757,6 +813,9 @@ public:
 		, _minSemiSpaceFailureSize(UDATA_MAX)
 		, _cycleState()
 		, _collectionStatistics()
+		, _survivorNodeChunks(NULL)
+		, _tenureNodeChunks(NULL)
+		, _nodeCopyChunkCount(0)
 		, _cachedEntryCount(0)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
@@ -0,0 +1,516 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+#include "SlidingCompactScheme.hpp"
+
+#include "ModronAssertions.h"
+
+#include "AtomicOperations.hpp"
+#include "Bits.hpp"
+#include "CompactSchemeFixupObject.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentStandard.hpp"
+#include "Heap.hpp"
+#include "HeapMapIterator.hpp"
+#include "HeapMapWordIterator.hpp"
+#include "HeapMemoryPoolIterator.hpp"
+#include "HeapRegionDescriptorStandard.hpp"
+#include "HeapRegionIteratorStandard.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "ObjectModel.hpp"
+#include "ParallelTask.hpp"
+
+/**
+ * Allocate and initialize a new instance of the receiver.
+ * @return a new instance of the receiver, or NULL on failure.
+ */
+MM_SlidingCompactScheme *
+MM_SlidingCompactScheme::newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme)
+{
+	MM_SlidingCompactScheme *compactScheme;
+
+	compactScheme = (MM_SlidingCompactScheme *)env->getForge()->allocate(sizeof(MM_SlidingCompactScheme), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (compactScheme) {
+		new(compactScheme) MM_SlidingCompactScheme(env, markingScheme);
+		if (!compactScheme->initialize(env)) {
+			compactScheme->kill(env);
+			compactScheme = NULL;
+		}
+	}
+
+	return compactScheme;
+}
+
+bool
+MM_SlidingCompactScheme::initialize(MM_EnvironmentBase *env)
+{
+	return MM_CompactScheme::initialize(env);
+}
+
+void
+MM_SlidingCompactScheme::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _summaryTable) {
+		env->getForge()->free(_summaryTable);
+		_summaryTable = NULL;
+		_summaryTableSize = 0;
+	}
+	if (NULL != _groupTable) {
+		env->getForge()->free(_groupTable);
+		_groupTable = NULL;
+		_groupTableSize = 0;
+	}
+	MM_CompactScheme::tearDown(env);
+}
+
+bool
+MM_SlidingCompactScheme::masterSetupGroups(MM_EnvironmentStandard *env, bool singleGroupPerRegion)
+{
+	MM_Heap *heap = _extensions->heap;
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	uintptr_t groupAlignment = OMR_MAX(_extensions->heapAlignment, (uintptr_t)block_size);
+
+	/* The summary table covers the whole reserved heap range, so that it never needs to grow with the heap */
+	if (NULL == _summaryTable) {
+		uintptr_t summaryTableSize = MM_Math::roundToCeiling(block_size, (uintptr_t)heap->getHeapTop() - (uintptr_t)heap->getHeapBase()) / block_size;
+		_summaryTable = (SummaryEntry *)env->getForge()->allocate(summaryTableSize * sizeof(SummaryEntry), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _summaryTable) {
+			return false;
+		}
+		_summaryTableSize = summaryTableSize;
+	}
+
+	/* Count the groups needed for the committed regions, and grow the group table if required */
+	uintptr_t groupCount = 0;
+	GC_HeapRegionIteratorStandard countIterator(heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	while (NULL != (region = countIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		uintptr_t groupsInRegion = 1;
+		if (!singleGroupPerRegion) {
+			groupsInRegion = OMR_MAX(1, OMR_MIN(threadCount * SLIDING_COMPACT_GROUPS_PER_THREAD, region->getSize() / SLIDING_COMPACT_MINIMUM_GROUP_SIZE));
+		}
+		groupCount += groupsInRegion;
+	}
+
+	if (groupCount > _groupTableSize) {
+		CompactGroup *groupTable = (CompactGroup *)env->getForge()->allocate(groupCount * sizeof(CompactGroup), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == groupTable) {
+			return false;
+		}
+		if (NULL != _groupTable) {
+			env->getForge()->free(_groupTable);
+		}
+		_groupTable = groupTable;
+		_groupTableSize = groupCount;
+	}
+
+	masterSetupForGC(env);
+	_compactFrom = (omrobjectptr_t)heap->getHeapBase();
+	_compactTo = (omrobjectptr_t)heap->getHeapTop();
+
+	/* Split each region into groups, alternating the direction the groups slide in */
+	_groupCount = 0;
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		uintptr_t low = (uintptr_t)region->getLowAddress();
+		uintptr_t high = (uintptr_t)region->getHighAddress();
+		Assert_MM_true(0 == ((low - _heapBase) % block_size));
+		Assert_MM_true(0 == ((high - _heapBase) % block_size));
+
+		uintptr_t groupsInRegion = 1;
+		if (!singleGroupPerRegion) {
+			groupsInRegion = OMR_MAX(1, OMR_MIN(threadCount * SLIDING_COMPACT_GROUPS_PER_THREAD, region->getSize() / SLIDING_COMPACT_MINIMUM_GROUP_SIZE));
+		}
+		uintptr_t groupSize = MM_Math::roundToCeiling(groupAlignment, region->getSize() / groupsInRegion);
+
+		MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
+		uintptr_t indexInRegion = 0;
+		for (uintptr_t base = low; base < high; base += groupSize) {
+			Assert_MM_true(_groupCount < _groupTableSize);
+			CompactGroup *group = &_groupTable[_groupCount];
+			group->memorySubSpace = memorySubSpace;
+			group->base = base;
+			group->top = OMR_MIN(base + groupSize, high);
+			group->extentTop = group->top;
+			group->liveBytes = 0;
+			group->destinationBase = base;
+			group->slideUp = (1 == (indexInRegion & 1));
+			group->firstInRegion = (0 == indexInRegion);
+			group->lastInRegion = (group->top == high);
+			indexInRegion += 1;
+			_groupCount += 1;
+		}
+
+		/* Reset the memory pools in preparation for rebuilding their free lists at the end of the compaction */
+		memorySubSpace->getMemoryPool()->reset(MM_MemoryPool::forCompact);
+	}
+
+	return true;
+}
+
+void
+MM_SlidingCompactScheme::setLiveGranules(uintptr_t low, uintptr_t high)
+{
+	uintptr_t index = blockIndex(low);
+	uintptr_t bit = granuleIndex(low);
+	uintptr_t remaining = (high - low) / granule_size;
+
+	while (0 != remaining) {
+		uintptr_t count = OMR_MIN(remaining, granules_per_block - bit);
+		uintptr_t mask = UDATA_MAX;
+		if (granules_per_block != count) {
+			mask = ((((uintptr_t)1) << count) - 1) << bit;
+		}
+		_summaryTable[index].liveMask |= mask;
+		remaining -= count;
+		bit = 0;
+		index += 1;
+	}
+}
+
+void
+MM_SlidingCompactScheme::summarizeGroup(MM_EnvironmentStandard *env, CompactGroup *group)
+{
+	uintptr_t firstBlock = blockIndex(group->base);
+	uintptr_t topBlock = blockIndex(group->top);
+	memset(&_summaryTable[firstBlock], 0, (topBlock - firstBlock) * sizeof(SummaryEntry));
+
+	/* Objects spilling past the nominal top of the group only record the granules below it, so that
+	 * no two groups ever write the same summary entries. Forwarding only depends on the granules below an object.
+	 */
+	uintptr_t liveBytes = 0;
+	uintptr_t extentTop = group->top;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)group->base, (uintptr_t *)group->top);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		uintptr_t objectBase = (uintptr_t)objectPtr;
+		uintptr_t objectTop = objectBase + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		setLiveGranules(objectBase, OMR_MIN(objectTop, group->top));
+		liveBytes += objectTop - objectBase;
+		extentTop = OMR_MAX(extentTop, objectTop);
+	}
+
+	uintptr_t offset = 0;
+	for (uintptr_t index = firstBlock; index < topBlock; index++) {
+		_summaryTable[index].destination = offset;
+		offset += MM_Bits::populationCount(_summaryTable[index].liveMask) * granule_size;
+	}
+
+	group->liveBytes = liveBytes;
+	group->extentTop = extentTop;
+}
+
+void
+MM_SlidingCompactScheme::computeGroupDestinations(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; i < _groupCount; i++) {
+		CompactGroup *group = &_groupTable[i];
+		if (!group->firstInRegion) {
+			/* A large object of an earlier group may cover this whole group */
+			group->extentTop = OMR_MAX(group->extentTop, _groupTable[i - 1].extentTop);
+		}
+		if (group->slideUp) {
+			group->destinationBase = group->extentTop - group->liveBytes;
+		} else if (group->firstInRegion) {
+			group->destinationBase = group->base;
+		} else {
+			group->destinationBase = _groupTable[i - 1].extentTop;
+		}
+	}
+}
+
+void
+MM_SlidingCompactScheme::finalizeGroupSummary(MM_EnvironmentStandard *env, CompactGroup *group)
+{
+	uintptr_t topBlock = blockIndex(group->top);
+	for (uintptr_t index = blockIndex(group->base); index < topBlock; index++) {
+		_summaryTable[index].destination += group->destinationBase;
+	}
+}
+
+void
+MM_SlidingCompactScheme::slideGroup(MM_EnvironmentStandard *env, CompactGroup *group, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	if (!group->slideUp) {
+		/* Objects only move down, so moving them in ascending address order never overwrites an unmoved object */
+		MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)group->base, (uintptr_t *)group->top);
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+			uintptr_t destination = forwardedAddress((uintptr_t)objectPtr);
+			Assert_MM_true(destination <= (uintptr_t)objectPtr);
+			if (destination != (uintptr_t)objectPtr) {
+				uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+				memmove((void *)destination, objectPtr, objectSize);
+				objectCount += 1;
+				byteCount += objectSize;
+			}
+		}
+	} else {
+		/* Objects only move up, so move them in descending address order, one mark map word at a time */
+		uintptr_t firstBlock = blockIndex(group->base);
+		omrobjectptr_t blockObjects[granules_per_block];
+		for (uintptr_t index = blockIndex(group->top); index > firstBlock;) {
+			index -= 1;
+			MM_HeapMapWordIterator markedObjectIterator(_markMap, (void *)(_heapBase + (index * block_size)));
+			uintptr_t blockObjectCount = 0;
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				blockObjects[blockObjectCount++] = objectPtr;
+			}
+			while (0 != blockObjectCount) {
+				objectPtr = blockObjects[--blockObjectCount];
+				uintptr_t destination = forwardedAddress((uintptr_t)objectPtr);
+				Assert_MM_true(destination >= (uintptr_t)objectPtr);
+				if (destination != (uintptr_t)objectPtr) {
+					uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+					memmove((void *)destination, objectPtr, objectSize);
+					objectCount += 1;
+					byteCount += objectSize;
+				}
+			}
+		}
+	}
+}
+
+void
+MM_SlidingCompactScheme::fixupGroup(MM_EnvironmentStandard *env, CompactGroup *group, uintptr_t &objectCount)
+{
+	if (0 == group->liveBytes) {
+		return;
+	}
+
+	/* The group's objects are now contiguous, so they can be walked without the mark map */
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+	GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, (omrobjectptr_t)group->destinationBase, (omrobjectptr_t)(group->destinationBase + group->liveBytes), false);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = objectIterator.nextObject())) {
+		objectCount += 1;
+		fixupObject.fixupObject(env, objectPtr);
+	}
+}
+
+void
+MM_SlidingCompactScheme::rebuildMarkbitsInGroup(MM_EnvironmentStandard *env, CompactGroup *group)
+{
+	/* Moved objects always start within the nominal range of their group, so groups never share mark map words */
+	_markMap->setBitsInRange(env, (void *)group->base, (void *)group->top, true);
+
+	if (0 == group->liveBytes) {
+		return;
+	}
+
+	GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, (omrobjectptr_t)group->destinationBase, (omrobjectptr_t)(group->destinationBase + group->liveBytes), false);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = objectIterator.nextObject())) {
+		_markMap->setBit(objectPtr);
+	}
+}
+
+void
+MM_SlidingCompactScheme::rebuildFreelistFromGroups(MM_EnvironmentStandard *env)
+{
+	MM_CompactMemoryPoolState poolStateObj;
+	MM_CompactMemoryPoolState *poolState = &poolStateObj;
+	uintptr_t freeBase = 0;
+
+	for (uintptr_t i = 0; i < _groupCount; i++) {
+		CompactGroup *group = &_groupTable[i];
+		MM_MemorySubSpace *memorySubSpace = group->memorySubSpace;
+
+		if (group->firstInRegion) {
+			poolState->clear();
+			poolState->_memoryPool = memorySubSpace->getMemoryPool((void *)group->base);
+			freeBase = group->base;
+		}
+
+		/* Everything between the data of the previous group and the data of this one is free */
+		if (group->destinationBase > freeBase) {
+			addFreeRange(env, memorySubSpace, poolState, (void *)freeBase, group->destinationBase - freeBase);
+		}
+		freeBase = group->destinationBase + group->liveBytes;
+
+		if (group->lastInRegion) {
+			if (group->top > freeBase) {
+				addFreeRange(env, memorySubSpace, poolState, (void *)freeBase, group->top - freeBase);
+			}
+			if (NULL != poolState->_freeListHead) {
+				/* Terminate the free list with NULL*/
+				poolState->_memoryPool->createFreeEntry(env, poolState->_previousFreeEntry,
+														(uint8_t *)poolState->_previousFreeEntry + poolState->_previousFreeEntrySize);
+			}
+			flushPool(env, poolState);
+		}
+	}
+}
+
+void
+MM_SlidingCompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive)
+{
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t objectCount = 0;
+	uintptr_t byteCount = 0;
+	uintptr_t fixupObjectsCount = 0;
+
+	/* We use a single group per region if:
+	 *  o the compaction is aggressive, to leave a single hole per region
+	 *  o no slave GC threads
+	 *  o the heap is about to contract, which requires the free memory to be at the top of the region
+	 */
+	bool singleGroupPerRegion = aggressive
+		|| (1 == env->_currentTask->getThreadCount())
+		|| (COMPACT_CONTRACT == _extensions->globalGCStats.compactStats._compactReason);
+
+	env->_compactStats._setupStartTime = omrtime_hires_clock();
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		_useSummaryTable = masterSetupGroups(env, singleGroupPerRegion);
+		if (_useSummaryTable) {
+			/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
+			_extensions->heap->resetLargestFreeEntry();
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	if (!_useSummaryTable) {
+		/* The summary tables could not be allocated, use the sub area compactor instead */
+		MM_CompactScheme::compact(env, rebuildMarkBits, aggressive);
+		return;
+	}
+
+	for (uintptr_t i = 0; i < _groupCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			summarizeGroup(env, &_groupTable[i]);
+		}
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		computeGroupDestinations(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	for (uintptr_t i = 0; i < _groupCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			finalizeGroupSummary(env, &_groupTable[i]);
+		}
+	}
+	env->_compactStats._setupEndTime = omrtime_hires_clock();
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	/* Groups never overlap, neither before nor after the move, so they can all slide in parallel */
+	env->_compactStats._moveStartTime = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < _groupCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			slideGroup(env, &_groupTable[i], objectCount, byteCount);
+		}
+	}
+	env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+	MM_AtomicOperations::sync();
+
+	env->_compactStats._fixupStartTime = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < _groupCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			fixupGroup(env, &_groupTable[i], fixupObjectsCount);
+		}
+	}
+	env->_compactStats._fixupEndTime = omrtime_hires_clock();
+
+	env->_compactStats._rootFixupStartTime = omrtime_hires_clock();
+	_delegate.fixupRoots(env, this);
+	env->_compactStats._rootFixupEndTime = omrtime_hires_clock();
+
+	MM_AtomicOperations::sync();
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		rebuildFreelistFromGroups(env);
+
+		MM_MemoryPool *memoryPool;
+		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+
+		while(NULL != (memoryPool = poolIterator.nextPool())) {
+			memoryPool->postProcess(env, MM_MemoryPool::forCompact);
+		}
+
+		MM_AtomicOperations::sync();
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	if (rebuildMarkBits) {
+		for (uintptr_t i = 0; i < _groupCount; i++) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				rebuildMarkbitsInGroup(env, &_groupTable[i]);
+			}
+		}
+		MM_AtomicOperations::sync();
+	}
+
+	_delegate.workerCleanupAfterGC(env);
+
+	env->_compactStats._movedObjects = objectCount;
+	env->_compactStats._movedBytes = byteCount;
+	env->_compactStats._fixupObjects = fixupObjectsCount;
+}
+
+omrobjectptr_t
+MM_SlidingCompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
+{
+	if (!_useSummaryTable) {
+		return MM_CompactScheme::getForwardingPtr(objectPtr);
+	}
+
+	if ((objectPtr < _compactFrom) || (objectPtr >= _compactTo)) {
+		return objectPtr;
+	}
+
+	omrobjectptr_t forwardingPtr = (omrobjectptr_t)forwardedAddress((uintptr_t)objectPtr);
+	MM_CompactSchemeFixupObject::verifyForwardingPtr(objectPtr, forwardingPtr);
+	return forwardingPtr;
+}
+
+/*
+ * Every hole left by the sliding compactor is turned into a free entry (or abandoned) when the free lists are
+ * rebuilt, so the heap is already walkable.
+ */
+void
+MM_SlidingCompactScheme::fixHeapForWalk(MM_EnvironmentBase *env)
+{
+	if (!_useSummaryTable) {
+		MM_CompactScheme::fixHeapForWalk(env);
+	}
+}
+
+#endif /* OMR_GC_MODRON_COMPACTION */
@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SLIDINGCOMPACTSCHEME_HPP_)
+#define SLIDINGCOMPACTSCHEME_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+#include "CompactScheme.hpp"
+#include "Bits.hpp"
+
+class MM_EnvironmentStandard;
+class MM_MemorySubSpace;
+
+/**
+ * Number of compaction groups created per GC thread in each heap region.  More groups balance the work better
+ * across threads, at the cost of leaving more (but still large) holes once the compaction is done.
+ */
+#define SLIDING_COMPACT_GROUPS_PER_THREAD 4
+/**
+ * Smallest compaction group worth creating; regions too small to be split into groups this size get fewer groups.
+ */
+#define SLIDING_COMPACT_MINIMUM_GROUP_SIZE ((uintptr_t)(1024 * 1024))
+
+/**
+ * Parallel sliding compactor.
+ *
+ * Forwarding addresses are derived from a summary table holding, for each block of heap covered by one word of the
+ * mark map (512 bytes on 64-bit platforms), the destination of the first live granule in the block and a bit mask
+ * of the live granules in the block.  The forwarding address of any live object is then the block destination plus
+ * the population count of the live granules below the object, so pointer fixup never walks the heap.
+ *
+ * Each heap region is split into compaction groups, which slide independently of each other: even groups slide
+ * down and odd groups slide up, so that each pair of groups leaves a single hole between them.  Summary, evacuation,
+ * fixup and mark bit rebuilding all run in parallel, one group at a time per GC thread.
+ */
+class MM_SlidingCompactScheme : public MM_CompactScheme
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct SummaryEntry {
+		uintptr_t destination; /**< Forwarded address of the first live granule in the block (relative to the group destination until the group is finalized) */
+		uintptr_t liveMask; /**< One bit per live granule in the block, in mark map order */
+	};
+
+	struct CompactGroup {
+		MM_MemorySubSpace *memorySubSpace; /**< The subspace owning the region the group belongs to */
+		uintptr_t base; /**< Nominal (block aligned) low address of the group; every object of the group starts at or above it */
+		uintptr_t top; /**< Nominal (block aligned) high address of the group; every object of the group starts below it */
+		uintptr_t extentTop; /**< Real top of the group: top, or the end of the last object when it spills past top */
+		uintptr_t liveBytes; /**< Total size of the live objects of the group */
+		uintptr_t destinationBase; /**< Address the group's objects are compacted to */
+		bool slideUp; /**< True if the group's objects slide towards extentTop rather than towards the bottom of the group */
+		bool firstInRegion; /**< True if this is the first group of its region (base is the region low address) */
+		bool lastInRegion; /**< True if this is the last group of its region (top is the region high address) */
+	};
+
+	enum {
+		block_size = J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT,
+		granule_size = J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT,
+		granules_per_block = J9BITS_BITS_IN_SLOT
+	};
+
+	SummaryEntry *_summaryTable; /**< One entry per block of the maximum heap range, allocated on first use */
+	uintptr_t _summaryTableSize; /**< Number of entries in _summaryTable */
+	CompactGroup *_groupTable; /**< Compaction groups of the current cycle, in address order */
+	uintptr_t _groupTableSize; /**< Number of entries allocated in _groupTable */
+	uintptr_t _groupCount; /**< Number of groups in use in the current cycle */
+	bool _useSummaryTable; /**< False if the summary table could not be allocated, in which case the sub area compactor is used */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE uintptr_t blockIndex(uintptr_t address) const { return (address - _heapBase) / block_size; }
+	MMINLINE uintptr_t granuleIndex(uintptr_t address) const { return ((address - _heapBase) % block_size) / granule_size; }
+
+	/**
+	 * Compute the forwarded address of a live object from the summary table, without any range checks.
+	 */
+	MMINLINE uintptr_t forwardedAddress(uintptr_t address) const
+	{
+		SummaryEntry *entry = &_summaryTable[blockIndex(address)];
+		uintptr_t liveBelow = entry->liveMask & ((((uintptr_t)1) << granuleIndex(address)) - 1);
+		return entry->destination + (MM_Bits::populationCount(liveBelow) * granule_size);
+	}
+
+	/**
+	 * Mark the granules in [low, high) as live in the summary table. high must not cross the group's nominal top.
+	 */
+	void setLiveGranules(uintptr_t low, uintptr_t high);
+
+	/**
+	 * Allocate the summary table (once) and split the committed regions into compaction groups.
+	 * Also resets the memory pools in preparation for rebuilding their free lists.
+	 * @return false if the tables could not be allocated
+	 */
+	bool masterSetupGroups(MM_EnvironmentStandard *env, bool singleGroupPerRegion);
+
+	/**
+	 * Build the summary table entries of a group: the live granule mask of each block and the offset, from the
+	 * group's destination, of each block's first live granule.
+	 */
+	void summarizeGroup(MM_EnvironmentStandard *env, CompactGroup *group);
+
+	/**
+	 * Turn the group relative destinations of the summary table into absolute addresses.
+	 */
+	void finalizeGroupSummary(MM_EnvironmentStandard *env, CompactGroup *group);
+
+	/**
+	 * Move the objects of a group to their forwarded addresses.
+	 */
+	void slideGroup(MM_EnvironmentStandard *env, CompactGroup *group, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Fix up the references held by the (already moved) objects of a group.
+	 */
+	void fixupGroup(MM_EnvironmentStandard *env, CompactGroup *group, uintptr_t &objectCount);
+
+	/**
+	 * Rebuild the mark bits of a group so that they describe the moved objects.
+	 */
+	void rebuildMarkbitsInGroup(MM_EnvironmentStandard *env, CompactGroup *group);
+
+	/**
+	 * Rebuild the memory pool free lists from the holes left between the compacted groups.
+	 */
+	void rebuildFreelistFromGroups(MM_EnvironmentStandard *env);
+
+	/**
+	 * Compute the real extent and the destination of every group, once all groups have been summarized.
+	 */
+	void computeGroupDestinations(MM_EnvironmentStandard *env);
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_SlidingCompactScheme *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
+
+	virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive);
+	virtual omrobjectptr_t getForwardingPtr(omrobjectptr_t objectPtr) const;
+	virtual void fixHeapForWalk(MM_EnvironmentBase *env);
+
+	MM_SlidingCompactScheme(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme)
+		: MM_CompactScheme(env, markingScheme)
+		, _summaryTable(NULL)
+		, _summaryTableSize(0)
+		, _groupTable(NULL)
+		, _groupTableSize(0)
+		, _groupCount(0)
+		, _useSummaryTable(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_COMPACTION */
+#endif /* SLIDINGCOMPACTSCHEME_HPP_ */
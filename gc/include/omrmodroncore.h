@@ -106,6 +106,7 @@ enum {
 #define J9VMSTATE_GC_DISPATCHER_IDLE (J9VMSTATE_GC | 0x0025)
 #define J9VMSTATE_GC_CONCURRENT_SCAVENGER (J9VMSTATE_GC | 0x0026)
 #define J9VMSTATE_GC_CARD_CLEANER_FOR_MARKING (J9VMSTATE_GC | 0x0101)
+#define J9VMSTATE_GC_CARD_CLEANER_FOR_MINOR_MARKING (J9VMSTATE_GC | 0x0102)
 
 /**
  * @}
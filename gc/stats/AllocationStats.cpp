@@ -34,6 +34,11 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhRefreshSizeDecisions = 0;
+	_tlhRefreshSizeGrown = 0;
+	_tlhRefreshSizeShrunk = 0;
+	_tlhRefreshSizeTotal = 0;
+	_tlhRefreshSizeMax = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -67,6 +72,17 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 		MM_AtomicOperations::lockCompareExchange(
 			&_tlhMaxAbandonedListSize, prevMax, stats->_tlhMaxAbandonedListSize);
 	}
+	MM_AtomicOperations::add(&_tlhRefreshSizeDecisions, stats->_tlhRefreshSizeDecisions);
+	MM_AtomicOperations::add(&_tlhRefreshSizeGrown, stats->_tlhRefreshSizeGrown);
+	MM_AtomicOperations::add(&_tlhRefreshSizeShrunk, stats->_tlhRefreshSizeShrunk);
+	MM_AtomicOperations::add(&_tlhRefreshSizeTotal, stats->_tlhRefreshSizeTotal);
+	for (
+			uintptr_t prevMax = _tlhRefreshSizeMax;
+			prevMax < stats->_tlhRefreshSizeMax;
+			prevMax = _tlhRefreshSizeMax) {
+		MM_AtomicOperations::lockCompareExchange(
+			&_tlhRefreshSizeMax, prevMax, stats->_tlhRefreshSizeMax);
+	}
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
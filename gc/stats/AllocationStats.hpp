@@ -41,6 +41,11 @@ public:
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhRefreshSizeDecisions; /**< Number of refresh sizes chosen by adaptive TLH sizing. */
+	uintptr_t _tlhRefreshSizeGrown; /**< Number of adaptive TLH sizing decisions that grew the refresh size. */
+	uintptr_t _tlhRefreshSizeShrunk; /**< Number of adaptive TLH sizing decisions that shrank the refresh size. */
+	uintptr_t _tlhRefreshSizeTotal; /**< Sum of the refresh sizes chosen by adaptive TLH sizing. */
+	uintptr_t _tlhRefreshSizeMax; /**< The largest refresh size chosen by adaptive TLH sizing. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -61,6 +66,7 @@ public:
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh - _tlhDiscardedBytes; }
+	uintptr_t tlhRefreshCount() { return _tlhRefreshCountFresh + _tlhRefreshCountReused; }
 	uintptr_t nontlhBytesAllocated() { return _allocationBytes; }
 #endif
 
@@ -88,6 +94,11 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhRefreshSizeDecisions(0),
+		_tlhRefreshSizeGrown(0),
+		_tlhRefreshSizeShrunk(0),
+		_tlhRefreshSizeTotal(0),
+		_tlhRefreshSizeMax(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 #if defined(OMR_GC_ARRAYLETS)
 		_arrayletLeafAllocationCount(0),
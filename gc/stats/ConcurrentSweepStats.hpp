@@ -57,6 +57,8 @@ public:
 
 	uintptr_t _totalChunkCount;  /**< Total number of chunks included in the concurrent sweep calculation */
 	volatile uintptr_t _totalChunkSweptCount;  /**< Total number of chunks that have been swept through concurrent sweep */
+	uintptr_t _totalChunkBytes;  /**< Total number of heap bytes covered by the chunks included in the concurrent sweep */
+	volatile uintptr_t _totalChunkSweptBytes;  /**< Total number of heap bytes covered by the chunks that have been swept */
 	/**
 	 * @}
 	 */
@@ -137,12 +139,25 @@ public:
 	 */
 	MMINLINE bool hasCompletedSweepConcurrently() { return concurrentsweep_mode_completed_sweep_phase_concurrently == _mode; }
 
+	/**
+	 * Determine how much of the heap is still waiting to be swept.
+	 * @return the number of chunks that have not been swept yet.
+	 */
+	MMINLINE uintptr_t getBacklogChunkCount() { return _totalChunkCount - _totalChunkSweptCount; }
+
+	/**
+	 * @return the number of heap bytes covered by the chunks that have not been swept yet.
+	 */
+	MMINLINE uintptr_t getBacklogBytes() { return _totalChunkBytes - _totalChunkSweptBytes; }
+
 	/**
 	 * Reset all statistics to starting values.
 	 */
 	MMINLINE void clear() {
 		_totalChunkCount = 0;
 		_totalChunkSweptCount = 0;
+		_totalChunkBytes = 0;
+		_totalChunkSweptBytes = 0;
 		_minimumFreeEntryBytesSwept = 0;
 		_minimumFreeEntryBytesConnected = 0;
 		_concurrentCompleteSweepTimeStart = 0;
@@ -161,6 +176,8 @@ public:
 		_mode(concurrentsweep_mode_off),
 		_totalChunkCount(0),
 		_totalChunkSweptCount(0),
+		_totalChunkBytes(0),
+		_totalChunkSweptBytes(0),
 		_minimumFreeEntryBytesSwept(0),
 		_minimumFreeEntryBytesConnected(0),
 		_concurrentCompleteSweepTimeStart(0),
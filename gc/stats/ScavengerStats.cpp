@@ -52,6 +52,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_releaseFreeListCount(0)
 	,_acquireScanListCount(0)
 	,_acquireListLockCount(0)
+	,_acquireRemoteNodeListCount(0)
+	,_nodeLocalCopyCacheCount(0)
 	,_aliasToCopyCacheCount(0)
 	,_arraySplitCount(0)
 	,_arraySplitAmount(0)
@@ -136,6 +138,7 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_flipBytes = 0;
 	_tenureAggregateCount = 0;
 	_tenureAggregateBytes = 0;
+	_hotFieldCopyCount = 0;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)	
 	_tenureLOACount = 0;
 	_tenureLOABytes = 0;
@@ -153,6 +156,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_releaseFreeListCount = 0;
 	_acquireScanListCount = 0;
 	_acquireListLockCount = 0;
+	_acquireRemoteNodeListCount = 0;
+	_nodeLocalCopyCacheCount = 0;
 	_aliasToCopyCacheCount = 0;
 	_workStallCount = 0;
 	_completeStallCount = 0;
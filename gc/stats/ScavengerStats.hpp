@@ -65,6 +65,7 @@ public:
 	uintptr_t _flipBytes;
 	uintptr_t _tenureAggregateCount;
 	uintptr_t _tenureAggregateBytes;
+	uintptr_t _hotFieldCopyCount; /**< number of objects copied depth-first, immediately after the parent referencing them through a hot field */
 #if defined(OMR_GC_LARGE_OBJECT_AREA)	
 	uintptr_t _tenureLOACount;
 	uintptr_t _tenureLOABytes;
@@ -83,6 +84,8 @@ public:
 	uintptr_t _releaseFreeListCount;
 	uintptr_t _acquireScanListCount;
 	uintptr_t _acquireListLockCount;  /**< cumulative (for scan&free list) lock count. if this number is much larger than cumulative acquire list count, it indicates over-splitting */
+	uintptr_t _acquireRemoteNodeListCount; /**< cumulative (for scan&free list) number of caches taken from a sublist owned by another NUMA node */
+	uintptr_t _nodeLocalCopyCacheCount; /**< number of copy caches carved from a survivor or tenure chunk owned by the NUMA node of the copying thread */
 	uintptr_t _aliasToCopyCacheCount;
 	uintptr_t _arraySplitCount;
 	uintptr_t _arraySplitAmount;
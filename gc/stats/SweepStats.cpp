@@ -37,12 +37,17 @@ MM_SweepStats::clear()
 {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal = 0;
+	sweepBacklogChunks = 0;
+	sweepBacklogBytes = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	idleTime = 0;
 	mergeTime = 0;
 	sweepChunksProcessed = 0;
+	sweepChunksDequeued = 0;
+	sweepStealAttempts = 0;
+	sweepChunksStolen = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */			
 }
 	
@@ -58,6 +63,9 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 	idleTime += statsToMerge->idleTime;
 	mergeTime += statsToMerge->mergeTime;
 	sweepChunksProcessed += statsToMerge->sweepChunksProcessed;
+	sweepChunksDequeued += statsToMerge->sweepChunksDequeued;
+	sweepStealAttempts += statsToMerge->sweepStealAttempts;
+	sweepChunksStolen += statsToMerge->sweepChunksStolen;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 }
 
@@ -42,6 +42,8 @@ public:
 	
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
+	uintptr_t sweepBacklogChunks;  /**< Number of sweep chunks left for mutators and background threads to sweep when the collection ended */
+	uintptr_t sweepBacklogBytes;  /**< Number of heap bytes covered by sweepBacklogChunks */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -50,6 +52,9 @@ public:
 	
 	uintptr_t sweepChunksTotal;
 	uintptr_t sweepChunksProcessed;
+	uintptr_t sweepChunksDequeued; /**< Number of chunks swept by this thread that were taken from the work-stealing deques (popped or stolen) */
+	uintptr_t sweepStealAttempts; /**< Number of steal operations attempted on other threads' chunk deques */
+	uintptr_t sweepChunksStolen; /**< Number of chunks swept by this thread that were stolen from another thread's deque */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	uint64_t _startTime;	/**< Sweep start time */
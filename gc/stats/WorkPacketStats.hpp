@@ -51,6 +51,8 @@ public:
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
 	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting for all other threads to complete working */
+	uintptr_t _stealAttemptCount; /**< The number of steal operations the thread attempted on other threads' work-stealing deques */
+	uintptr_t _stealCount; /**< The number of work elements the thread successfully stole from other threads */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 protected:
@@ -73,6 +75,8 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		_stealAttemptCount = 0;
+		_stealCount = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +95,8 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		_stealAttemptCount += statsToMerge->_stealAttemptCount;
+		_stealCount += statsToMerge->_stealCount;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -151,6 +157,8 @@ public:
 		,_completeStallCount(0)
 		,_workStallTime(0)
 		,_completeStallTime(0)
+		,_stealAttemptCount(0)
+		,_stealCount(0)
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
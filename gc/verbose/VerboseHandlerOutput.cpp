@@ -737,6 +737,18 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
 	}
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (_extensions->tlhAdaptiveSizing) {
+		uintptr_t averageRefreshSize = 0;
+		if (0 != systemStats->_tlhRefreshSizeDecisions) {
+			averageRefreshSize = systemStats->_tlhRefreshSizeTotal / systemStats->_tlhRefreshSizeDecisions;
+		}
+		writer->formatAndOutput(env, 1, "<tlh-sizing refreshes=\"%zu\" reused=\"%zu\" threads=\"%zu\" grown=\"%zu\" shrunk=\"%zu\" averageSize=\"%zu\" maxSize=\"%zu\" />",
+				systemStats->tlhRefreshCount(), systemStats->_tlhRefreshCountReused, systemStats->_tlhRefreshSizeDecisions,
+				systemStats->_tlhRefreshSizeGrown, systemStats->_tlhRefreshSizeShrunk, averageRefreshSize, systemStats->_tlhRefreshSizeMax);
+	}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+
 	if(0 != _extensions->bytesAllocatedMost){
 		const char *dots = "";
 		char escapedThreadName[128];
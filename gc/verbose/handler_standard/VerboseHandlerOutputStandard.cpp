@@ -323,10 +323,35 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
-	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	bool hasSweepDetails = extensions->workStealingEnabled;
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	hasSweepDetails = hasSweepDetails || extensions->concurrentSweep;
+#endif /* OMR_GC_CONCURRENT_SWEEP */
 
-	handleSweepEndInternal(env, eventData);
+	enterAtomicReportingBlock();
+	if (hasSweepDetails) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (extensions->concurrentSweep) {
+			/* Sweep work deferred past the end of the pause, to be completed by allocating and background threads */
+			writer->formatAndOutput(env, 1, "<sweep-info backlogchunks=\"%zu\" backlogbytes=\"%zu\" />",
+					sweepStats->sweepBacklogChunks, sweepStats->sweepBacklogBytes);
+		}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		if (extensions->workStealingEnabled) {
+			writer->formatAndOutput(env, 1, "<work-stealing dequeuedchunks=\"%zu\" stealattempts=\"%zu\" stolenchunks=\"%zu\" />",
+					sweepStats->sweepChunksDequeued, sweepStats->sweepStealAttempts, sweepStats->sweepChunksStolen);
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		handleSweepEndInternal(env, eventData);
+		handleGCOPOuterStanzaEnd(env);
+		writer->flush(env);
+	} else {
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		handleSweepEndInternal(env, eventData);
+	}
 	exitAtomicReportingBlock();
 }
 
@@ -433,6 +458,10 @@ MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintp
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (extensions->numaAwareGCThreads && (1 < extensions->_numaManager.getAffinityLeaderCount())) {
+		writer->formatAndOutput(env, 1, "<numa-info nodes=\"%zu\" nodelocalcopycaches=\"%zu\" remotenodecaches=\"%zu\" />",
+				extensions->_numaManager.getAffinityLeaderCount(), scavengerStats->_nodeLocalCopyCacheCount, scavengerStats->_acquireRemoteNodeListCount);
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -71,6 +71,69 @@ avl_insert(J9AVLTree *tree, J9AVLTreeNode *nodeToInsert);
 J9AVLTreeNode *
 avl_search(J9AVLTree *tree, uintptr_t searchValue);
 
+/* ---------------- rangebtree.c ---------------- */
+
+/**
+* @brief
+* @param *portLib
+* @param memoryCategory
+* @return J9BTree *
+*/
+J9BTree *
+btree_new(OMRPortLibrary *portLib, uint32_t memoryCategory);
+
+
+/**
+* @brief
+* @param *tree
+* @return void
+*/
+void
+btree_free(J9BTree *tree);
+
+
+/**
+* @brief
+* @param *tree
+* @param start
+* @param end
+* @param *value
+* @return void *
+*/
+void *
+btree_insert(J9BTree *tree, uintptr_t start, uintptr_t end, void *value);
+
+
+/**
+* @brief
+* @param *tree
+* @param start
+* @return void *
+*/
+void *
+btree_delete(J9BTree *tree, uintptr_t start);
+
+
+/**
+* @brief
+* @param *tree
+* @param start
+* @return void *
+*/
+void *
+btree_search(J9BTree *tree, uintptr_t start);
+
+
+/**
+* @brief
+* @param *tree
+* @param address
+* @return void *
+*/
+void *
+btree_findRange(J9BTree *tree, uintptr_t address);
+
+
 
 #ifdef __cplusplus
 }
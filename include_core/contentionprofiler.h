@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(CONTENTIONPROFILER_H_)
+#define CONTENTIONPROFILER_H_
+
+/*
+ * @ddr_namespace: default
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "spacesaving.h"
+#include "thread_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(OMR_THR_JLM)
+
+/* The heavy hitter sketch tracks this many candidates for each site reported. */
+#define CONTENTION_PROFILER_SKETCH_RATIO 4
+
+/* Number of samples drained from the thread library at once */
+#define CONTENTION_PROFILER_DRAIN_BATCH 256
+
+/* States of the aggregator thread */
+#define CONTENTION_PROFILER_AGGREGATOR_STOPPED 0
+#define CONTENTION_PROFILER_AGGREGATOR_RUNNING 1
+#define CONTENTION_PROFILER_AGGREGATOR_STOPPING 2
+
+/*
+ * Contention attributed to one site: the caller that entered the monitor or, when the
+ * caller is not known (e.g. a monitor reacquired after a wait), the monitor itself.
+ * Times are in the units of the JLM hold times.
+ */
+typedef struct OMRContentionSite {
+	void *key;
+	void *callsite;
+	omrthread_monitor_t monitor;
+	uintptr_t count;
+	uint64_t waitTime;
+	uint64_t holdTime;
+	BOOLEAN hot;
+	char monitorName[J9THREAD_CONTENTION_NAME_LENGTH];
+} OMRContentionSite;
+
+typedef struct OMRContentionProfiler {
+	OMRPortLibrary *portLib;
+	uint32_t topN;
+	OMRSpaceSaving *hotSites;
+	J9HashTable *sites;
+	J9ThreadContentionSample *samples;
+	uintptr_t sampleCount;
+	uintptr_t droppedSamples;
+	omrthread_monitor_t mutex; /* protects the sites, and the aggregator state */
+	uintptr_t aggregatorState;
+	uintptr_t aggregateIntervalMillis;
+	uintptr_t aggregations; /* number of periodic aggregations done */
+} OMRContentionProfiler;
+
+/*
+ * Create a profiler that aggregates the samples of omrthread_jlm_contention_sampling_start.
+ * The sites are ranked by the total time threads waited to enter monitors there.
+ *
+ * @param portLibrary the port library
+ * @param topN number of sites to report
+ * @return the new profiler, or NULL on failure
+ */
+OMRContentionProfiler *contentionProfilerNew(OMRPortLibrary *portLibrary, uint32_t topN);
+
+/* Stops the aggregator thread before freeing the profiler */
+void contentionProfilerFree(OMRContentionProfiler *profiler);
+
+/* Forget all the sites and samples aggregated so far */
+void contentionProfilerClear(OMRContentionProfiler *profiler);
+
+/*
+ * Drain the contention samples buffered by all threads and add them to the sites.
+ * @return the number of samples aggregated
+ */
+uintptr_t contentionProfilerAggregate(OMRContentionProfiler *profiler);
+
+/*
+ * Start a thread that calls contentionProfilerAggregate every intervalMillis, so that
+ * the per-thread sample buffers are emptied before they fill up. The profiler can still
+ * be aggregated, queried and reported on while the thread runs.
+ *
+ * @param intervalMillis time between aggregations (non-zero)
+ * @return 0 on success, non-zero if the thread could not be started or is already running
+ */
+intptr_t contentionProfilerStartAggregator(OMRContentionProfiler *profiler, uintptr_t intervalMillis);
+
+/*
+ * Stop the aggregator thread, if it is running, and wait for it to exit.
+ */
+void contentionProfilerStopAggregator(OMRContentionProfiler *profiler);
+
+/*
+ * Copy the sites with the most wait time, most contended first.
+ *
+ * @param sites array of at least maxSites entries
+ * @param maxSites
+ * @return the number of sites returned
+ */
+uintptr_t contentionProfilerGetTopSites(OMRContentionProfiler *profiler, OMRContentionSite *sites, uintptr_t maxSites);
+
+/* Print the top sites to the tty */
+void contentionProfilerReport(OMRContentionProfiler *profiler);
+
+#endif /* OMR_THR_JLM */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONTENTIONPROFILER_H_ */
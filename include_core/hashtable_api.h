@@ -199,6 +199,90 @@ hashTableRemove(J9HashTable *table, void *entry);
 void *
 hashTableStartDo(J9HashTable *table,  J9HashTableState *handle);
 
+/* ---------------- concurrenthashtable.c ---------------- */
+
+/**
+* @brief
+* @param *portLibrary
+* @param *tableName
+* @param tableSize
+* @param entrySize
+* @param memoryCategory
+* @param hashFn
+* @param hashEqualFn
+* @param *functionUserData
+* @return J9ConcurrentHashTable *
+*/
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	void *functionUserData);
+
+
+/**
+* @brief
+* @param *table
+* @return void
+*/
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return uint32_t
+*/
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief
+* @param *table
+* @param doFn
+* @param *opaque
+* @return void
+*/
+void
+concurrentHashTableForEachDo(J9ConcurrentHashTable *table, J9HashTableDoFn doFn, void *opaque);
+
+
+/**
+* @brief
+* @param *table
+* @return uintptr_t
+*/
+uintptr_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table);
+
 
 
 #ifdef __cplusplus
@@ -52,6 +52,16 @@ struct J9HookInterface;
 intptr_t
 J9HookInitializeInterface(struct J9HookInterface **hookInterface, OMRPortLibrary *portLib, size_t interfaceSize);
 
+/**
+* @brief
+* @param hookInterface
+* @param taggedEventNum
+* @param modeFlags
+* @return intptr_t
+*/
+intptr_t
+J9HookSetDispatchMode(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, uintptr_t modeFlags);
+
 #ifdef __cplusplus
 }
 #endif
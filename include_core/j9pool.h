@@ -105,6 +105,33 @@ typedef struct J9PoolState {
 
 #define POOLSTATE_FOLLOW_NEXT_POINTERS  1
 
+/*
+ * @ddr_namespace: map_to_type=J9PoolMagazine
+ */
+
+typedef struct J9PoolMagazine {
+	struct J9PoolMagazines *owner;
+	struct J9PoolMagazine *next;
+	struct J9PoolMagazine *previous;
+	uintptr_t count;
+	void *elements[1]; /**< 2 * owner->batchSize entries */
+} J9PoolMagazine;
+
+/*
+ * @ddr_namespace: map_to_type=J9PoolMagazines
+ */
+
+typedef struct J9PoolMagazines {
+	struct J9Pool *pool;
+	struct OMRPortLibrary *portLibrary;
+	uintptr_t batchSize;
+	uintptr_t tlsKey;
+	struct J9ThreadMonitor *poolMutex; /**< held whenever the puddles of pool are touched */
+	struct J9PoolMagazine *magazines;
+} J9PoolMagazines;
+
+#define J9POOL_MAGAZINE_DEFAULT_BATCH_SIZE  32
+
 #define pool_state J9PoolState
 
 #define J9POOLPUDDLE_FIRSTFREESLOT(parm) SRP_GET((parm)->firstFreeSlot, uintptr_t*)
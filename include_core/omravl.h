@@ -38,6 +38,22 @@ extern "C" {
 
 #include "j9nongenerated.h"
 
+#define J9BTREE_NODE_KEYS  15
+
+/*
+ * @ddr_namespace: map_to_type=J9BTree
+ */
+
+/* B+-tree mapping disjoint address ranges [start, end) to values, see rangebtree.c */
+typedef struct J9BTree {
+	struct J9BTreeNode *root;
+	uintptr_t height; /**< 0 when empty, 1 when the root is a leaf */
+	uintptr_t numberOfRanges;
+	struct J9Pool *nodePool;
+	struct OMRPortLibrary *portLibrary;
+	uint32_t memoryCategory;
+} J9BTree;
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,6 +49,7 @@ extern "C" {
 #define J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32	0x00000004	/*!< Allocate table elements using the malloc32 function */
 #define J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION	0x00000008	/*!< Allow space optimized hashTable, some functions not supported */
 #define J9HASH_TABLE_DO_NOT_REHASH	0x00000010	/*!< Do not rehash the table while set */
+#define J9HASH_TABLE_OPEN_ADDRESSING	0x00000020	/*!< Use a flat open addressing slot array probed a group of control bytes at a time */
 
 #define J9HASH_TABLE_AVL_TREE_TAG_BIT ((uintptr_t)0x00000001) /*!< Bit to indicate that hastable slot contains a pointer to an AVL tree */
 
@@ -77,6 +78,7 @@ extern "C" {
 * Hash table state queries
 */
 #define hashTableIsSpaceOptimized(table) (NULL == table->listNodePool)
+#define hashTableIsOpenAddressing(table) (J9HASH_TABLE_OPEN_ADDRESSING == ((table)->flags & J9HASH_TABLE_OPEN_ADDRESSING))
 
 
 struct J9HashTable; /* Forward struct declaration */
@@ -110,6 +112,7 @@ typedef struct J9HashTable {
 	void *equalFnUserData;
 	void *hashFnUserData;
 	struct J9HashTable *previous;
+	uint32_t numberOfDeletedSlots;
 } J9HashTable;
 
 typedef struct J9HashTableState {
@@ -121,6 +124,59 @@ typedef struct J9HashTableState {
 	struct J9PoolState poolState;
 } J9HashTableState;
 
+/**
+ * Concurrent hash table constants
+ */
+#define J9CONCURRENT_HASH_TABLE_LOCK_STRIPES 64	/*!< Number of locks serializing updates, must be a power of two */
+#define J9CONCURRENT_HASH_TABLE_READER_SHARDS_LOG2 4
+#define J9CONCURRENT_HASH_TABLE_READER_SHARDS (1 << J9CONCURRENT_HASH_TABLE_READER_SHARDS_LOG2)	/*!< Number of cache lines counting readers */
+
+struct J9ThreadMonitor; /* Forward struct declaration */
+
+/**
+ * A chain link of a concurrent hash table. Entries never move once added; links are replaced when a bucket
+ * is moved to a larger bucket array.
+ */
+typedef struct J9ConcurrentHashTableLink {
+	struct J9ConcurrentHashTableLink *volatile next;
+	struct J9ConcurrentHashTableLink *retiredNext;
+	uintptr_t hash;
+	void *entry;
+} J9ConcurrentHashTableLink;
+
+typedef struct J9ConcurrentHashTableBuckets {
+	uintptr_t size;
+	struct J9ConcurrentHashTableBuckets *volatile next;
+	struct J9ConcurrentHashTableLink *volatile heads[1];
+} J9ConcurrentHashTableBuckets;
+
+typedef struct J9ConcurrentHashTableReaders {
+	volatile uintptr_t count[2];
+	uint8_t padding[64 - (2 * sizeof(uintptr_t))];
+} J9ConcurrentHashTableReaders;
+
+typedef struct J9ConcurrentHashTable {
+	const char *tableName;
+	uint32_t entrySize;
+	uint32_t memoryCategory;
+	uintptr_t (*hashFn)(void *key, void *userData) ;
+	uintptr_t (*hashEqualFn)(void *leftKey, void *rightKey, void *userData) ;
+	void *functionUserData;
+	struct OMRPortLibrary *portLibrary;
+	struct J9ConcurrentHashTableBuckets *volatile buckets;
+	volatile uintptr_t numberOfEntries;
+	volatile uintptr_t epoch;
+	uintptr_t moveIndex;
+	uintptr_t numberOfRetiredLinks;
+	struct J9ConcurrentHashTableLink *retiredLinks;
+	struct J9ConcurrentHashTableLink *retiredEntries;
+	struct J9ThreadMonitor *resizeMutex;
+	struct J9ThreadMonitor *retireMutex;
+	struct J9ThreadMonitor *synchronizeMutex;
+	struct J9ThreadMonitor *stripeLocks[J9CONCURRENT_HASH_TABLE_LOCK_STRIPES];
+	struct J9ConcurrentHashTableReaders readers[J9CONCURRENT_HASH_TABLE_READER_SHARDS];
+} J9ConcurrentHashTable;
+
 #ifdef __cplusplus
 }
 #endif
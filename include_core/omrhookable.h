@@ -107,6 +107,11 @@ typedef struct J9CommonHookInterface {
 	struct OMRPortLibrary *portLib;		/* for accessing PortLibrary  */
 	uint64_t threshold4Trace;			/* the threshold for triggering tracepoint */
 	uintptr_t eventSize;				/* how many events supported by this hook interface */
+	struct J9HookListeners **listeners;	/* per-event listener arrays for flattened dispatch, allocated on first use */
+	struct J9HookListeners *retiredListeners;	/* listener arrays replaced since startup, freed at shutdown */
+	uint64_t timebaseTicksPerMilli;	/* calibrated time base frequency for J9HOOK_FLAG_CYCLE_TIMING, 0 until calibrated */
+	uint64_t timebaseStart;				/* time base and wall clock readings taken together during calibration */
+	uint64_t timebaseStartMillis;
 } J9CommonHookInterface;
 
 
@@ -114,6 +119,8 @@ typedef struct J9CommonHookInterface {
 #define J9HOOK_EVENT_NUM_MASK  0xFFFF
 #define J9HOOK_FLAG_HOOKED  1
 #define J9HOOK_FLAG_RESERVED  2
+#define J9HOOK_FLAG_FLATTENED  8
+#define J9HOOK_FLAG_CYCLE_TIMING  16
 
 typedef struct J9HookRecord {
 	struct J9HookRecord *next;
@@ -125,6 +132,19 @@ typedef struct J9HookRecord {
 	uintptr_t agentID;
 } J9HookRecord;
 
+/* immutable snapshot of the valid records of an event, dispatched from when the event has J9HOOK_FLAG_FLATTENED */
+typedef struct J9HookListener {
+	J9HookFunction function;
+	void *userData;
+	const char *callsite;
+} J9HookListener;
+
+typedef struct J9HookListeners {
+	struct J9HookListeners *retiredNext;
+	uintptr_t count;
+	J9HookListener listeners[1];
+} J9HookListeners;
+
 
 /* magic hooks supported by every hook interface */
 
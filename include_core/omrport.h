@@ -670,12 +670,51 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_CTLDATA_NOSUBALLOC32BITMEM  "NOSUBALLOC32BITMEM"
 #define OMRPORT_CTLDATA_VMEM_ADVISE_OS_ONFREE  "VMEM_ADVISE_OS_ONFREE"
 #define OMRPORT_CTLDATA_VECTOR_REGS_SUPPORT_ON  "VECTOR_REGS_SUPPORT_ON"
+#define OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE  "MEM_SLAB_ARENA_SIZE"
+#define OMRPORT_CTLDATA_CGROUP_ROOT  "CGROUP_ROOT"
 
 #define OMRPORT_FILE_READ_LOCK  1
 #define OMRPORT_FILE_WRITE_LOCK  2
 #define OMRPORT_FILE_WAIT_FOR_LOCK  4
 #define OMRPORT_FILE_NOWAIT_FOR_LOCK  8
 
+/**
+ * @name Asynchronous file operations
+ * Operations that may be queued with omrfile_blockingasync_submit
+ * @{
+ */
+#define OMRPORT_FILE_ASYNC_READ  1
+#define OMRPORT_FILE_ASYNC_WRITE  2
+#define OMRPORT_FILE_ASYNC_SET_LENGTH  3
+#define OMRPORT_FILE_ASYNC_SYNC  4
+#define OMRPORT_FILE_ASYNC_CLOSE  5
+/** @} */
+
+/* Offset used by asynchronous reads and writes that should start at the current file pointer */
+#define OMRPORT_FILE_ASYNC_OFFSET_CURRENT  ((int64_t)-1)
+
+struct OMRPortLibrary;
+struct OMRFileAsyncRequest;
+
+typedef void (*omrfile_async_callback)(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncRequest *request);
+
+/**
+ * A single asynchronous file operation, see @ref omrfile_blockingasync.c::omrfile_blockingasync_submit "omrfile_blockingasync_submit".
+ * The storage belongs to the caller but must not be touched between submission and completion.
+ */
+typedef struct OMRFileAsyncRequest {
+	uint32_t operation; /**< one of the OMRPORT_FILE_ASYNC_* operations */
+	intptr_t fd; /**< file descriptor returned by omrfile_open or omrfile_blockingasync_open */
+	void *buf; /**< buffer read into or written from (READ and WRITE only) */
+	intptr_t nbytes; /**< number of bytes to transfer (READ and WRITE only) */
+	int64_t offset; /**< file offset for READ and WRITE, OMRPORT_FILE_ASYNC_OFFSET_CURRENT for the file pointer; new length for SET_LENGTH */
+	omrfile_async_callback callback; /**< invoked on an I/O thread once the operation completes, may be NULL */
+	void *userData; /**< available to the callback */
+	intptr_t result; /**< bytes transferred (READ and WRITE) or 0 on success, negative portable error code on failure */
+	volatile uintptr_t complete; /**< set to 1 once the request is complete, only for requests without a callback */
+	struct OMRFileAsyncRequest *next; /**< private to the port library */
+} OMRFileAsyncRequest;
+
 #define OMRPORT_MMAP_CAPABILITY_COPYONWRITE  1
 #define OMRPORT_MMAP_CAPABILITY_READ  2
 #define OMRPORT_MMAP_CAPABILITY_WRITE  4
@@ -1404,6 +1443,10 @@ typedef struct OMRPortLibrary {
 	int32_t (*file_blockingasync_unlock_bytes)(struct OMRPortLibrary *portLibrary, intptr_t fd, uint64_t offset, uint64_t length) ;
 	/** see @ref omrfile_blockingasync.c::omrfile_blockingasync_lock_bytes "omrfile_blockingasync_lock_bytes"*/
 	int32_t (*file_blockingasync_lock_bytes)(struct OMRPortLibrary *portLibrary, intptr_t fd, int32_t lockFlags, uint64_t offset, uint64_t length) ;
+	/** see @ref omrfile_blockingasync.c::omrfile_blockingasync_submit "omrfile_blockingasync_submit"*/
+	int32_t (*file_blockingasync_submit)(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *requests, uintptr_t count) ;
+	/** see @ref omrfile_blockingasync.c::omrfile_blockingasync_drain "omrfile_blockingasync_drain"*/
+	void (*file_blockingasync_drain)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrstr.c::omrstr_ftime "omrstr_ftime"*/
 	uintptr_t (*str_ftime)(struct OMRPortLibrary *portLibrary, char *buf, uintptr_t bufLen, const char *format, int64_t timeMillis) ;
 	/** see @ref omrmmap.c::omrmmap_startup "omrmmap_startup"*/
@@ -1452,6 +1495,8 @@ typedef struct OMRPortLibrary {
 	int32_t ( *sysinfo_cgroup_enable_limits)(struct OMRPortLibrary *portLibrary);
 	/** see @ref omrsysinfo.c::omrsysinfo_cgroup_get_memlimit "omrsysinfo_cgroup_get_memlimit"*/
 	int32_t (*sysinfo_cgroup_get_memlimit)(struct OMRPortLibrary *portLibrary, uint64_t *limit);
+	/** see @ref omrsysinfo.c::omrsysinfo_cgroup_get_cpulimit "omrsysinfo_cgroup_get_cpulimit"*/
+	int32_t (*sysinfo_cgroup_get_cpulimit)(struct OMRPortLibrary *portLibrary, uintptr_t *limit);
 	/** see @ref omrport.c::omrport_init_library "omrport_init_library"*/
 	int32_t (*port_init_library)(struct OMRPortLibrary *portLibrary, uintptr_t size) ;
 	/** see @ref omrport.c::omrport_startup_library "omrport_startup_library"*/
@@ -1760,6 +1805,8 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrfile_blockingasync_lock_bytes(param1,param2,param3,param4) privateOmrPortLibrary->file_blockingasync_lock_bytes(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrfile_blockingasync_set_length(param1,param2) privateOmrPortLibrary->file_blockingasync_set_length(privateOmrPortLibrary, (param1), (param2))
 #define omrfile_blockingasync_flength(param1) privateOmrPortLibrary->file_blockingasync_flength(privateOmrPortLibrary, (param1))
+#define omrfile_blockingasync_submit(param1,param2) privateOmrPortLibrary->file_blockingasync_submit(privateOmrPortLibrary, (param1), (param2))
+#define omrfile_blockingasync_drain() privateOmrPortLibrary->file_blockingasync_drain(privateOmrPortLibrary)
 #define omrfilestream_startup() privateOmrPortLibrary->filestream_startup(privatePortLibrary)
 #define omrfilestream_shutdown() privateOmrPortLibrary->filestream_shutdown(privatePortLibrary)
 #define omrfilestream_open(param1, param2, param3) privateOmrPortLibrary->filestream_open(privateOmrPortLibrary, (param1), (param2), (param3))
@@ -1896,6 +1943,7 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrsysinfo_cgroup_is_limits_enabled() privateOmrPortLibrary->sysinfo_cgroup_is_limits_enabled(privateOmrPortLibrary) 
 #define omrsysinfo_cgroup_enable_limits() privateOmrPortLibrary->sysinfo_cgroup_enable_limits(privateOmrPortLibrary)
 #define omrsysinfo_cgroup_get_memlimit(param1) privateOmrPortLibrary->sysinfo_cgroup_get_memlimit(privateOmrPortLibrary, param1)
+#define omrsysinfo_cgroup_get_cpulimit(param1) privateOmrPortLibrary->sysinfo_cgroup_get_cpulimit(privateOmrPortLibrary, param1)
 #define omrintrospect_startup() privateOmrPortLibrary->introspect_startup(privateOmrPortLibrary)
 #define omrintrospect_shutdown() privateOmrPortLibrary->introspect_shutdown(privateOmrPortLibrary)
 #define omrintrospect_set_suspend_signal_offset(param1) privateOmrPortLibrary->introspect_set_suspend_signal_offset(privateOmrPortLibrary, param1)
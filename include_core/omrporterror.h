@@ -281,6 +281,7 @@
 #define OMRPORT_ERROR_SYSINFO_CGROUP_LIMITS_DISABLED (OMRPORT_ERROR_SYSINFO_BASE-23)
 #define OMRPORT_ERROR_SYSINFO_CGROUP_NAME_NOT_AVAILABLE (OMRPORT_ERROR_SYSINFO_BASE-24)
 #define OMRPORT_ERROR_SYSINFO_CGROUP_MEMLIMIT_FILE_FOPEN_FAILED (OMRPORT_ERROR_SYSINFO_BASE-25)
+#define OMRPORT_ERROR_SYSINFO_CGROUP_CPULIMIT_NOT_SET (OMRPORT_ERROR_SYSINFO_BASE-26)
 
 /**
  * @name Port library initialization return codes
@@ -84,9 +84,25 @@ typedef struct J9ThreadCustomSpinOptions {
 } J9ThreadCustomSpinOptions;
 #endif /* OMR_THR_CUSTOM_SPIN_OPTIONS */
 
+#define J9THREAD_CONTENTION_NAME_LENGTH 32
+
+/*
+ * A sampled contended monitor enter, recorded when the monitor is released.
+ * Times are in GET_HIRES_CLOCK() units, like the JLM hold times.
+ */
+typedef struct J9ThreadContentionSample {
+	void *callsite;
+	struct J9ThreadMonitor *monitor;
+	uint64_t wait_time;
+	uint64_t hold_time;
+	char monitor_name[J9THREAD_CONTENTION_NAME_LENGTH];
+} J9ThreadContentionSample;
+
 typedef struct J9ThreadTracing {
 #if defined(OMR_THR_JLM_HOLD_TIMES)
 	uintptr_t pause_count;
+	struct J9ThreadContentionBuffer *contention_buffer;
+	uintptr_t contention_countdown;
 #endif /* OMR_THR_JLM_HOLD_TIMES */
 } J9ThreadTracing;
 
@@ -137,7 +153,17 @@ typedef struct J9ThreadMonitorTracing {
 	uint64_t holdtime_avg;
 	uintptr_t volatile holdtime_count;
 	uintptr_t enter_pause_count;
+	void *contention_callsite;
+	uint64_t contention_wait_time;
+	uint64_t contention_enter_time;
 #endif /* OMR_THR_JLM_HOLD_TIMES */
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+	uintptr_t spin_attempt_count;
+	uintptr_t spin_success_count;
+	uintptr_t spin_tune_attempt_count;
+	uintptr_t spin_tune_success_count;
+	uintptr_t spin_tune_count;
+#endif /* OMR_THR_ADAPTIVE_SPIN */
 } J9ThreadMonitorTracing;
 
 #define J9_ABSTRACT_MONITOR_FIELDS_1 \
@@ -53,7 +53,7 @@ extern "C" {
 #define UT_IPRINT_KEYWORD             "IPRINT"
 #define UT_EXCEPTION_KEYWORD          "EXCEPTION"
 #define UT_NONE_KEYWORD               "NONE"
-#define UT_OUTPUT_KEYWORD             "OUTPUT" /* deprecated */
+#define UT_OUTPUT_KEYWORD             "OUTPUT"
 #define UT_LEVEL_KEYWORD              "LEVEL"
 #define UT_SUSPEND_KEYWORD            "SUSPEND"
 #define UT_RESUME_KEYWORD             "RESUME"
@@ -89,6 +89,7 @@ typedef struct OMR_TraceThread {
 									 * for the tracepoint currently being formatted
 									 */
 	OMR_TraceBuffer *trcBuf;		/* Trace buffer                    */
+	OMR_TraceBuffer *spareBuf;		/* Released buffer kept for reuse  */
 	int32_t suspendResume;			/* Suspend / resume count          */
 	int recursion;					/* Trace recursion indicator       */
 	int indent;						/* Iprint indentation count        */
@@ -64,6 +64,7 @@ typedef char *(*FormatStringCallback)(const char *componentName, int32_t tracepo
 
 typedef struct UtTraceFileIterator UtTraceFileIterator;
 typedef struct UtTracePointIterator UtTracePointIterator;
+typedef struct UtTraceRingFileIterator UtTraceRingFileIterator;
 
 /**
  * @deprecated
@@ -163,6 +164,59 @@ uint64_t omr_trc_getBufferIteratorThreadId(UtTracePointIterator *iter);
  */
 uint32_t omr_trc_getBufferIteratorThreadName(UtTracePointIterator *iter, char *buffer, uint32_t buffLen);
 
+/**
+ * Obtain a UtTraceRingFileIterator for the trace ring file named in fileName, as
+ * written by the trace engine's output=<filename> option.
+ *
+ * The file may still be written to by a running process. The iterator starts at the
+ * oldest buffer in the file, and omr_trc_getTracePointIteratorForNextRingBuffer
+ * can be called repeatedly to tail the file as new buffers are written.
+ *
+ * @param[in] portLib An initialised OMRPortLibraryStructure.
+ * @param[in] fileName The name of the trace ring file to open.
+ * @param[in,out] iteratorPtr A pointer to a location where the initialised UtTraceRingFileIterator pointer can be stored.
+ * @param[in] getFormatString A callback the formatter can use to obtain a format string for a trace point id in a named module.
+ *
+ * @return OMR_ERROR_NONE on success
+ * @return OMR_ERROR_FILE_UNAVAILABLE if the specified file cannot be opened or mapped
+ * @return OMR_ERROR_NOT_AVAILABLE if the file is not a trace ring file, or is still being created
+ * @return OMR_ERROR_ILLEGAL_ARGUMENT if the file header is inconsistent
+ * @return OMR_ERROR_OUT_OF_NATIVE_MEMORY if memory for the iterator structure cannot be allocated.
+ */
+omr_error_t omr_trc_getTraceRingFileIterator(OMRPortLibrary *portLib, const char *fileName, UtTraceRingFileIterator **iteratorPtr, FormatStringCallback getFormatString);
+
+/**
+ * Free a trace ring file iterator and unmap and close its file.
+ * Any UtTracePointIterators returned by this iterator must be freed first.
+ *
+ * @param[in] iter the UtTraceRingFileIterator to free
+ * @return OMR_ERROR_NONE on success
+ */
+omr_error_t omr_trc_freeTraceRingFileIterator(UtTraceRingFileIterator *iter);
+
+/**
+ * Obtain an UtTracePointIterator for the next complete trace buffer in a trace ring file.
+ *
+ * Buffers are returned in the order they were published. If no new complete buffer is
+ * available yet, *bufferIteratorPtr will point to NULL; call again later to continue
+ * tailing the file. Buffers overwritten by the writer before they could be read are
+ * skipped and counted, see omr_trc_getTraceRingFileLostBuffers.
+ *
+ * @param[in] ringIter The UtTraceRingFileIterator to read from.
+ * @param[in,out] bufferIteratorPtr A pointer to a location where the initialised UtTracePointIterator pointer can be stored.
+ * @return OMR_ERROR_NONE on success, including if no new buffer is available.
+ * @return OMR_ERROR_OUT_OF_NATIVE_MEMORY if memory for the iterator structure cannot be allocated.
+ */
+omr_error_t omr_trc_getTracePointIteratorForNextRingBuffer(UtTraceRingFileIterator *ringIter, UtTracePointIterator **bufferIteratorPtr);
+
+/**
+ * Return the number of buffers the writer overwrote before this iterator could read them.
+ *
+ * @param[in] iter the UtTraceRingFileIterator
+ * @return the number of buffers skipped so far.
+ */
+uint64_t omr_trc_getTraceRingFileLostBuffers(UtTraceRingFileIterator *iter);
+
 #ifdef __cplusplus
 }
 #endif
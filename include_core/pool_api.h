@@ -113,6 +113,16 @@ pool_new(uintptr_t structSize,
 void *
 pool_newElement(J9Pool *aPool);
 
+/**
+* @brief
+* @param *aPool
+* @param count
+* @param **elements
+* @return uintptr_t
+*/
+uintptr_t
+pool_newElements(J9Pool *aPool, uintptr_t count, void **elements);
+
 
 /**
 * @brief
@@ -141,6 +151,16 @@ pool_numElements(J9Pool *aPool);
 void
 pool_removeElement(J9Pool *aPool, void *anElement);
 
+/**
+* @brief
+* @param *aPool
+* @param count
+* @param **elements
+* @return void
+*/
+void
+pool_removeElements(J9Pool *aPool, uintptr_t count, void **elements);
+
 
 /**
 * @brief
@@ -199,6 +219,51 @@ pool_ensureCapacity(J9Pool *aPool, uintptr_t newCapacity);
 uintptr_t
 pool_includesElement(J9Pool *aPool, void *anElement);
 
+/* ---------------- pool_magazine.c ---------------- */
+
+/**
+* @brief
+* @param *portLib
+* @param *aPool
+* @param batchSize
+* @return J9PoolMagazines *
+*/
+J9PoolMagazines *
+poolMagazines_new(struct OMRPortLibrary *portLib, J9Pool *aPool, uintptr_t batchSize);
+
+/**
+* @brief
+* @param *magazines
+* @return void
+*/
+void
+poolMagazines_kill(J9PoolMagazines *magazines);
+
+/**
+* @brief
+* @param *magazines
+* @return void *
+*/
+void *
+poolMagazines_newElement(J9PoolMagazines *magazines);
+
+/**
+* @brief
+* @param *magazines
+* @param *anElement
+* @return void
+*/
+void
+poolMagazines_removeElement(J9PoolMagazines *magazines, void *anElement);
+
+/**
+* @brief
+* @param *magazines
+* @return void
+*/
+void
+poolMagazines_flush(J9PoolMagazines *magazines);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,10 @@ extern "C" {
 #define J9THREAD_RWMUTEX_FAIL	 	 1
 #define J9THREAD_RWMUTEX_WOULDBLOCK -1
 
+/* flags for omrthread_rwmutex_init */
+#define J9THREAD_RWMUTEX_READER_BIASED		0x1
+#define J9THREAD_RWMUTEX_WRITER_PREFERENCE	0x2
+
 /* Define conversions for units of time used in thrprof.c */
 #define SEC_TO_NANO_CONVERSION_CONSTANT		1000 * 1000 * 1000
 #define MICRO_TO_NANO_CONVERSION_CONSTANT	1000
@@ -588,6 +592,38 @@ intptr_t
 omrthread_jlm_init(uintptr_t flags);
 #endif /* OMR_THR_JLM */
 
+
+#if (defined(OMR_THR_JLM))
+/**
+* @brief
+* @param samplingInterval
+* @param bufferSize
+* @return intptr_t
+*/
+intptr_t
+omrthread_jlm_contention_sampling_start(uintptr_t samplingInterval, uintptr_t bufferSize);
+
+
+/**
+* @brief
+* @param void
+* @return void
+*/
+void
+omrthread_jlm_contention_sampling_stop(void);
+
+
+/**
+* @brief
+* @param samples
+* @param maxSamples
+* @param droppedSamples
+* @return uintptr_t
+*/
+uintptr_t
+omrthread_jlm_contention_drain(J9ThreadContentionSample *samples, uintptr_t maxSamples, uintptr_t *droppedSamples);
+#endif /* OMR_THR_JLM */
+
 #if defined(OMR_THR_ADAPTIVE_SPIN)
 /**
  * @brief initializes jlm for capturing data needed by the adaptive spin options
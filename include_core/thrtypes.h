@@ -112,6 +112,11 @@ typedef struct J9ThreadLibrary {
 	struct J9Pool *thread_tracing_pool;
 	struct J9ThreadMonitorTracing *gc_lock_tracing;
 	uint64_t clock_skew;
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+	uintptr_t contentionSamplingInterval;
+	uintptr_t contentionBufferSize;
+	uintptr_t contentionDroppedSamples;
+#endif /* OMR_THR_JLM_HOLD_TIMES */
 #endif /* OMR_THR_JLM */
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 	uintptr_t defaultMonitorSpinCount1;
@@ -129,6 +134,8 @@ typedef struct J9ThreadLibrary {
 	uintptr_t adaptSpinSlowPercent;
 	uintptr_t adaptSpinSampleStopCount;
 	uintptr_t adaptSpinSampleCountStopRatio;
+	uintptr_t adaptSpinLoadPercent;
+	uintptr_t adaptSpinLoadTime;
 #endif /* OMR_THR_ADAPTIVE_SPIN */
 	OMRMemCategory threadLibraryCategory;
 	OMRMemCategory nativeStackCategory;
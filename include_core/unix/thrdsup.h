@@ -52,11 +52,33 @@
 
 typedef pthread_t OSTHREAD;
 typedef pthread_key_t TLSKEY;
+
+/**
+ * On Linux, the condition variables of the thread library are built directly on
+ * private futexes rather than pthread_cond_t. A waiter sleeps in a single
+ * FUTEX_WAIT_BITSET on the sequence word, and a notify is a single FUTEX_WAKE,
+ * skipped when nobody waits. Every condition is paired with a pthread mutex
+ * and, as with pthread_cond_t, may wake spuriously.
+ */
+#if defined(LINUX) && !defined(OMRZTPF)
+#define J9THREAD_USE_FUTEX_COND 1
+#else /* defined(LINUX) && !defined(OMRZTPF) */
+#define J9THREAD_USE_FUTEX_COND 0
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
+#if J9THREAD_USE_FUTEX_COND
+typedef struct J9FutexCond {
+	volatile uint32_t sequence; /**< the futex word, advanced by every notify */
+	volatile uintptr_t waiters; /**< number of threads waiting, or about to wait, on sequence */
+} J9FutexCond;
+typedef J9FutexCond COND;
+#else /* J9THREAD_USE_FUTEX_COND */
 typedef pthread_cond_t COND;
+#endif /* J9THREAD_USE_FUTEX_COND */
 
 #if defined(OMR_THR_FORK_SUPPORT)
 typedef pthread_mutex_t* J9OSMutex;
-typedef pthread_cond_t* J9OSCond;
+typedef COND* J9OSCond;
 #else /* defined(OMR_THR_FORK_SUPPORT) */
 typedef COND J9OSCond;
 typedef MUTEX J9OSMutex;
@@ -87,6 +109,10 @@ typedef intptr_t OSSEMAPHORE;
 #include "thrtypes.h"
 
 int linux_pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex, const struct timespec *abstime);
+#if J9THREAD_USE_FUTEX_COND
+int futex_cond_wait(J9FutexCond *cond, pthread_mutex_t *mutex, const struct timespec *abstime);
+int futex_cond_notify(J9FutexCond *cond, BOOLEAN notifyAll);
+#endif /* J9THREAD_USE_FUTEX_COND */
 intptr_t init_thread_library(void);
 intptr_t set_pthread_priority(pthread_t handle, omrthread_prio_t j9ThreadPriority);
 intptr_t set_pthread_name(pthread_t self, pthread_t thread, const char *name);
@@ -183,16 +209,26 @@ extern pthread_condattr_t *defaultCondAttr;
 #endif /* defined(OSX) */
 /* COND_DESTROY */
 
+#if J9THREAD_USE_FUTEX_COND
+#define COND_DESTROY(cond) 0
+#else /* J9THREAD_USE_FUTEX_COND */
 #define COND_DESTROY(cond) pthread_cond_destroy(&(cond))
+#endif /* J9THREAD_USE_FUTEX_COND */
 
 /* COND_WAIT */
 
 /* NOTE: the calling thread must already own mutex */
 /* NOTE: a timeout less than zero indicates infinity */
 
+#if J9THREAD_USE_FUTEX_COND
+#define PTHREAD_COND_WAIT(x,y) futex_cond_wait(x,y,NULL)
+#else /* J9THREAD_USE_FUTEX_COND */
+#define PTHREAD_COND_WAIT(x,y) pthread_cond_wait(x,y)
+#endif /* J9THREAD_USE_FUTEX_COND */
+
 #define COND_WAIT(cond, mutex) \
 	do {	\
-		pthread_cond_wait(&(cond), &(mutex))
+		PTHREAD_COND_WAIT(&(cond), &(mutex))
 
 #define COND_WAIT_LOOP()	} while(1)
 
@@ -249,6 +285,18 @@ extern pthread_condattr_t *defaultCondAttr;
 
 
 
+#if J9THREAD_USE_FUTEX_COND
+
+/* COND_NOTIFY_ALL */
+
+#define COND_NOTIFY_ALL(cond) futex_cond_notify(&(cond), TRUE)
+
+/* COND_NOTIFY */
+
+#define COND_NOTIFY(cond) futex_cond_notify(&(cond), FALSE)
+
+#else /* J9THREAD_USE_FUTEX_COND */
+
 /* COND_NOTIFY_ALL */
 
 #define COND_NOTIFY_ALL(cond) pthread_cond_broadcast(&(cond))
@@ -257,11 +305,15 @@ extern pthread_condattr_t *defaultCondAttr;
 
 #define COND_NOTIFY(cond) pthread_cond_signal(&(cond))
 
+#endif /* J9THREAD_USE_FUTEX_COND */
+
 /* COND_WAIT_IF_TIMEDOUT */
 
 /* NOTE: the calling thread must already own the mutex! */
 
-#if defined(LINUX) && defined(J9X86)
+#if J9THREAD_USE_FUTEX_COND
+#define PTHREAD_COND_TIMEDWAIT(x,y,z) futex_cond_wait(x,y,z)
+#elif defined(LINUX) && defined(J9X86)
 #define PTHREAD_COND_TIMEDWAIT(x,y,z) linux_pthread_cond_timedwait(x,y,z)
 #elif defined(OSX)
 #define PTHREAD_COND_TIMEDWAIT(x,y,z) pthread_cond_timedwait_relative_np(x,y,z)
@@ -288,7 +340,9 @@ extern pthread_condattr_t *defaultCondAttr;
 
 /* COND_INIT */
 
-#if J9THREAD_USE_MONOTONIC_COND_CLOCK
+#if J9THREAD_USE_FUTEX_COND
+#define COND_INIT(cond) ((cond).sequence = 0, (cond).waiters = 0, 1)
+#elif J9THREAD_USE_MONOTONIC_COND_CLOCK
 #define COND_INIT(cond) (pthread_cond_init(&(cond), defaultCondAttr) == 0)
 #else
 #define COND_INIT(cond) (pthread_cond_init(&(cond), NULL) == 0)
@@ -440,7 +494,7 @@ intptr_t j9OSCond_notifyAll(J9OSCond cond);
 
 #define OMROSCOND_WAIT(cond, mutex) \
 	do {	\
-		pthread_cond_wait((cond), (mutex))
+		PTHREAD_COND_WAIT((cond), (mutex))
 #define OMROSCOND_WAIT_LOOP()	} while(1)
 
 #define OMROSMUTEX_INIT(mutex) j9OSMutex_allocAndInit(&(mutex))
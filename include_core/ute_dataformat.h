@@ -247,6 +247,45 @@ typedef struct UtTraceFileHdr {
 	 */
 } UtTraceFileHdr;
 
+/*
+ * =============================================================================
+ * UtTraceRingFileHdr (UTRF)
+ *
+ * A trace ring file is a fixed size file, written through a shared memory
+ * mapping, that holds the most recent slotCount trace buffers. It is laid out as:
+ *
+ *   UtTraceRingFileHdr
+ *   UtTraceFileHdr and its sections, at metadataOffset
+ *   slotCount slots of slotSize bytes, at slotsOffset
+ *
+ * Each slot is a UtTraceRingSlotHdr followed by a UtTraceRecord of bufferSize
+ * bytes. Buffer n is written to slot (n % slotCount). While it is being written
+ * the slot sequence is (2n + 1), and once it is complete the sequence is (2n + 2).
+ * Slot sequences only increase: a writer claims the slot by atomically moving an
+ * older, even sequence to (2n + 1), and drops buffer n if a newer buffer has
+ * already claimed the slot.
+ * A reader that sees the same even sequence before and after copying a slot has
+ * a consistent copy of the buffer.
+ *
+ * The eyecatcher is written last, so a reader that finds it can trust the header.
+ * =============================================================================
+ */
+#define UT_TRACE_RING_FILE_HEADER_NAME "UTRF"
+typedef struct UtTraceRingFileHdr {
+	UtDataHeader header; /* Eyecatcher, version etc        */
+	int32_t endianSignature; /* 0x12345678 in host order       */
+	int32_t bufferSize; /* Trace buffer size              */
+	uint32_t slotSize; /* Bytes per slot                 */
+	uint32_t slotCount; /* Number of slots                */
+	uint64_t metadataOffset; /* Offset of UtTraceFileHdr       */
+	uint64_t slotsOffset; /* Offset of the first slot       */
+	volatile uint64_t nextSequence; /* Number of buffers ever claimed */
+} UtTraceRingFileHdr;
+
+typedef struct UtTraceRingSlotHdr {
+	volatile uint64_t sequence; /* See UtTraceRingFileHdr         */
+} UtTraceRingSlotHdr;
+
 #if defined(__cplusplus)
 }
 #endif /* defined(__cplusplus) */
@@ -48,10 +48,11 @@ extern "C" {
  */
 #define OMR_ENABLE_EXCEPTION_OUTPUT 0
 
-/* Temporarily allow and ignore the output=<filename> command-line option until
- * it has been removed from all test scripts.
+/* Allow the output=<filename>[,nnnk|nnnm] command-line option, which writes
+ * published trace buffers to a memory-mapped ring file.
  */
 #define OMR_ALLOW_OUTPUT_OPTION 1
+#define UT_DEFAULT_RING_FILE_SIZE     (4 * 1024 * 1024)
 
 #define UT_DEBUG                      "UTE_DEBUG"
 #if OMR_ENABLE_EXCEPTION_OUTPUT
@@ -234,8 +235,7 @@ struct OMR_TraceGlobal {
 	OMR_TraceBuffer *exceptionTrcBuf;	/* Exception trace buffers         */
 #endif /* OMR_ENABLE_EXCEPTION_OUTPUT */
 	OMR_TraceThread *lastPrint;		/* OMR_TraceThread for last print     */
-	OMR_TraceBuffer *freeQueue;		/* Free buffer queue               */
-	omrthread_monitor_t freeQueueLock;	/* lock for free queue */
+	OMR_TraceBuffer * volatile freeQueue;	/* Lock-free stack of free buffers */
 	UtTraceCfg *config;				/* Trace selection cmds link/list  */
 	UtTraceFileHdr *traceHeader;	/* Trace file header               */
 	UtComponentList *componentList;	/* registered or configured component */
@@ -251,6 +251,19 @@ struct OMR_TraceGlobal {
 	omrthread_monitor_t bufferPoolLock;	/* Lock for buffer pool. Do not allow tracepoints while locking, holding, or releasing this monitor. */
 	J9Pool *threadPool;				/* Pool for allocating all UtThreadData */
 	omrthread_monitor_t threadPoolLock;	/* Lock for thread pool. Do not allow tracepoints while locking, holding, or releasing this monitor. */
+	int32_t asyncPublish;			/* Hand full buffers to the publisher thread instead of notifying subscribers inline */
+	OMR_TraceBuffer * volatile publishQueue;	/* Lock-free stack of full buffers waiting for the publisher thread, newest first */
+	volatile uint32_t publishPending;	/* Number of buffers queued for, or being published by, the publisher thread */
+	volatile uint32_t publisherActive;	/* Non-zero while the publisher thread accepts buffers */
+	volatile uint32_t publisherWaiting;	/* Non-zero while the publisher thread is (about to be) waiting on publisherLock */
+	uint32_t publisherExited;		/* Set by the publisher thread after it has detached from trace */
+	omrthread_t publisherThread;	/* The publisher thread, or NULL if it was not started */
+	omrthread_monitor_t publisherLock;	/* Publisher thread, flushers and shutdown wait on this monitor */
+	char *ringFileName;				/* Trace ring file requested with output=, or NULL */
+	uint64_t ringFileSize;			/* Requested size of the trace ring file in bytes */
+	intptr_t ringFileHandle;		/* Open trace ring file, or -1 */
+	struct J9MmapHandle *ringFileMapping;	/* Shared writable mapping of the trace ring file */
+	UtTraceRingFileHdr *ringFile;	/* Start of the ring file mapping, or NULL if no ring file is being written */
 };
 
 /*
@@ -544,6 +557,68 @@ omr_error_t releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf
  */
 OMR_TraceBuffer *recycleTraceBuffer(OMR_TraceThread *currentThr);
 
+/**
+ * @brief Return a trace buffer to the global free queue.
+ *
+ * Unlike releaseTraceBuffer(), the buffer is never kept as the current thread's spare
+ * and its owner is not touched. Used for buffers that are not owned by the caller,
+ * and for a thread's spare buffer when the thread detaches from trace.
+ *
+ * @param[in] buf The trace buffer to free.
+ */
+void freeTraceBuffer(OMR_TraceBuffer *buf);
+
+/**
+ * @brief Start the thread that publishes full trace buffers asynchronously.
+ *
+ * Does nothing unless asynchronous publication was requested with the
+ * buffers=async option. If the thread cannot be started, buffers continue to be
+ * published synchronously by the threads that fill them.
+ *
+ * @return an OMR error code
+ */
+omr_error_t startTracePublisher(void);
+
+/**
+ * @brief Stop the asynchronous publisher thread.
+ *
+ * Blocks until the publisher thread has published all queued buffers and detached
+ * from trace. Buffers filled afterwards are published synchronously.
+ */
+void stopTracePublisher(void);
+
+/**
+ * @brief Wait until the asynchronous publisher thread has published all queued buffers.
+ */
+void flushTracePublisher(void);
+
+/**
+ * @brief Create and map the trace ring file requested with the output option.
+ *
+ * Does nothing if no ring file was requested. The file is truncated and sized so it
+ * can hold a whole number of trace buffers, and it starts with the trace metadata
+ * needed to format them.
+ *
+ * @return an OMR error code
+ */
+omr_error_t openTraceRingFile(void);
+
+/**
+ * @brief Copy a full trace buffer into the next slot of the trace ring file.
+ *
+ * Does nothing if no ring file is open. Safe to call concurrently.
+ *
+ * @param[in] buf The trace buffer to write.
+ */
+void writeTraceRingFile(OMR_TraceBuffer *buf);
+
+/**
+ * @brief Unmap and close the trace ring file and free its name.
+ *
+ * @param[in] global The trace engine's global data.
+ */
+void closeTraceRingFile(OMR_TraceGlobal *global);
+
 /*
  * =============================================================================
  *  Externs
@@ -125,6 +125,14 @@ omr_trc_startMultiThreading(OMR_VM *omrVM)
 {
 	if (omrVM->_trcEngine) {
 		OMR_TRACEGLOBAL(initState) = OMR_TRACE_ENGINE_MT_ENABLED;
+		/* Failure leaves trace without a ring file. */
+		omr_error_t rc = openTraceRingFile();
+		if (OMR_ERROR_NONE != rc) {
+			OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+			omrtty_printf("omr_trc_startMultiThreading: failed to open trace ring file %s, rc=%d\n", OMR_TRACEGLOBAL(ringFileName), rc);
+		}
+		/* Failure leaves buffer publication synchronous. */
+		startTracePublisher();
 	}
 }
 
@@ -278,10 +286,18 @@ postForkCleanupGlobals(OMR_TraceThread *thr)
 void
 postForkCleanupBuffers(OMR_TraceThread *thr)
 {
-	/* Clear all buffers in the pool and in freeQueue. */
+	/* Clear all buffers in the pool, in freeQueue and in publishQueue.
+	 * The publisher thread does not exist in the child, so publish synchronously.
+	 */
 	OMR_TRACEGLOBAL(freeQueue) = NULL;
+	OMR_TRACEGLOBAL(publishQueue) = NULL;
+	OMR_TRACEGLOBAL(publishPending) = 0;
+	OMR_TRACEGLOBAL(publisherActive) = 0;
+	OMR_TRACEGLOBAL(publisherWaiting) = 0;
+	OMR_TRACEGLOBAL(publisherThread) = NULL;
 	if (NULL != thr) {
 		thr->trcBuf = NULL;
+		thr->spareBuf = NULL;
 	}
 	pool_clear(OMR_TRACEGLOBAL(bufferPool));
 }
@@ -27,6 +27,8 @@
 #include "omrtraceformat.h"
 #include "omrtrace_internal.h"
 
+#include "AtomicSupport.hpp"
+
 #define ONEMILLION (1000000)
 
 struct UtTracePointIterator {
@@ -68,6 +70,21 @@ struct UtTraceFileIterator {
 	intptr_t currentPosition;
 };
 
+struct UtTraceRingFileIterator {
+	const UtTraceRingFileHdr *ringFile;
+	UtTraceSection *traceSection;
+	FormatStringCallback getFormatStringFn;
+	OMRPortLibrary *portLib;
+	intptr_t traceFileHandle;
+	J9MmapHandle *mapping;
+	uint64_t nextSequence;
+	uint64_t lostBuffers;
+};
+
+static UtTracePointIterator *allocateTracePointIterator(OMRPortLibrary *portLib, int32_t bufferSize);
+static void initTracePointIterator(UtTracePointIterator *iterator, int32_t bufferSize, UtTraceSection *traceSection,
+								   FormatStringCallback getFormatStringFn);
+
 omr_error_t
 omr_trc_getTraceFileIterator(OMRPortLibrary *portLib, char *fileName, UtTraceFileIterator **iteratorPtr,
 							 FormatStringCallback getFormatStringFn)
@@ -184,22 +201,11 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 {
 	UtTracePointIterator *iterator = NULL;
 	intptr_t bytesRead = -1;
-	uint64_t spanPlatform, spanSystem;
 
 	OMRPORT_ACCESS_FROM_OMRPORT(fileIterator->portLib);
 
-	iterator = (UtTracePointIterator *)omrmem_allocate_memory(sizeof(UtTracePointIterator), OMRMEM_CATEGORY_TRACE);
-	if (iterator == NULL) {
-		UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator\n"));
-		*bufferIteratorPtr = NULL;
-		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
-	}
-
-	iterator->buffer = (OMR_TraceBuffer *)omrmem_allocate_memory(
-			fileIterator->header->bufferSize + offsetof(OMR_TraceBuffer, record), OMRMEM_CATEGORY_TRACE);
-	if (iterator->buffer == NULL) {
-		UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator's buffer\n"));
-		omrmem_free_memory(iterator);
+	iterator = allocateTracePointIterator(fileIterator->portLib, fileIterator->header->bufferSize);
+	if (NULL == iterator) {
 		*bufferIteratorPtr = NULL;
 		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
 	}
@@ -219,23 +225,243 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 		}
 	}
 
-	iterator->recordLength = fileIterator->header->bufferSize;
+	initTracePointIterator(iterator, fileIterator->header->bufferSize, fileIterator->traceSection, fileIterator->getFormatStringFn);
+
+	UT_DBGOUT_CHECKED(2,
+			("<UT> omr_trc_getTracePointIteratorForNextBuffer: Thread %s returning iterator %p\n", iterator->buffer->record.threadName, iterator));
+
+	*bufferIteratorPtr = iterator;
+	return OMR_ERROR_NONE;
+
+}
+
+omr_error_t
+omr_trc_getTraceRingFileIterator(OMRPortLibrary *portLib, const char *fileName, UtTraceRingFileIterator **iteratorPtr,
+								 FormatStringCallback getFormatStringFn)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	omr_error_t rc = OMR_ERROR_NONE;
+	UtTraceRingFileIterator *iterator = NULL;
+	J9MmapHandle *mapping = NULL;
+	const UtTraceRingFileHdr *ringFile = NULL;
+	const UtTraceFileHdr *metadata = NULL;
+
+	*iteratorPtr = NULL;
+
+	intptr_t traceFileHandle = omrfile_open(fileName, EsOpenRead, 0);
+	if (traceFileHandle < 0) {
+		return OMR_ERROR_FILE_UNAVAILABLE;
+	}
+
+	/* Map the whole file. The writer sized it before writing the header, so it never grows. */
+	mapping = omrmmap_map_file(traceFileHandle, 0, 0, fileName, OMRPORT_MMAP_FLAG_READ, OMRMEM_CATEGORY_TRACE);
+	if (NULL == mapping) {
+		omrfile_close(traceFileHandle);
+		return OMR_ERROR_FILE_UNAVAILABLE;
+	}
+	ringFile = (const UtTraceRingFileHdr *)mapping->pointer;
+
+	if ((mapping->size < sizeof(UtTraceRingFileHdr))
+		|| (0 != memcmp(ringFile->header.eyecatcher, UT_TRACE_RING_FILE_HEADER_NAME, 4))
+	) {
+		/* Not a ring file, or the writer has not finished creating it yet. */
+		rc = OMR_ERROR_NOT_AVAILABLE;
+		goto fail;
+	}
+	VM_AtomicSupport::readBarrier();
+
+	/* TODO - As for trace files, files from platforms of the other endianness are not supported. */
+	if ((UT_ENDIAN_SIGNATURE != ringFile->endianSignature)
+		|| (ringFile->bufferSize < UT_MINIMUM_BUFFERSIZE)
+		|| (ringFile->slotSize < (sizeof(UtTraceRingSlotHdr) + ringFile->bufferSize))
+		|| (0 == ringFile->slotCount)
+		|| (ringFile->metadataOffset + sizeof(UtTraceFileHdr) > ringFile->slotsOffset)
+		|| (ringFile->slotsOffset + ((uint64_t)ringFile->slotCount * ringFile->slotSize) > mapping->size)
+	) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+		goto fail;
+	}
+
+	metadata = (const UtTraceFileHdr *)((const char *)ringFile + ringFile->metadataOffset);
+	if ((UT_ENDIAN_SIGNATURE != metadata->endianSignature)
+		|| (ringFile->metadataOffset + (uint64_t)metadata->header.length > ringFile->slotsOffset)
+		|| (metadata->traceStart + sizeof(UtTraceSection) > (uint64_t)metadata->header.length)
+	) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+		goto fail;
+	}
+
+	iterator = (UtTraceRingFileIterator *)omrmem_allocate_memory(sizeof(UtTraceRingFileIterator), OMRMEM_CATEGORY_TRACE);
+	if (NULL == iterator) {
+		rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		goto fail;
+	}
+
+	iterator->ringFile = ringFile;
+	iterator->traceSection = (UtTraceSection *)((char *)metadata + metadata->traceStart);
+	iterator->getFormatStringFn = getFormatStringFn;
+	iterator->portLib = OMRPORTLIB;
+	iterator->traceFileHandle = traceFileHandle;
+	iterator->mapping = mapping;
+	iterator->lostBuffers = 0;
+
+	/* Start with the oldest buffer still in the file. */
+	iterator->nextSequence = ringFile->nextSequence;
+	if (iterator->nextSequence > ringFile->slotCount) {
+		iterator->nextSequence -= ringFile->slotCount;
+	} else {
+		iterator->nextSequence = 0;
+	}
+
+	*iteratorPtr = iterator;
+	return OMR_ERROR_NONE;
+
+fail:
+	omrmmap_unmap_file(mapping);
+	omrfile_close(traceFileHandle);
+	return rc;
+}
+
+omr_error_t
+omr_trc_freeTraceRingFileIterator(UtTraceRingFileIterator *iter)
+{
+	if (NULL != iter) {
+		OMRPORT_ACCESS_FROM_OMRPORT(iter->portLib);
+		omrmmap_unmap_file(iter->mapping);
+		omrfile_close(iter->traceFileHandle);
+		omrmem_free_memory(iter);
+	}
+	return OMR_ERROR_NONE;
+}
+
+omr_error_t
+omr_trc_getTracePointIteratorForNextRingBuffer(UtTraceRingFileIterator *ringIterator, UtTracePointIterator **bufferIteratorPtr)
+{
+	const UtTraceRingFileHdr *ringFile = ringIterator->ringFile;
+	const uint32_t slotCount = ringFile->slotCount;
+	UtTracePointIterator *iterator = NULL;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(ringIterator->portLib);
+
+	*bufferIteratorPtr = NULL;
+
+	for (;;) {
+		const uint64_t writerSequence = ringFile->nextSequence;
+		VM_AtomicSupport::readBarrier();
+
+		if (ringIterator->nextSequence >= writerSequence) {
+			/* Caught up with the writer. */
+			break;
+		}
+		if ((writerSequence - ringIterator->nextSequence) > slotCount) {
+			/* The writer has lapped us; skip to the oldest buffer still in the file. */
+			ringIterator->lostBuffers += (writerSequence - slotCount) - ringIterator->nextSequence;
+			ringIterator->nextSequence = writerSequence - slotCount;
+		}
+
+		const uint64_t sequence = ringIterator->nextSequence;
+		const UtTraceRingSlotHdr *slot = (const UtTraceRingSlotHdr *)((const char *)ringFile + ringFile->slotsOffset
+			+ ((sequence % slotCount) * ringFile->slotSize));
+		const uint64_t complete = (sequence * 2) + 2;
+		const uint64_t before = slot->sequence;
+		VM_AtomicSupport::readBarrier();
+
+		if (before < complete) {
+			/* The writer has claimed this buffer but not finished copying it. */
+			break;
+		}
+		if (before == complete) {
+			if (NULL == iterator) {
+				iterator = allocateTracePointIterator(ringIterator->portLib, ringFile->bufferSize);
+				if (NULL == iterator) {
+					return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+				}
+			}
+			memcpy(&iterator->buffer->record, slot + 1, ringFile->bufferSize);
+			VM_AtomicSupport::readBarrier();
+			if (complete == slot->sequence) {
+				ringIterator->nextSequence = sequence + 1;
+				initTracePointIterator(iterator, ringFile->bufferSize, ringIterator->traceSection, ringIterator->getFormatStringFn);
+				*bufferIteratorPtr = iterator;
+				return OMR_ERROR_NONE;
+			}
+		}
+		/* The slot was overwritten by a later buffer before or while we copied it. */
+		ringIterator->lostBuffers += 1;
+		ringIterator->nextSequence = sequence + 1;
+	}
+
+	if (NULL != iterator) {
+		omrmem_free_memory(iterator->buffer);
+		omrmem_free_memory(iterator);
+	}
+	return OMR_ERROR_NONE;
+}
+
+uint64_t
+omr_trc_getTraceRingFileLostBuffers(UtTraceRingFileIterator *iter)
+{
+	return iter->lostBuffers;
+}
+
+/**
+ * Allocate a tracepoint iterator with a buffer large enough for one trace record.
+ * @param[in] portLib The port library.
+ * @param[in] bufferSize The trace record size.
+ * @return the iterator, or NULL if memory could not be allocated.
+ */
+static UtTracePointIterator *
+allocateTracePointIterator(OMRPortLibrary *portLib, int32_t bufferSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	UtTracePointIterator *iterator = (UtTracePointIterator *)omrmem_allocate_memory(sizeof(UtTracePointIterator), OMRMEM_CATEGORY_TRACE);
+	if (iterator == NULL) {
+		UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator\n"));
+		return NULL;
+	}
+
+	iterator->buffer = (OMR_TraceBuffer *)omrmem_allocate_memory(bufferSize + offsetof(OMR_TraceBuffer, record), OMRMEM_CATEGORY_TRACE);
+	if (iterator->buffer == NULL) {
+		UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator's buffer\n"));
+		omrmem_free_memory(iterator);
+		return NULL;
+	}
+	iterator->portLib = portLib;
+	return iterator;
+}
+
+/**
+ * Prepare an iterator to format the trace record copied into its buffer.
+ * @param[in] iterator The iterator, from allocateTracePointIterator().
+ * @param[in] bufferSize The trace record size.
+ * @param[in] traceSection The trace section of the metadata the record was written with.
+ * @param[in] getFormatStringFn The format string callback.
+ */
+static void
+initTracePointIterator(UtTracePointIterator *iterator, int32_t bufferSize, UtTraceSection *traceSection,
+					   FormatStringCallback getFormatStringFn)
+{
+	uint64_t spanPlatform, spanSystem;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(iterator->portLib);
+
+	iterator->recordLength = bufferSize;
 	iterator->end = iterator->buffer->record.nextEntry;
 	iterator->start = iterator->buffer->record.firstEntry;
 	iterator->dataLength = iterator->buffer->record.nextEntry - iterator->buffer->record.firstEntry;
 	iterator->currentUpperTimeWord = (uint64_t)(iterator->buffer->record.sequence) & J9CONST64(0xFFFFFFFF00000000);
 	iterator->currentPos = iterator->buffer->record.nextEntry;
-	iterator->startPlatform = fileIterator->traceSection->startPlatform;
-	iterator->startSystem = fileIterator->traceSection->startSystem;
+	iterator->startPlatform = traceSection->startPlatform;
+	iterator->startSystem = traceSection->startSystem;
 	iterator->endPlatform = omrtime_hires_clock(); /* TODO - Is there a better timestamp we can use here? */
 	iterator->endSystem = ((uint64_t) omrtime_current_time_millis()); /* TODO - Is there a better timestamp we can use here? */
-	iterator->portLib = fileIterator->portLib;
-	iterator->getFormatStringFn = fileIterator->getFormatStringFn;
+	iterator->getFormatStringFn = getFormatStringFn;
 
 	spanPlatform = iterator->endPlatform - iterator->startPlatform;
 	spanSystem = iterator->endSystem - iterator->startSystem;
 
-	iterator->timeConversion = spanPlatform / spanSystem;
+	iterator->timeConversion = (0 == spanSystem) ? 0 : (spanPlatform / spanSystem);
 	if (iterator->timeConversion == 0) {
 		/* this will be used as the divisor in formatting time stamps */
 		iterator->timeConversion = 1;
@@ -248,6 +474,7 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 #endif
 	iterator->isCircularBuffer = TRUE;
 	iterator->iteratorHasWrapped = FALSE;
+	iterator->tempBuffForWrappedTP = NULL;
 	iterator->processingIncompleteDueToPartialTracePoint = FALSE;
 	iterator->longTracePointLength = 0;
 
@@ -256,13 +483,7 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 	iterator->numberOfBytesInPlatformShort = (uint32_t)sizeof(short);
 
 	UT_DBGOUT_CHECKED(4,
-			("<UT> firstEntry: %d, offset of record: %ld buffer size: %d endianness %s\n", iterator->start, offsetof(OMR_TraceBuffer, record), fileIterator->header->bufferSize, (iterator->isBigEndian)?"bigEndian":"littleEndian"));
-	UT_DBGOUT_CHECKED(2,
-			("<UT> omr_trc_getTracePointIteratorForNextBuffer: Thread %s returning iterator %p\n", iterator->buffer->record.threadName, iterator));
-
-	*bufferIteratorPtr = iterator;
-	return OMR_ERROR_NONE;
-
+			("<UT> firstEntry: %d, offset of record: %ld buffer size: %d endianness %s\n", iterator->start, offsetof(OMR_TraceBuffer, record), bufferSize, (iterator->isBigEndian)?"bigEndian":"littleEndian"));
 }
 
 uint64_t
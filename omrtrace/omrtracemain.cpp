@@ -231,6 +231,14 @@ threadStop(OMR_TraceThread **thrSlot)
 		}
 	}
 
+	/*
+	 *  Return the thread's spare buffer to the global free queue
+	 */
+	if (NULL != thr->spareBuf) {
+		freeTraceBuffer(thr->spareBuf);
+		thr->spareBuf = NULL;
+	}
+
 	/*
 	 * Mark the thread detached from the trace engine. No more tracepoints after this.
 	 */
@@ -296,6 +304,9 @@ utTerminateTrace(void)
 		return OMR_ERROR_INTERNAL;
 	}
 
+	/* Publish any queued buffers while subscribers can still receive them. */
+	stopTracePublisher();
+
 	/* This is not threadsafe. We don't expect this function to be called concurrently. */
 	OMR_TraceEngineInitState oldState = OMR_TRACEGLOBAL(initState);
 	OMR_TRACEGLOBAL(initState) = OMR_TRACE_ENGINE_SHUTDOWN_STARTED;
@@ -403,8 +414,10 @@ freeTrace(void)
 	omrthread_monitor_destroy(global->subscribersLock);
 	global->subscribersLock = NULL;
 
-	omrthread_monitor_destroy(global->freeQueueLock);
-	global->freeQueueLock = NULL;
+	omrthread_monitor_destroy(global->publisherLock);
+	global->publisherLock = NULL;
+
+	closeTraceRingFile(global);
 
 	omrthread_monitor_destroy(global->traceLock);
 	global->traceLock = NULL;
@@ -499,6 +512,8 @@ initializeTrace(OMR_VM *vm, const char *datDir, const OMR_TraceLanguageInterface
 
 	tempGbl.dynamicBuffers = TRUE;
 	tempGbl.bufferSize = UT_DEFAULT_BUFFERSIZE;
+	tempGbl.ringFileSize = UT_DEFAULT_RING_FILE_SIZE;
+	tempGbl.ringFileHandle = -1;
 
 	/* Make the trace functions available to the rest of OMR */
 	/* OMRTODO Remove this. GC uses it to register the module.
@@ -548,8 +563,8 @@ initializeTrace(OMR_VM *vm, const char *datDir, const OMR_TraceLanguageInterface
 		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
 		goto fail;
 	}
-	if (0 != omrthread_monitor_init_with_name(&OMR_TRACEGLOBAL(freeQueueLock), 0, "Global Trace Free Queue")) {
-		UT_DBGOUT(1, ("<UT> Initialization of freeQueueLock failed\n"));
+	if (0 != omrthread_monitor_init_with_name(&OMR_TRACEGLOBAL(publisherLock), 0, "Global Trace Publisher")) {
+		UT_DBGOUT(1, ("<UT> Initialization of publisherLock failed\n"));
 		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
 		goto fail;
 	}
@@ -760,6 +775,7 @@ trcDeregisterRecordSubscriber(OMR_TraceThread *thr, UtSubscription *subscription
 static omr_error_t
 trcFlushTraceData(OMR_TraceThread *thr)
 {
+	flushTracePublisher();
 	return OMR_ERROR_NONE;
 }
 
@@ -966,7 +982,7 @@ destroyRecordSubscriber(OMR_TraceThread *thr, UtSubscription *subscription, BOOL
 	 */
 	delistRecordSubscriber(subscription);
 
-	if (NULL == OMR_TRACEGLOBAL(subscribers)) {
+	if ((NULL == OMR_TRACEGLOBAL(subscribers)) && (NULL == OMR_TRACEGLOBAL(ringFile))) {
 		OMR_TRACEGLOBAL(traceInCore) = TRUE;
 		UT_DBGOUT(5, ("<UT thr=" UT_POINTER_SPEC "> Set traceInCore to TRUE\n", thr));
 	}
@@ -205,7 +205,7 @@ parseBufferSize(const char *const str, const int argSize, BOOLEAN atRuntime)
 /*******************************************************************************
  * name        - setBuffers
  * description - Set the buffer size and type
- * parameters  - thr, string value of the property (nnnk|nnnm[,dynamic]), atRuntime
+ * parameters  - thr, string value of the property (nnnk|nnnm[,dynamic][,async]), atRuntime
  * returns     - UTE return code
  ******************************************************************************/
 static omr_error_t
@@ -245,6 +245,15 @@ setBuffers(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime)
 			OMR_TRACEGLOBAL(dynamicBuffers) = TRUE;
 		} else if (j9_cmdla_stricmp(localBuffer, "NODYNAMIC") == 0) {
 			OMR_TRACEGLOBAL(dynamicBuffers) = FALSE;
+		} else if ((j9_cmdla_stricmp(localBuffer, "ASYNC") == 0) || (j9_cmdla_stricmp(localBuffer, "NOASYNC") == 0)) {
+			if (!atRuntime) {
+				OMR_TRACEGLOBAL(asyncPublish) = (j9_cmdla_stricmp(localBuffer, "ASYNC") == 0) ? TRUE : FALSE;
+			} else {
+				/* The publisher thread is started with multithreading, so the mode is fixed by then */
+				UT_DBGOUT(1, ("<UT> Buffer publication mode cannot be changed at run-time\n"));
+				rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+				goto end;
+			}
 		} else {
 			if (!atRuntime) {
 				rc = parseBufferSize(localBuffer, argSize, atRuntime);
@@ -359,15 +368,86 @@ setException(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime)
 #if OMR_ALLOW_OUTPUT_OPTION
 /*******************************************************************************
  * name        - setOutput
- * description - Set the output filename and options
+ * description - Set the trace ring file name and size
  * parameters  - thr, string value of the property
- *               (filename[,nnnm][,generations]])
+ *               (filename[,nnnk|nnnm][,generations]]), atRuntime
+ *               generations is accepted and ignored
  * returns     - UTE return code
  ******************************************************************************/
 static omr_error_t
 setOutput(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime)
 {
-	return OMR_ERROR_NONE;
+	omr_error_t rc = OMR_ERROR_NONE;
+	const int numberOfArgs = (NULL == value) ? 0 : getParmNumber(value);
+	int argSize = 0;
+	const char *arg = NULL;
+	char *fileName = NULL;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+
+	/* The ring file is opened when trace goes multi-threaded and is never switched. */
+	if (atRuntime || (OMR_TRACE_ENGINE_MT_ENABLED == OMR_TRACEGLOBAL(initState))) {
+		reportCommandLineError(atRuntime, "-Xtrace:output cannot be changed once trace has started.");
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	if ((numberOfArgs < 1) || (numberOfArgs > 3)) {
+		reportCommandLineError(atRuntime, "-Xtrace:output expects a file name and an optional size.");
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	arg = getPositionalParm(1, value, &argSize);
+	if (0 == argSize) {
+		reportCommandLineError(atRuntime, "Empty file name passed to -Xtrace:output");
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+	fileName = (char *)omrmem_allocate_memory(argSize + 1, OMRMEM_CATEGORY_TRACE);
+	if (NULL == fileName) {
+		UT_DBGOUT(1, ("<UT> Out of memory in setOutput\n"));
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	strncpy(fileName, arg, argSize);
+	fileName[argSize] = '\0';
+
+	if (numberOfArgs >= 2) {
+		uint64_t size = 0;
+		uint64_t multiplier = 1;
+		int i = 0;
+
+		arg = getPositionalParm(2, value, &argSize);
+		for (i = 0; (i < argSize) && isdigit(arg[i]); i++) {
+			size = (size * 10) + (arg[i] - '0');
+		}
+		if ((i + 1) == argSize) {
+			switch (j9_cmdla_toupper(arg[i])) {
+			case 'K':
+				multiplier = 1024;
+				break;
+			case 'M':
+				multiplier = 1024 * 1024;
+				break;
+			default:
+				i = -1;
+				break;
+			}
+		} else if (i != argSize) {
+			i = -1;
+		}
+		if ((-1 == i) || (0 == size)) {
+			reportCommandLineError(atRuntime, "Invalid size for -Xtrace:output - \"%.*s\"", argSize, arg);
+			omrmem_free_memory(fileName);
+			return OMR_ERROR_ILLEGAL_ARGUMENT;
+		}
+		OMR_TRACEGLOBAL(ringFileSize) = size * multiplier;
+	}
+
+	if (NULL != OMR_TRACEGLOBAL(ringFileName)) {
+		omrmem_free_memory(OMR_TRACEGLOBAL(ringFileName));
+	}
+	OMR_TRACEGLOBAL(ringFileName) = fileName;
+	UT_DBGOUT(1, ("<UT> Trace ring file: %s, %llu bytes\n", fileName, OMR_TRACEGLOBAL(ringFileSize)));
+
+	return rc;
 }
 #endif /* OMR_ALLOW_OUTPUT_OPTION */
 
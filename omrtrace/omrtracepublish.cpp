@@ -23,8 +23,13 @@
 #include "AtomicSupport.hpp"
 
 #include "omrtrace_internal.h"
+#include "omrutil.h"
 #include "thread_api.h"
 
+static void notifySubscribers(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf);
+static void publishQueuedBuffers(OMR_TraceThread *currentThr, OMR_TraceBuffer *queue);
+static int J9THREAD_PROC tracePublisherThread(void *arg);
+
 omr_error_t
 publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 {
@@ -49,35 +54,41 @@ publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 		/* CAS is not needed because flags is modified only by the thread that owns the buffer */
 		buf->flags = newFlags;
 
-		omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
-		omrthread_monitor_enter(subscribersLock);
-		for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
-			subscription->dataLength = OMR_TRACEGLOBAL(bufferSize);
-			subscription->data = &(buf->record);
-
-			omr_error_t subscriberRc = subscription->subscriber(subscription);
-			if (OMR_ERROR_NONE != subscriberRc) {
-				/* If the subscriber callback fails, call the alarm callback and
-				 * remove the subscription.
-				 */
-				UtSubscription *subscriptionToDestroy = subscription;
-
-				/* adjust the loop iterator */
-				subscription = subscriptionToDestroy->prev;
+		if (0 != OMR_TRACEGLOBAL(publisherActive)) {
+			/* Hand the buffer to the publisher thread. The buffer is freed by whichever
+			 * thread publishes it, so it must not be released here.
+			 */
+			VM_AtomicSupport::addU32(&OMR_TRACEGLOBAL(publishPending), 1);
+			OMR_TraceBuffer *head = NULL;
+			do {
+				head = OMR_TRACEGLOBAL(publishQueue);
+				buf->next = head;
+			} while ((uintptr_t)head != VM_AtomicSupport::lockCompareExchange(
+				(volatile uintptr_t *)&OMR_TRACEGLOBAL(publishQueue), (uintptr_t)head, (uintptr_t)buf));
 
-				getTraceLock(currentThr);
-				destroyRecordSubscriber(currentThr, subscriptionToDestroy, 1);
-				freeTraceLock(currentThr);
+			/* The CAS above is a full barrier, so either the publisher sees the buffer
+			 * before it decides to wait, or we see that it is waiting.
+			 */
+			if (0 != OMR_TRACEGLOBAL(publisherWaiting)) {
+				omrthread_monitor_enter(OMR_TRACEGLOBAL(publisherLock));
+				omrthread_monitor_notify_all(OMR_TRACEGLOBAL(publisherLock));
+				omrthread_monitor_exit(OMR_TRACEGLOBAL(publisherLock));
+			}
 
-				if (NULL == subscription) {
-					break;
-				}
+			/* If the publisher stopped concurrently it may have missed the buffer. */
+			if (0 == OMR_TRACEGLOBAL(publisherActive)) {
+				OMR_TraceBuffer *queue = (OMR_TraceBuffer *)VM_AtomicSupport::set(
+					(volatile uintptr_t *)&OMR_TRACEGLOBAL(publishQueue), (uintptr_t)NULL);
+				publishQueuedBuffers(currentThr, queue);
 			}
+			goto done;
 		}
-		omrthread_monitor_exit(subscribersLock);
+
+		notifySubscribers(currentThr, buf);
 	}
 	releaseTraceBuffer(currentThr, buf);
 
+done:
 	decrementRecursionCounter(currentThr);
 	return rc;
 }
@@ -97,10 +108,15 @@ releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 		buf->thr->trcBuf = NULL;
 	}
 
-	omrthread_monitor_enter(OMR_TRACEGLOBAL(freeQueueLock));
-	buf->next = OMR_TRACEGLOBAL(freeQueue);
-	OMR_TRACEGLOBAL(freeQueue) = buf;
-	omrthread_monitor_exit(OMR_TRACEGLOBAL(freeQueueLock));
+	if ((NULL != currentThr) && (NULL == currentThr->spareBuf)) {
+		/* Keep the buffer for the current thread's next recycleTraceBuffer() call.
+		 * Only the current thread touches its spare, so no synchronization is needed.
+		 */
+		buf->next = NULL;
+		currentThr->spareBuf = buf;
+	} else {
+		freeTraceBuffer(buf);
+	}
 
 	decrementRecursionCounter(currentThr);
 	return OMR_ERROR_NONE;
@@ -111,14 +127,235 @@ recycleTraceBuffer(OMR_TraceThread *currentThr)
 {
 	incrementRecursionCounter(currentThr);
 
-	omrthread_monitor_enter(OMR_TRACEGLOBAL(freeQueueLock));
-	OMR_TraceBuffer *recycledBuf = OMR_TRACEGLOBAL(freeQueue);
-	if (recycledBuf) {
-		OMR_TRACEGLOBAL(freeQueue) = recycledBuf->next;
-		recycledBuf->next = NULL;
+	OMR_TraceBuffer *recycledBuf = currentThr->spareBuf;
+	if (NULL != recycledBuf) {
+		currentThr->spareBuf = NULL;
+	} else if (NULL != OMR_TRACEGLOBAL(freeQueue)) {
+		/* Popping a single element with CAS is subject to ABA, since buffers are reused.
+		 * Instead detach the whole stack, keep its head and push the remainder back.
+		 */
+		recycledBuf = (OMR_TraceBuffer *)VM_AtomicSupport::set(
+			(volatile uintptr_t *)&OMR_TRACEGLOBAL(freeQueue), (uintptr_t)NULL);
+		if (NULL != recycledBuf) {
+			OMR_TraceBuffer *rest = recycledBuf->next;
+			recycledBuf->next = NULL;
+			if (NULL != rest) {
+				OMR_TraceBuffer *tail = rest;
+				while (NULL != tail->next) {
+					tail = tail->next;
+				}
+				OMR_TraceBuffer *head = NULL;
+				do {
+					head = OMR_TRACEGLOBAL(freeQueue);
+					tail->next = head;
+				} while ((uintptr_t)head != VM_AtomicSupport::lockCompareExchange(
+					(volatile uintptr_t *)&OMR_TRACEGLOBAL(freeQueue), (uintptr_t)head, (uintptr_t)rest));
+			}
+		}
 	}
-	omrthread_monitor_exit(OMR_TRACEGLOBAL(freeQueueLock));
 
 	decrementRecursionCounter(currentThr);
 	return recycledBuf;
 }
+
+void
+freeTraceBuffer(OMR_TraceBuffer *buf)
+{
+	OMR_TraceBuffer *head = NULL;
+	do {
+		head = OMR_TRACEGLOBAL(freeQueue);
+		buf->next = head;
+	} while ((uintptr_t)head != VM_AtomicSupport::lockCompareExchange(
+		(volatile uintptr_t *)&OMR_TRACEGLOBAL(freeQueue), (uintptr_t)head, (uintptr_t)buf));
+}
+
+/**
+ * Pass a full buffer to the trace ring file and to every registered subscriber,
+ * removing subscribers that fail.
+ * @param[in] currentThr The current thread.
+ * @param[in] buf The trace buffer to publish.
+ */
+static void
+notifySubscribers(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
+{
+	writeTraceRingFile(buf);
+
+	omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
+	omrthread_monitor_enter(subscribersLock);
+	for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
+		subscription->dataLength = OMR_TRACEGLOBAL(bufferSize);
+		subscription->data = &(buf->record);
+
+		omr_error_t subscriberRc = subscription->subscriber(subscription);
+		if (OMR_ERROR_NONE != subscriberRc) {
+			/* If the subscriber callback fails, call the alarm callback and
+			 * remove the subscription.
+			 */
+			UtSubscription *subscriptionToDestroy = subscription;
+
+			/* adjust the loop iterator */
+			subscription = subscriptionToDestroy->prev;
+
+			getTraceLock(currentThr);
+			destroyRecordSubscriber(currentThr, subscriptionToDestroy, 1);
+			freeTraceLock(currentThr);
+
+			if (NULL == subscription) {
+				break;
+			}
+		}
+	}
+	omrthread_monitor_exit(subscribersLock);
+}
+
+/**
+ * Publish and free a list of buffers detached from the publish queue.
+ * @param[in] currentThr The current thread.
+ * @param[in] queue The detached queue, newest buffer first. May be NULL.
+ */
+static void
+publishQueuedBuffers(OMR_TraceThread *currentThr, OMR_TraceBuffer *queue)
+{
+	/* Reverse the list so buffers are published in the order they filled up. */
+	OMR_TraceBuffer *ordered = NULL;
+	while (NULL != queue) {
+		OMR_TraceBuffer *next = queue->next;
+		queue->next = ordered;
+		ordered = queue;
+		queue = next;
+	}
+
+	while (NULL != ordered) {
+		OMR_TraceBuffer *buf = ordered;
+		ordered = buf->next;
+		buf->next = NULL;
+		notifySubscribers(currentThr, buf);
+		freeTraceBuffer(buf);
+		if (0 == VM_AtomicSupport::subtractU32(&OMR_TRACEGLOBAL(publishPending), 1)) {
+			/* Wake any thread waiting in flushTracePublisher(). */
+			omrthread_monitor_enter(OMR_TRACEGLOBAL(publisherLock));
+			omrthread_monitor_notify_all(OMR_TRACEGLOBAL(publisherLock));
+			omrthread_monitor_exit(OMR_TRACEGLOBAL(publisherLock));
+		}
+	}
+}
+
+static int J9THREAD_PROC
+tracePublisherThread(void *arg)
+{
+	omrthread_monitor_t const publisherLock = OMR_TRACEGLOBAL(publisherLock);
+	OMR_TraceThread *thr = NULL;
+
+	threadStart(&thr, omrthread_self(), "Trace Publisher", omrthread_self(), NULL);
+
+	omrthread_monitor_enter(publisherLock);
+	if (NULL != thr) {
+		/* Don't trace this thread's own activity. */
+		incrementRecursionCounter(thr);
+		OMR_TRACEGLOBAL(publisherActive) = 1;
+	} else {
+		OMR_TRACEGLOBAL(publisherExited) = 1;
+	}
+	omrthread_monitor_notify_all(publisherLock);
+	omrthread_monitor_exit(publisherLock);
+
+	if (NULL == thr) {
+		UT_DBGOUT(1, ("<UT> Trace publisher thread failed to attach to trace\n"));
+		return 0;
+	}
+
+	for (;;) {
+		OMR_TraceBuffer *queue = (OMR_TraceBuffer *)VM_AtomicSupport::set(
+			(volatile uintptr_t *)&OMR_TRACEGLOBAL(publishQueue), (uintptr_t)NULL);
+		if (NULL != queue) {
+			publishQueuedBuffers(thr, queue);
+		} else if (0 == OMR_TRACEGLOBAL(publisherActive)) {
+			break;
+		} else {
+			omrthread_monitor_enter(publisherLock);
+			OMR_TRACEGLOBAL(publisherWaiting) = 1;
+			VM_AtomicSupport::readWriteBarrier();
+			if ((NULL == OMR_TRACEGLOBAL(publishQueue)) && (0 != OMR_TRACEGLOBAL(publisherActive))) {
+				omrthread_monitor_wait(publisherLock);
+			}
+			OMR_TRACEGLOBAL(publisherWaiting) = 0;
+			omrthread_monitor_exit(publisherLock);
+		}
+	}
+
+	decrementRecursionCounter(thr);
+	threadStop(&thr);
+
+	omrthread_monitor_enter(publisherLock);
+	OMR_TRACEGLOBAL(publisherExited) = 1;
+	omrthread_monitor_notify_all(publisherLock);
+	omrthread_exit(publisherLock);
+	return 0;
+}
+
+omr_error_t
+startTracePublisher(void)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	/* traceInCore is not checked: subscribers usually register after multithreading starts. */
+	if (OMR_TRACEGLOBAL(asyncPublish) && (NULL == OMR_TRACEGLOBAL(publisherThread))) {
+		omrthread_monitor_t const publisherLock = OMR_TRACEGLOBAL(publisherLock);
+		omrthread_t publisherThread = NULL;
+
+		omrthread_monitor_enter(publisherLock);
+		OMR_TRACEGLOBAL(publisherExited) = 0;
+		if (0 != createThreadWithCategory(&publisherThread, 0, J9THREAD_PRIORITY_NORMAL, 0,
+				tracePublisherThread, NULL, J9THREAD_CATEGORY_SYSTEM_THREAD)) {
+			UT_DBGOUT(1, ("<UT> Unable to start trace publisher thread, publishing synchronously\n"));
+			rc = OMR_ERROR_FAILED_TO_ATTACH_NATIVE_THREAD;
+		} else {
+			/* Wait until the thread has either attached to trace or given up. */
+			while ((0 == OMR_TRACEGLOBAL(publisherActive)) && (0 == OMR_TRACEGLOBAL(publisherExited))) {
+				omrthread_monitor_wait(publisherLock);
+			}
+			if (0 != OMR_TRACEGLOBAL(publisherActive)) {
+				OMR_TRACEGLOBAL(publisherThread) = publisherThread;
+			} else {
+				rc = OMR_ERROR_FAILED_TO_ATTACH_NATIVE_THREAD;
+			}
+		}
+		omrthread_monitor_exit(publisherLock);
+	}
+	return rc;
+}
+
+void
+stopTracePublisher(void)
+{
+	if (NULL != OMR_TRACEGLOBAL(publisherThread)) {
+		omrthread_monitor_t const publisherLock = OMR_TRACEGLOBAL(publisherLock);
+
+		omrthread_monitor_enter(publisherLock);
+		OMR_TRACEGLOBAL(publisherActive) = 0;
+		/* Pairs with the barrier in publishTraceBuffer(): a producer either sees the publisher
+		 * is inactive, or queued its buffer early enough for the publisher's final drain.
+		 */
+		VM_AtomicSupport::readWriteBarrier();
+		omrthread_monitor_notify_all(publisherLock);
+		while (0 == OMR_TRACEGLOBAL(publisherExited)) {
+			omrthread_monitor_wait(publisherLock);
+		}
+		omrthread_monitor_exit(publisherLock);
+		OMR_TRACEGLOBAL(publisherThread) = NULL;
+	}
+}
+
+void
+flushTracePublisher(void)
+{
+	if (NULL != OMR_TRACEGLOBAL(publisherThread)) {
+		omrthread_monitor_t const publisherLock = OMR_TRACEGLOBAL(publisherLock);
+
+		omrthread_monitor_enter(publisherLock);
+		while ((0 != OMR_TRACEGLOBAL(publishPending)) && (0 == OMR_TRACEGLOBAL(publisherExited))) {
+			omrthread_monitor_wait(publisherLock);
+		}
+		omrthread_monitor_exit(publisherLock);
+	}
+}
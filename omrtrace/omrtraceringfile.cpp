@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include <string.h>
+
+#include "AtomicSupport.hpp"
+
+#include "omrtrace_internal.h"
+
+#define UT_RING_FILE_ALIGNMENT 64
+#define UT_RING_FILE_ALIGN(size) ((((uint64_t)(size)) + UT_RING_FILE_ALIGNMENT - 1) & ~(uint64_t)(UT_RING_FILE_ALIGNMENT - 1))
+
+omr_error_t
+openTraceRingFile(void)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	const char *fileName = OMR_TRACEGLOBAL(ringFileName);
+	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+
+	if ((NULL == fileName) || (NULL != OMR_TRACEGLOBAL(ringFile))) {
+		return OMR_ERROR_NONE;
+	}
+
+	if (OMR_ERROR_NONE != initTraceHeader()) {
+		return OMR_ERROR_INTERNAL;
+	}
+	const UtTraceFileHdr *metadata = OMR_TRACEGLOBAL(traceHeader);
+
+	const uint64_t slotSize = UT_RING_FILE_ALIGN(sizeof(UtTraceRingSlotHdr) + OMR_TRACEGLOBAL(bufferSize));
+	const uint64_t metadataOffset = UT_RING_FILE_ALIGN(sizeof(UtTraceRingFileHdr));
+	const uint64_t slotsOffset = UT_RING_FILE_ALIGN(metadataOffset + metadata->header.length);
+	uint64_t slotCount = 0;
+	if (OMR_TRACEGLOBAL(ringFileSize) > slotsOffset) {
+		slotCount = (OMR_TRACEGLOBAL(ringFileSize) - slotsOffset) / slotSize;
+	}
+	if (slotCount < 2) {
+		UT_DBGOUT(1, ("<UT> Trace ring file %s of %llu bytes cannot hold two trace buffers\n", fileName, OMR_TRACEGLOBAL(ringFileSize)));
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+	if (slotCount > (uint64_t)UINT32_MAX) {
+		slotCount = UINT32_MAX;
+	}
+	const uint64_t fileSize = slotsOffset + (slotCount * slotSize);
+
+	if (0 == (omrmmap_capabilities() & OMRPORT_MMAP_CAPABILITY_WRITE)) {
+		UT_DBGOUT(1, ("<UT> Trace ring file %s requires writable file mappings\n", fileName));
+		return OMR_ERROR_NOT_AVAILABLE;
+	}
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		UT_DBGOUT(1, ("<UT> Unable to open trace ring file %s\n", fileName));
+		return OMR_ERROR_FILE_UNAVAILABLE;
+	}
+	/* Size the file up front. The slots read as zero, i.e. never written, until they are used. */
+	if (0 != omrfile_set_length(fd, (int64_t)fileSize)) {
+		UT_DBGOUT(1, ("<UT> Unable to size trace ring file %s to %llu bytes\n", fileName, fileSize));
+		rc = OMR_ERROR_FILE_UNAVAILABLE;
+		goto fail;
+	}
+
+	{
+		J9MmapHandle *mapping = omrmmap_map_file(fd, 0, (uintptr_t)fileSize, fileName, OMRPORT_MMAP_FLAG_WRITE, OMRMEM_CATEGORY_TRACE);
+		if (NULL == mapping) {
+			UT_DBGOUT(1, ("<UT> Unable to map trace ring file %s\n", fileName));
+			rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+			goto fail;
+		}
+
+		UtTraceRingFileHdr *ringFile = (UtTraceRingFileHdr *)mapping->pointer;
+		memcpy((char *)ringFile + metadataOffset, metadata, metadata->header.length);
+		ringFile->endianSignature = UT_ENDIAN_SIGNATURE;
+		ringFile->bufferSize = OMR_TRACEGLOBAL(bufferSize);
+		ringFile->slotSize = (uint32_t)slotSize;
+		ringFile->slotCount = (uint32_t)slotCount;
+		ringFile->metadataOffset = metadataOffset;
+		ringFile->slotsOffset = slotsOffset;
+		ringFile->nextSequence = 0;
+		/* Publish the eyecatcher last so a concurrent reader never sees a partial header. */
+		VM_AtomicSupport::writeBarrier();
+		initHeader(&ringFile->header, UT_TRACE_RING_FILE_HEADER_NAME, sizeof(UtTraceRingFileHdr));
+
+		OMR_TRACEGLOBAL(ringFileHandle) = fd;
+		OMR_TRACEGLOBAL(ringFileMapping) = mapping;
+		OMR_TRACEGLOBAL(ringFile) = ringFile;
+
+		/* Buffers must be published for the ring file to see them, even without subscribers. */
+		OMR_TRACEGLOBAL(traceInCore) = FALSE;
+		UT_DBGOUT(1, ("<UT> Writing trace to ring file %s, %u slots of %llu bytes\n", fileName, (uint32_t)slotCount, slotSize));
+	}
+	return OMR_ERROR_NONE;
+
+fail:
+	omrfile_close(fd);
+	return rc;
+}
+
+void
+writeTraceRingFile(OMR_TraceBuffer *buf)
+{
+	UtTraceRingFileHdr *ringFile = OMR_TRACEGLOBAL(ringFile);
+
+	if (NULL != ringFile) {
+		const uint64_t sequence = VM_AtomicSupport::addU64(&ringFile->nextSequence, 1) - 1;
+		const uint64_t writing = (sequence * 2) + 1;
+		UtTraceRingSlotHdr *slot = (UtTraceRingSlotHdr *)((char *)ringFile + ringFile->slotsOffset
+			+ ((sequence % ringFile->slotCount) * ringFile->slotSize));
+
+		/*
+		 * Publishers whose sequence numbers are slotCount apart share a slot, so the slot must be claimed.
+		 * Wait for an older buffer that is still being written, and drop this buffer if a newer one has
+		 * already claimed the slot: the ring file only keeps the most recent buffers.
+		 */
+		for (;;) {
+			uint64_t current = slot->sequence;
+			if (current >= writing) {
+				return;
+			}
+			if (0 != (current & 1)) {
+				VM_AtomicSupport::yieldCPU();
+			} else if (current == VM_AtomicSupport::lockCompareExchangeU64(&slot->sequence, current, writing)) {
+				break;
+			}
+		}
+
+		VM_AtomicSupport::writeBarrier();
+		memcpy(slot + 1, &buf->record, ringFile->bufferSize);
+		VM_AtomicSupport::writeBarrier();
+		VM_AtomicSupport::setU64(&slot->sequence, writing + 1);
+	}
+}
+
+void
+closeTraceRingFile(OMR_TraceGlobal *global)
+{
+	if (NULL != global->ringFileMapping) {
+		OMRPORT_ACCESS_FROM_OMRPORT(global->portLibrary);
+		omrmmap_unmap_file(global->ringFileMapping);
+		omrfile_close(global->ringFileHandle);
+		global->ringFileMapping = NULL;
+		global->ringFile = NULL;
+		global->ringFileHandle = -1;
+	}
+	if (NULL != global->ringFileName) {
+		OMRPORT_ACCESS_FROM_OMRPORT(global->portLibrary);
+		omrmem_free_memory(global->ringFileName);
+		global->ringFileName = NULL;
+	}
+}
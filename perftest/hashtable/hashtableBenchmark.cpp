@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+/**
+ * Compare hashTableAdd and hashTableFind throughput of the chained J9HashTable against the
+ * J9HASH_TABLE_OPEN_ADDRESSING mode. Each table size is filled from empty, so the insert figures
+ * include growing the table, and is then probed once for every key present and once for as many
+ * keys that are absent.
+ *
+ * Usage: omrperfhashtable [maxEntries [rounds]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "hashtable_api.h"
+
+#define DEFAULT_MAX_ENTRIES (1024 * 1024)
+#define DEFAULT_ROUNDS 5
+
+typedef struct BenchmarkEntry {
+	uintptr_t key;
+	uintptr_t value;
+} BenchmarkEntry;
+
+typedef struct BenchmarkResult {
+	uint64_t insertMicros;
+	uint64_t hitMicros;
+	uint64_t missMicros;
+} BenchmarkResult;
+
+static uintptr_t
+entryHash(void *entry, void *userData)
+{
+	/* pointer-like keys hashed by identity, as most VM tables do */
+	return ((BenchmarkEntry *)entry)->key;
+}
+
+static uintptr_t
+entryEqual(void *leftEntry, void *rightEntry, void *userData)
+{
+	return ((BenchmarkEntry *)leftEntry)->key == ((BenchmarkEntry *)rightEntry)->key;
+}
+
+/**
+ * Fill a table of the given kind with the first entryCount keys and probe it, keeping the best of rounds runs.
+ */
+static void
+runTable(OMRPortLibrary *portLibrary, uint32_t flags, const uintptr_t *keys, uintptr_t entryCount, uintptr_t rounds, BenchmarkResult *result)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t found = 0;
+
+	result->insertMicros = (uint64_t)-1;
+	result->hitMicros = (uint64_t)-1;
+	result->missMicros = (uint64_t)-1;
+
+	for (uintptr_t round = 0; round < rounds; round++) {
+		J9HashTable *table = hashTableNew(portLibrary, OMR_GET_CALLSITE(), 0, sizeof(BenchmarkEntry), 0, flags, OMRMEM_CATEGORY_PORT_LIBRARY, entryHash, entryEqual, NULL, NULL);
+		if (NULL == table) {
+			fprintf(stderr, "hashTableNew failed\n");
+			exit(-1);
+		}
+
+		uint64_t start = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < entryCount; i++) {
+			BenchmarkEntry entry = {keys[i], i};
+			if (NULL == hashTableAdd(table, &entry)) {
+				fprintf(stderr, "hashTableAdd failed\n");
+				exit(-1);
+			}
+		}
+		uint64_t end = omrtime_hires_clock();
+		uint64_t micros = omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (micros < result->insertMicros) {
+			result->insertMicros = micros;
+		}
+
+		/* probe in a different order than the keys were added in */
+		start = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < entryCount; i++) {
+			BenchmarkEntry entry = {keys[(i * 7919) % entryCount], 0};
+			if (NULL != hashTableFind(table, &entry)) {
+				found += 1;
+			}
+		}
+		end = omrtime_hires_clock();
+		micros = omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (micros < result->hitMicros) {
+			result->hitMicros = micros;
+		}
+
+		start = omrtime_hires_clock();
+		for (uintptr_t i = entryCount; i < (2 * entryCount); i++) {
+			BenchmarkEntry entry = {keys[i], 0};
+			if (NULL != hashTableFind(table, &entry)) {
+				found += 1;
+			}
+		}
+		end = omrtime_hires_clock();
+		micros = omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (micros < result->missMicros) {
+			result->missMicros = micros;
+		}
+
+		hashTableFree(table);
+	}
+
+	if (found != (entryCount * rounds)) {
+		fprintf(stderr, "Found %zu entries, expected %zu\n", found, entryCount * rounds);
+		exit(-1);
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	intptr_t rc = 0;
+	OMRPortLibrary portLibrary;
+
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uintptr_t maxEntries = DEFAULT_MAX_ENTRIES;
+	uintptr_t rounds = DEFAULT_ROUNDS;
+	if (1 < argc) {
+		maxEntries = (uintptr_t)atoi(argv[1]);
+	}
+	if (2 < argc) {
+		rounds = (uintptr_t)atoi(argv[2]);
+	}
+	if (0 == maxEntries) {
+		maxEntries = 1;
+	}
+	if (0 == rounds) {
+		rounds = 1;
+	}
+
+	/* distinct, aligned, pointer-like keys: the first half are added, the second half are only probed for */
+	uintptr_t *keys = (uintptr_t *)omrmem_allocate_memory(sizeof(uintptr_t) * 2 * maxEntries, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == keys) {
+		fprintf(stderr, "Failed to allocate benchmark keys\n");
+		return -1;
+	}
+	for (uintptr_t i = 0; i < (2 * maxEntries); i++) {
+		keys[i] = (i + 1) * 3 * sizeof(uintptr_t);
+	}
+	uintptr_t seed = 12345;
+	for (uintptr_t i = (2 * maxEntries) - 1; i > 0; i--) {
+		seed = (seed * 1103515245) + 12345;
+		uintptr_t j = (seed >> 8) % (i + 1);
+		uintptr_t key = keys[i];
+		keys[i] = keys[j];
+		keys[j] = key;
+	}
+
+	omrtty_printf("J9HashTable throughput in Mops/s, best of %zu rounds\n", rounds);
+	omrtty_printf("   Entries    chained add  open add   chained hit  open hit   chained miss  open miss\n");
+	omrtty_printf("-------------------------------------------------------------------------------------\n");
+	for (uintptr_t entryCount = 1024; entryCount <= maxEntries; entryCount *= 4) {
+		BenchmarkResult chained;
+		BenchmarkResult open;
+		double operations = (double)entryCount;
+
+		runTable(&portLibrary, 0, keys, entryCount, rounds, &chained);
+		runTable(&portLibrary, J9HASH_TABLE_OPEN_ADDRESSING, keys, entryCount, rounds, &open);
+
+		omrtty_printf("%10zu %14.2f %9.2f %13.2f %9.2f %14.2f %10.2f\n", entryCount,
+			operations / (double)(chained.insertMicros + 1), operations / (double)(open.insertMicros + 1),
+			operations / (double)(chained.hitMicros + 1), operations / (double)(open.hitMicros + 1),
+			operations / (double)(chained.missMicros + 1), operations / (double)(open.missMicros + 1));
+	}
+
+	omrmem_free_memory(keys);
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return 0;
+}
@@ -0,0 +1,211 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+/**
+ * Measure omrmem_allocate_memory/omrmem_free_memory throughput as allocating threads are added.
+ * Every thread keeps a window of small blocks live and replaces the oldest one on each iteration,
+ * the way pools and hashtables churn their nodes. Each thread count is run first with the basic
+ * malloc-backed allocator and then, on the same port library, with the slab allocator enabled
+ * through OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE.
+ *
+ * Usage: omrperfmemslab [maxThreads [iterationsPerThread]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#define WINDOW_SIZE 64
+#define MAX_BLOCK_SIZE 512
+#define DEFAULT_ITERATIONS 1000000
+#define SLAB_ARENA_SIZE ((uintptr_t)256 * 1024 * 1024)
+
+typedef struct BenchmarkState {
+	OMRPortLibrary *portLibrary;
+	uintptr_t iterations;
+	uintptr_t threadsToStart;
+	uintptr_t threadsRunning;
+	omrthread_monitor_t monitor;
+} BenchmarkState;
+
+static int J9THREAD_PROC
+churnThread(void *arg)
+{
+	BenchmarkState *state = (BenchmarkState *)arg;
+	OMRPORT_ACCESS_FROM_OMRPORT(state->portLibrary);
+	void *window[WINDOW_SIZE];
+	uintptr_t seed = (uintptr_t)&window;
+
+	memset(window, 0, sizeof(window));
+
+	/* wait for all threads to be started so that they contend from the first iteration */
+	omrthread_monitor_enter(state->monitor);
+	state->threadsToStart -= 1;
+	if (0 == state->threadsToStart) {
+		omrthread_monitor_notify_all(state->monitor);
+	} else {
+		while (0 != state->threadsToStart) {
+			omrthread_monitor_wait(state->monitor);
+		}
+	}
+	omrthread_monitor_exit(state->monitor);
+
+	for (uintptr_t i = 0; i < state->iterations; i++) {
+		uintptr_t slot = i % WINDOW_SIZE;
+
+		/* sizes skewed towards small blocks, as most native allocations are */
+		seed = (seed * 1103515245) + 12345;
+		uintptr_t size = ((seed >> 16) % MAX_BLOCK_SIZE) >> ((seed >> 8) & 3);
+
+		omrmem_free_memory(window[slot]);
+		window[slot] = omrmem_allocate_memory(size, OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == window[slot]) {
+			fprintf(stderr, "omrmem_allocate_memory failed\n");
+			exit(-1);
+		}
+	}
+	for (uintptr_t slot = 0; slot < WINDOW_SIZE; slot++) {
+		omrmem_free_memory(window[slot]);
+	}
+
+	omrthread_monitor_enter(state->monitor);
+	state->threadsRunning -= 1;
+	omrthread_monitor_notify_all(state->monitor);
+	omrthread_monitor_exit(state->monitor);
+	return 0;
+}
+
+/**
+ * Run threadCount threads against the allocator and return the elapsed time in microseconds.
+ */
+static uint64_t
+runChurn(BenchmarkState *state, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(state->portLibrary);
+	state->threadsToStart = threadCount;
+	state->threadsRunning = threadCount;
+
+	uint64_t start = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, churnThread, state)) {
+			fprintf(stderr, "omrthread_create failed\n");
+			exit(-1);
+		}
+	}
+	omrthread_monitor_enter(state->monitor);
+	while (0 != state->threadsRunning) {
+		omrthread_monitor_wait(state->monitor);
+	}
+	omrthread_monitor_exit(state->monitor);
+	uint64_t end = omrtime_hires_clock();
+
+	return omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+}
+
+int
+main(int argc, char **argv)
+{
+	intptr_t rc = 0;
+	OMRPortLibrary portLibrary;
+
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uintptr_t maxThreads = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE) * 2;
+	uintptr_t iterations = DEFAULT_ITERATIONS;
+	if (1 < argc) {
+		maxThreads = (uintptr_t)atoi(argv[1]);
+	}
+	if (2 < argc) {
+		iterations = (uintptr_t)atoi(argv[2]);
+	}
+	if (0 == maxThreads) {
+		maxThreads = 1;
+	}
+
+	BenchmarkState state;
+	memset(&state, 0, sizeof(state));
+	if (0 != omrthread_monitor_init_with_name(&state.monitor, 0, "memory slab benchmark")) {
+		fprintf(stderr, "Failed to allocate benchmark state\n");
+		return -1;
+	}
+	state.portLibrary = &portLibrary;
+	state.iterations = iterations;
+
+	/* the slab allocator cannot be disabled once enabled, so all malloc-backed runs go first */
+	uintptr_t runCount = 0;
+	for (uintptr_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+		runCount += 1;
+	}
+	uint64_t *basicMicros = (uint64_t *)omrmem_allocate_memory(sizeof(uint64_t) * runCount, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == basicMicros) {
+		fprintf(stderr, "Failed to allocate benchmark state\n");
+		return -1;
+	}
+	uintptr_t run = 0;
+	for (uintptr_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+		basicMicros[run] = runChurn(&state, threadCount);
+		run += 1;
+	}
+
+	if (0 != omrport_control(OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE, SLAB_ARENA_SIZE)) {
+		fprintf(stderr, "Failed to enable the slab allocator\n");
+		return -1;
+	}
+
+	omrtty_printf("Native allocation throughput, %zu iterations of one free and one allocate per thread\n", iterations);
+	omrtty_printf("Threads        malloc (Mops/s)      slab (Mops/s)\n");
+	omrtty_printf("--------------------------------------------------\n");
+	run = 0;
+	for (uintptr_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+		double operations = (double)threadCount * (double)iterations * 2;
+		uint64_t slabMicros = runChurn(&state, threadCount);
+
+		omrtty_printf("%7zu      %17.2f    %15.2f\n", threadCount,
+			operations / (double)(basicMicros[run] + 1), operations / (double)(slabMicros + 1));
+		run += 1;
+	}
+
+	omrmem_free_memory(basicMicros);
+	omrthread_monitor_destroy(state.monitor);
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return 0;
+}
@@ -46,4 +46,19 @@ omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+omr_perfregionlist:
+	./omrperfregionlist
+
+omr_perfmemslab:
+	./omrperfmemslab
+
+omr_perfhashtable:
+	./omrperfhashtable
+
+omr_perfrangetree:
+	./omrperfrangetree
+
+omr_perfrwmutex:
+	./omrperfrwmutex
+
+.PHONY: all test omr_perfgctest omr_perfregionlist omr_perfmemslab omr_perfhashtable omr_perfrangetree omr_perfrwmutex 
@@ -0,0 +1,261 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+
+/**
+ * Compare range lookups in a J9AVLTree, searched with a range comparator as the JIT
+ * metadata trees are, against btree_findRange. Ranges model compiled method bodies laid
+ * out back to back in a code cache. Each tree size is built from ranges in shuffled order
+ * and then probed at random PCs inside the ranges.
+ *
+ * Usage: omrperfrangetree [maxRanges [rounds]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "avl_api.h"
+
+#define DEFAULT_MAX_RANGES (256 * 1024)
+#define DEFAULT_ROUNDS 5
+#define LOOKUPS_PER_RANGE 4
+
+typedef struct BenchmarkRange {
+	J9AVLTreeNode avlNode;
+	uintptr_t start;
+	uintptr_t end;
+} BenchmarkRange;
+
+typedef struct BenchmarkResult {
+	uint64_t insertMicros;
+	uint64_t lookupMicros;
+} BenchmarkResult;
+
+static intptr_t
+rangeInsertionComparator(J9AVLTree *tree, J9AVLTreeNode *insertNode, J9AVLTreeNode *walkNode)
+{
+	uintptr_t insertStart = ((BenchmarkRange *)insertNode)->start;
+	uintptr_t walkStart = ((BenchmarkRange *)walkNode)->start;
+
+	return (insertStart < walkStart) ? -1 : ((insertStart > walkStart) ? 1 : 0);
+}
+
+static intptr_t
+rangeSearchComparator(J9AVLTree *tree, uintptr_t address, J9AVLTreeNode *walkNode)
+{
+	BenchmarkRange *range = (BenchmarkRange *)walkNode;
+
+	if (address < range->start) {
+		return -1;
+	}
+	return (address >= range->end) ? 1 : 0;
+}
+
+static void
+keepBest(uint64_t start, uint64_t end, OMRPortLibrary *portLibrary, uint64_t *best)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint64_t micros = omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	if (micros < *best) {
+		*best = micros;
+	}
+}
+
+static void
+runAVL(OMRPortLibrary *portLibrary, BenchmarkRange *ranges, const uintptr_t *order, const uintptr_t *pcs, uintptr_t rangeCount, uintptr_t rounds, BenchmarkResult *result)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t found = 0;
+
+	result->insertMicros = (uint64_t)-1;
+	result->lookupMicros = (uint64_t)-1;
+
+	for (uintptr_t round = 0; round < rounds; round++) {
+		J9AVLTree tree;
+		memset(&tree, 0, sizeof(tree));
+		tree.insertionComparator = rangeInsertionComparator;
+		tree.searchComparator = rangeSearchComparator;
+		memset(ranges, 0, rangeCount * sizeof(BenchmarkRange));
+
+		uint64_t start = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < rangeCount; i++) {
+			BenchmarkRange *range = &ranges[order[i]];
+			range->start = order[i] * 0x1000;
+			range->end = range->start + 0x800 + (order[i] % 0x7F0);
+			if (&range->avlNode != avl_insert(&tree, &range->avlNode)) {
+				fprintf(stderr, "avl_insert failed\n");
+				exit(-1);
+			}
+		}
+		keepBest(start, omrtime_hires_clock(), portLibrary, &result->insertMicros);
+
+		start = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < (rangeCount * LOOKUPS_PER_RANGE); i++) {
+			if (NULL != avl_search(&tree, pcs[i])) {
+				found += 1;
+			}
+		}
+		keepBest(start, omrtime_hires_clock(), portLibrary, &result->lookupMicros);
+	}
+
+	if (found != (rangeCount * LOOKUPS_PER_RANGE * rounds)) {
+		fprintf(stderr, "AVL found %zu ranges, expected %zu\n", found, rangeCount * LOOKUPS_PER_RANGE * rounds);
+		exit(-1);
+	}
+}
+
+static void
+runBTree(OMRPortLibrary *portLibrary, BenchmarkRange *ranges, const uintptr_t *order, const uintptr_t *pcs, uintptr_t rangeCount, uintptr_t rounds, BenchmarkResult *result)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t found = 0;
+
+	result->insertMicros = (uint64_t)-1;
+	result->lookupMicros = (uint64_t)-1;
+
+	for (uintptr_t round = 0; round < rounds; round++) {
+		J9BTree *tree = btree_new(portLibrary, OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == tree) {
+			fprintf(stderr, "btree_new failed\n");
+			exit(-1);
+		}
+
+		uint64_t start = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < rangeCount; i++) {
+			BenchmarkRange *range = &ranges[order[i]];
+			range->start = order[i] * 0x1000;
+			range->end = range->start + 0x800 + (order[i] % 0x7F0);
+			if (range != btree_insert(tree, range->start, range->end, range)) {
+				fprintf(stderr, "btree_insert failed\n");
+				exit(-1);
+			}
+		}
+		keepBest(start, omrtime_hires_clock(), portLibrary, &result->insertMicros);
+
+		start = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < (rangeCount * LOOKUPS_PER_RANGE); i++) {
+			if (NULL != btree_findRange(tree, pcs[i])) {
+				found += 1;
+			}
+		}
+		keepBest(start, omrtime_hires_clock(), portLibrary, &result->lookupMicros);
+
+		btree_free(tree);
+	}
+
+	if (found != (rangeCount * LOOKUPS_PER_RANGE * rounds)) {
+		fprintf(stderr, "B-tree found %zu ranges, expected %zu\n", found, rangeCount * LOOKUPS_PER_RANGE * rounds);
+		exit(-1);
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	intptr_t rc = 0;
+	OMRPortLibrary portLibrary;
+
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uintptr_t maxRanges = DEFAULT_MAX_RANGES;
+	uintptr_t rounds = DEFAULT_ROUNDS;
+	if (1 < argc) {
+		maxRanges = (uintptr_t)atoi(argv[1]);
+	}
+	if (2 < argc) {
+		rounds = (uintptr_t)atoi(argv[2]);
+	}
+	if (0 == maxRanges) {
+		maxRanges = 1;
+	}
+	if (0 == rounds) {
+		rounds = 1;
+	}
+
+	BenchmarkRange *ranges = (BenchmarkRange *)omrmem_allocate_memory(sizeof(BenchmarkRange) * maxRanges, OMRMEM_CATEGORY_PORT_LIBRARY);
+	uintptr_t *order = (uintptr_t *)omrmem_allocate_memory(sizeof(uintptr_t) * maxRanges, OMRMEM_CATEGORY_PORT_LIBRARY);
+	uintptr_t *pcs = (uintptr_t *)omrmem_allocate_memory(sizeof(uintptr_t) * maxRanges * LOOKUPS_PER_RANGE, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == ranges) || (NULL == order) || (NULL == pcs)) {
+		fprintf(stderr, "Failed to allocate benchmark ranges\n");
+		return -1;
+	}
+
+	omrtty_printf("Range tree throughput in Mops/s, best of %zu rounds\n", rounds);
+	omrtty_printf("    Ranges    AVL insert  B-tree insert    AVL lookup  B-tree lookup\n");
+	omrtty_printf("---------------------------------------------------------------------\n");
+	for (uintptr_t rangeCount = 1024; rangeCount <= maxRanges; rangeCount *= 4) {
+		BenchmarkResult avl;
+		BenchmarkResult btree;
+		uintptr_t seed = 12345;
+
+		/* range i covers [i * 4K, i * 4K + 2K + (i % 2032)): insert in shuffled order, look up random PCs inside */
+		for (uintptr_t i = 0; i < rangeCount; i++) {
+			order[i] = i;
+		}
+		for (uintptr_t i = rangeCount - 1; i > 0; i--) {
+			seed = (seed * 1103515245) + 12345;
+			uintptr_t j = (seed >> 8) % (i + 1);
+			uintptr_t swap = order[i];
+			order[i] = order[j];
+			order[j] = swap;
+		}
+		for (uintptr_t i = 0; i < (rangeCount * LOOKUPS_PER_RANGE); i++) {
+			seed = (seed * 1103515245) + 12345;
+			uintptr_t index = (seed >> 8) % rangeCount;
+			pcs[i] = (index * 0x1000) + ((seed >> 4) % 0x800);
+		}
+
+		runAVL(&portLibrary, ranges, order, pcs, rangeCount, rounds, &avl);
+		runBTree(&portLibrary, ranges, order, pcs, rangeCount, rounds, &btree);
+
+		omrtty_printf("%10zu %13.2f %14.2f %13.2f %14.2f\n", rangeCount,
+			(double)rangeCount / (double)(avl.insertMicros + 1), (double)rangeCount / (double)(btree.insertMicros + 1),
+			(double)(rangeCount * LOOKUPS_PER_RANGE) / (double)(avl.lookupMicros + 1),
+			(double)(rangeCount * LOOKUPS_PER_RANGE) / (double)(btree.lookupMicros + 1));
+	}
+
+	omrmem_free_memory(pcs);
+	omrmem_free_memory(order);
+	omrmem_free_memory(ranges);
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return 0;
+}
@@ -0,0 +1,237 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+/**
+ * Measure the throughput of segregated region free lists as allocating threads are added.
+ * Every thread repeatedly takes a few regions off the shared single free list, the way an allocation
+ * context refills a size class, and returns them, the way sweep frees them. The locking and the
+ * lock-free implementations are run over the same region table for each thread count.
+ *
+ * Usage: omrperfregionlist [maxThreads [iterationsPerThread]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "LockFreeHeapRegionList.hpp"
+#include "LockingFreeHeapRegionList.hpp"
+
+#define REGION_COUNT 4096
+#define REGIONS_PER_REFILL 4
+#define DEFAULT_ITERATIONS 1000000
+
+typedef struct BenchmarkState {
+	MM_FreeHeapRegionList *list;
+	uintptr_t iterations;
+	uintptr_t threadsToStart;
+	uintptr_t threadsRunning;
+	omrthread_monitor_t monitor;
+} BenchmarkState;
+
+static int J9THREAD_PROC
+refillThread(void *arg)
+{
+	BenchmarkState *state = (BenchmarkState *)arg;
+	MM_HeapRegionDescriptorSegregated *held[REGIONS_PER_REFILL];
+
+	/* wait for all threads to be started so that they contend from the first iteration */
+	omrthread_monitor_enter(state->monitor);
+	state->threadsToStart -= 1;
+	if (0 == state->threadsToStart) {
+		omrthread_monitor_notify_all(state->monitor);
+	} else {
+		while (0 != state->threadsToStart) {
+			omrthread_monitor_wait(state->monitor);
+		}
+	}
+	omrthread_monitor_exit(state->monitor);
+
+	for (uintptr_t i = 0; i < state->iterations; i++) {
+		uintptr_t count = 0;
+		while (count < REGIONS_PER_REFILL) {
+			held[count] = state->list->pop();
+			if (NULL == held[count]) {
+				break;
+			}
+			count += 1;
+		}
+		while (0 < count) {
+			count -= 1;
+			state->list->push(held[count]);
+		}
+	}
+
+	omrthread_monitor_enter(state->monitor);
+	state->threadsRunning -= 1;
+	omrthread_monitor_notify_all(state->monitor);
+	omrthread_monitor_exit(state->monitor);
+	return 0;
+}
+
+/**
+ * Run threadCount threads against the list and return the elapsed time in microseconds.
+ */
+static uint64_t
+runRefills(OMRPortLibrary *portLibrary, BenchmarkState *state, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	state->threadsToStart = threadCount;
+	state->threadsRunning = threadCount;
+
+	uint64_t start = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, refillThread, state)) {
+			fprintf(stderr, "omrthread_create failed\n");
+			exit(-1);
+		}
+	}
+	omrthread_monitor_enter(state->monitor);
+	while (0 != state->threadsRunning) {
+		omrthread_monitor_wait(state->monitor);
+	}
+	omrthread_monitor_exit(state->monitor);
+	uint64_t end = omrtime_hires_clock();
+
+	return omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+}
+
+static void
+fillList(MM_FreeHeapRegionList *list, MM_HeapRegionDescriptorSegregated *regionTable)
+{
+	for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+		list->push(&regionTable[i]);
+	}
+}
+
+static void
+drainList(MM_FreeHeapRegionList *list)
+{
+	while (NULL != list->pop()) {
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	intptr_t rc = 0;
+	OMRPortLibrary portLibrary;
+
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uintptr_t maxThreads = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE) * 2;
+	uintptr_t iterations = DEFAULT_ITERATIONS;
+	if (1 < argc) {
+		maxThreads = (uintptr_t)atoi(argv[1]);
+	}
+	if (2 < argc) {
+		iterations = (uintptr_t)atoi(argv[2]);
+	}
+	if (0 == maxThreads) {
+		maxThreads = 1;
+	}
+
+	/* The lists only use the link fields of the descriptors, so a zeroed table stands in for the heap region table */
+	uintptr_t tableSize = sizeof(MM_HeapRegionDescriptorSegregated) * REGION_COUNT;
+	MM_HeapRegionDescriptorSegregated *regionTable = (MM_HeapRegionDescriptorSegregated *)omrmem_allocate_memory(tableSize, OMRMEM_CATEGORY_MM);
+	void *lockingStorage = omrmem_allocate_memory(sizeof(MM_LockingFreeHeapRegionList), OMRMEM_CATEGORY_MM);
+	void *lockFreeStorage = omrmem_allocate_memory(sizeof(MM_LockFreeHeapRegionList), OMRMEM_CATEGORY_MM);
+	BenchmarkState state;
+	memset(&state, 0, sizeof(state));
+	if ((NULL == regionTable) || (NULL == lockingStorage) || (NULL == lockFreeStorage)
+		|| (0 != omrthread_monitor_init_with_name(&state.monitor, 0, "region list benchmark"))
+	) {
+		fprintf(stderr, "Failed to allocate benchmark state\n");
+		return -1;
+	}
+	memset((void *)regionTable, 0, tableSize);
+
+	MM_LockingFreeHeapRegionList *lockingList = new (lockingStorage) MM_LockingFreeHeapRegionList(MM_HeapRegionList::HRL_KIND_FREE, true);
+	MM_LockFreeHeapRegionList *lockFreeList = new (lockFreeStorage) MM_LockFreeHeapRegionList(MM_HeapRegionList::HRL_KIND_FREE, regionTable, sizeof(MM_HeapRegionDescriptorSegregated));
+	if (!lockingList->initialize(NULL) || !lockFreeList->initialize(NULL)) {
+		fprintf(stderr, "Failed to initialize region lists\n");
+		return -1;
+	}
+
+	state.iterations = iterations;
+	omrtty_printf("Region free list refill throughput, %zu iterations of %d regions per thread\n", iterations, REGIONS_PER_REFILL);
+	omrtty_printf("Threads      Locking (Mops/s)    LockFree (Mops/s)\n");
+	omrtty_printf("--------------------------------------------------\n");
+	for (uintptr_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+		double operations = (double)threadCount * (double)iterations * REGIONS_PER_REFILL * 2;
+
+		fillList(lockingList, regionTable);
+		state.list = lockingList;
+		uint64_t lockingMicros = runRefills(&portLibrary, &state, threadCount);
+		drainList(lockingList);
+
+		fillList(lockFreeList, regionTable);
+		state.list = lockFreeList;
+		uint64_t lockFreeMicros = runRefills(&portLibrary, &state, threadCount);
+		drainList(lockFreeList);
+
+		omrtty_printf("%7zu      %16.2f    %17.2f\n", threadCount,
+			operations / (double)(lockingMicros + 1), operations / (double)(lockFreeMicros + 1));
+	}
+
+	lockingList->tearDown(NULL);
+	lockFreeList->tearDown(NULL);
+	omrthread_monitor_destroy(state.monitor);
+	omrmem_free_memory(lockFreeStorage);
+	omrmem_free_memory(lockingStorage);
+	omrmem_free_memory(regionTable);
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return 0;
+}
+
+#else /* OMR_GC_SEGREGATED_HEAP */
+
+int
+main(int argc, char **argv)
+{
+	fprintf(stderr, "omrperfregionlist requires a build with OMR_GC_SEGREGATED_HEAP enabled\n");
+	return 0;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+
+
+/**
+ * Measure omrthread_rwmutex_enter_read/exit_read throughput of the default rwmutex against a
+ * J9THREAD_RWMUTEX_READER_BIASED one, from 1 thread up to maxThreads threads in powers of two.
+ * Every thread enters and exits the same mutex for read in a loop for the given time. If a write
+ * interval is given, the main thread also enters the mutex for write at that interval, so that
+ * the figures include the cost of revoking the bias.
+ *
+ * Usage: omrperfrwmutex [maxThreads [millis [writeIntervalMillis]]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "thread_api.h"
+
+#define DEFAULT_MAX_THREADS 128
+#define DEFAULT_MILLIS 500
+#define DEFAULT_WRITE_INTERVAL_MILLIS 0
+
+typedef struct BenchmarkInfo {
+	omrthread_rwmutex_t mutex;
+	omrthread_monitor_t synchronization;
+	uintptr_t threadsReady;
+	uintptr_t threadsRunning;
+	volatile uintptr_t go;
+	volatile uintptr_t stop;
+	uintptr_t totalReads;
+} BenchmarkInfo;
+
+static int J9THREAD_PROC
+readerThread(void *arg)
+{
+	BenchmarkInfo *info = (BenchmarkInfo *)arg;
+	uintptr_t reads = 0;
+
+	omrthread_monitor_enter(info->synchronization);
+	info->threadsReady += 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	while (0 == info->go) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+
+	while (0 == info->stop) {
+		omrthread_rwmutex_enter_read(info->mutex);
+		omrthread_rwmutex_exit_read(info->mutex);
+		reads += 1;
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	info->totalReads += reads;
+	info->threadsRunning -= 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	omrthread_monitor_exit(info->synchronization);
+
+	return 0;
+}
+
+/**
+ * Run threadCount readers on a rwmutex created with flags for millis milliseconds.
+ *
+ * @return the read acquisitions per second, in millions
+ */
+static double
+runReaders(OMRPortLibrary *portLibrary, uintptr_t flags, uintptr_t threadCount, uintptr_t millis, uintptr_t writeIntervalMillis)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	BenchmarkInfo info;
+
+	info.threadsReady = 0;
+	info.threadsRunning = threadCount;
+	info.go = 0;
+	info.stop = 0;
+	info.totalReads = 0;
+	if ((0 != omrthread_rwmutex_init(&info.mutex, flags, "benchmark rwmutex"))
+		|| (0 != omrthread_monitor_init_with_name(&info.synchronization, 0, "benchmark monitor"))
+	) {
+		fprintf(stderr, "Failed to create the benchmark rwmutex\n");
+		exit(-1);
+	}
+
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, 0, readerThread, &info)) {
+			fprintf(stderr, "Failed to create reader thread %zu\n", i);
+			exit(-1);
+		}
+	}
+
+	/* start every reader at once, once they have all been created */
+	omrthread_monitor_enter(info.synchronization);
+	while (info.threadsReady < threadCount) {
+		omrthread_monitor_wait(info.synchronization);
+	}
+	info.go = 1;
+	omrthread_monitor_notify_all(info.synchronization);
+	omrthread_monitor_exit(info.synchronization);
+
+	uint64_t start = omrtime_hires_clock();
+	if (0 == writeIntervalMillis) {
+		omrthread_sleep(millis);
+	} else {
+		for (uintptr_t elapsed = 0; elapsed < millis; elapsed += writeIntervalMillis) {
+			omrthread_sleep(writeIntervalMillis);
+			omrthread_rwmutex_enter_write(info.mutex);
+			omrthread_rwmutex_exit_write(info.mutex);
+		}
+	}
+	info.stop = 1;
+	uint64_t end = omrtime_hires_clock();
+
+	omrthread_monitor_enter(info.synchronization);
+	while (0 != info.threadsRunning) {
+		omrthread_monitor_wait(info.synchronization);
+	}
+	omrthread_monitor_exit(info.synchronization);
+
+	omrthread_monitor_destroy(info.synchronization);
+	omrthread_rwmutex_destroy(info.mutex);
+
+	uint64_t micros = omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	return (double)info.totalReads / (double)(micros + 1);
+}
+
+int
+main(int argc, char **argv)
+{
+	intptr_t rc = 0;
+	OMRPortLibrary portLibrary;
+
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uintptr_t maxThreads = DEFAULT_MAX_THREADS;
+	uintptr_t millis = DEFAULT_MILLIS;
+	uintptr_t writeIntervalMillis = DEFAULT_WRITE_INTERVAL_MILLIS;
+	if (1 < argc) {
+		maxThreads = (uintptr_t)atoi(argv[1]);
+	}
+	if (2 < argc) {
+		millis = (uintptr_t)atoi(argv[2]);
+	}
+	if (3 < argc) {
+		writeIntervalMillis = (uintptr_t)atoi(argv[3]);
+	}
+	if (0 == maxThreads) {
+		maxThreads = 1;
+	}
+	if (0 == millis) {
+		millis = 1;
+	}
+
+	omrtty_printf("omrthread_rwmutex read acquisitions in Mops/s over %zu ms", millis);
+	if (0 != writeIntervalMillis) {
+		omrtty_printf(", with a write every %zu ms", writeIntervalMillis);
+	}
+	omrtty_printf("\n   Threads    default    reader biased\n");
+	omrtty_printf("----------------------------------------\n");
+	for (uintptr_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+		double monitored = runReaders(&portLibrary, 0, threadCount, millis, writeIntervalMillis);
+		double biased = runReaders(&portLibrary, J9THREAD_RWMUTEX_READER_BIASED, threadCount, millis, writeIntervalMillis);
+
+		omrtty_printf("%10zu %10.2f %16.2f\n", threadCount, monitored, biased);
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return 0;
+}
@@ -166,6 +166,35 @@ omrfile_blockingasync_flength(struct OMRPortLibrary *portLibrary, intptr_t fd)
 	return -1;
 }
 
+/**
+ * Queue a batch of asynchronous file operations.
+ *
+ * Requests on the same file descriptor are performed in the order they are submitted.
+ * Each request's callback is invoked on an I/O thread once the request completes;
+ * requests without a callback have their complete field set instead.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] requests Array of requests to queue
+ * @param[in] count Number of requests in the array
+ *
+ * @return 0 if all requests were queued, negative portable error code if none were
+ */
+int32_t
+omrfile_blockingasync_submit(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *requests, uintptr_t count)
+{
+	return -1;
+}
+
+/**
+ * Wait until every request queued with @ref omrfile_blockingasync_submit has completed.
+ *
+ * @param[in] portLibrary The port library
+ */
+void
+omrfile_blockingasync_drain(struct OMRPortLibrary *portLibrary)
+{
+}
+
 /**
  * PortLibrary shutdown.
  *
@@ -33,12 +33,17 @@
  * Memory categories are used to break down native memory usage under
  * areas a language programmer would understand.
  */
+#if defined(LINUX) && !defined(OMRZTPF)
+#define _GNU_SOURCE
+#include <sched.h>
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
 #include <stdlib.h>
 #include <string.h>
 
 #include "omrport.h"
 #include "omrportpriv.h"
 #include "omrportpg.h"
+#include "omrthread.h"
 #include "ut_omrport.h"
 
 /* J9VMAtomicFunctions*/
@@ -135,6 +140,184 @@ omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size)
 	} while (compareAndSwapUDATA(&category->liveBytes, oldValue, oldValue - size) != oldValue);
 }
 
+/**
+ * Selects the stripe of the per-category counters used by the calling thread.
+ *
+ * On Linux the stripe follows the CPU the thread runs on, so concurrent updates land
+ * on different cache lines. Elsewhere the stripe is derived from the calling omrthread,
+ * which keeps a thread on the same stripe for its lifetime.
+ */
+static uintptr_t
+getCategoryStripeIndex(void)
+{
+	uintptr_t threadId = 0;
+
+#if defined(LINUX) && !defined(OMRZTPF)
+	int cpu = sched_getcpu();
+	if (cpu >= 0) {
+		return (uintptr_t)cpu & (OMRMEM_CATEGORY_STRIPE_COUNT - 1);
+	}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
+	/* omrthread_t's are heap allocated, drop the alignment bits before spreading them */
+	threadId = ((uintptr_t)omrthread_self()) >> 4;
+	return (uintptr_t)(((uint32_t)threadId * 0x9E3779B9U) >> (32 - OMRMEM_CATEGORY_STRIPE_COUNT_LOG2));
+}
+
+/**
+ * Returns the counter stripes of a category, or NULL if the category has no stripes,
+ * in which case its shared counters are used instead.
+ *
+ * Stripes only exist for the categories registered through omrport_control; they are
+ * indexed by category code.
+ */
+static OMRMemCategoryStripe *
+getCategoryStripes(struct OMRPortLibrary *portLibrary, OMRMemCategory *category)
+{
+	J9PortControlData *portControl = &(portLibrary->portGlobals->control);
+	OMRMemCategoryStripe *stripes = portLibrary->portGlobals->categoryStripes;
+	uint32_t categoryCode = category->categoryCode;
+	uint32_t slot = 0;
+
+	if (NULL == stripes) {
+		return NULL;
+	}
+	if (categoryCode < OMRMEM_LANGUAGE_CATEGORY_LIMIT) {
+		if (categoryCode >= portControl->language_memory_categories.numberOfCategories
+			|| category != portControl->language_memory_categories.categories[categoryCode]) {
+			return NULL;
+		}
+		slot = categoryCode;
+	} else if (categoryCode > OMRMEM_LANGUAGE_CATEGORY_LIMIT) {
+		uint32_t categoryIndex = OMRMEM_OMR_CATEGORY_INDEX_FROM_CODE(categoryCode);
+		if (categoryIndex >= portControl->omr_memory_categories.numberOfCategories
+			|| category != portControl->omr_memory_categories.categories[categoryIndex]) {
+			return NULL;
+		}
+		slot = portControl->language_memory_categories.numberOfCategories + categoryIndex;
+	} else {
+		return NULL;
+	}
+
+	return &stripes[slot * OMRMEM_CATEGORY_STRIPE_COUNT];
+}
+
+/**
+ * Atomically adds delta to a stripe counter. Stripes are rarely shared between CPUs,
+ * so a single fetch-and-add is used where the compiler provides one.
+ */
+static void
+addToStripeCounter(volatile uintptr_t *counter, uintptr_t delta)
+{
+#if defined(__GNUC__)
+	__sync_fetch_and_add(counter, delta);
+#else /* defined(__GNUC__) */
+	uintptr_t oldValue;
+
+	do {
+		oldValue = *counter;
+	} while (compareAndSwapUDATA((uintptr_t *)counter, oldValue, oldValue + delta) != oldValue);
+#endif /* defined(__GNUC__) */
+}
+
+/**
+ * Increments the counters for a memory category on the stripe of the calling CPU or thread.
+ *
+ * Used on the port library's own allocation paths. Falls back to the shared counters
+ * of the category until stripes are set up.
+ */
+void
+omrmem_categories_increment_local_counters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t size)
+{
+	OMRMemCategoryStripe *stripes = getCategoryStripes(portLibrary, category);
+
+	if (NULL == stripes) {
+		omrmem_categories_increment_counters(category, size);
+	} else {
+		OMRMemCategoryStripe *stripe = &stripes[getCategoryStripeIndex()];
+
+		addToStripeCounter(&stripe->liveAllocations, 1);
+		addToStripeCounter(&stripe->liveBytes, size);
+	}
+}
+
+/**
+ * Decrements the counters for a memory category on the stripe of the calling CPU or thread.
+ *
+ * The block may have been counted on another stripe, or in the shared counters, so
+ * individual stripes can wrap; only the sum reported by the category walk is meaningful.
+ */
+void
+omrmem_categories_decrement_local_counters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t size)
+{
+	OMRMemCategoryStripe *stripes = getCategoryStripes(portLibrary, category);
+
+	if (NULL == stripes) {
+		omrmem_categories_decrement_counters(category, size);
+	} else {
+		OMRMemCategoryStripe *stripe = &stripes[getCategoryStripeIndex()];
+
+		addToStripeCounter(&stripe->liveAllocations, (uintptr_t)-1);
+		addToStripeCounter(&stripe->liveBytes, (uintptr_t)0 - size);
+	}
+}
+
+/**
+ * Adds the stripes of a category to its shared counters to get its live totals.
+ */
+static void
+foldCategoryCounters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t *liveBytes, uintptr_t *liveAllocations)
+{
+	OMRMemCategoryStripe *stripes = getCategoryStripes(portLibrary, category);
+	uintptr_t bytes = category->liveBytes;
+	uintptr_t allocations = category->liveAllocations;
+
+	if (NULL != stripes) {
+		uint32_t i;
+
+		for (i = 0; i < OMRMEM_CATEGORY_STRIPE_COUNT; i++) {
+			bytes += stripes[i].liveBytes;
+			allocations += stripes[i].liveAllocations;
+		}
+	}
+
+	*liveBytes = bytes;
+	*liveAllocations = allocations;
+}
+
+/**
+ * Allocates the counter stripes for the categories registered through omrport_control.
+ * Called once the category tables have been set up.
+ *
+ * @param[in] portLibrary The port library
+ *
+ * @return 0 on success, non-zero if the stripes could not be allocated. The categories
+ * then keep using their shared counters.
+ */
+int32_t
+omrmem_categories_startup_stripes(struct OMRPortLibrary *portLibrary)
+{
+	J9PortControlData *portControl = &(portLibrary->portGlobals->control);
+	uintptr_t slots = (uintptr_t)portControl->language_memory_categories.numberOfCategories + portControl->omr_memory_categories.numberOfCategories;
+	uintptr_t size = slots * OMRMEM_CATEGORY_STRIPE_COUNT * sizeof(OMRMemCategoryStripe);
+	void *memory = NULL;
+
+	if (NULL != portLibrary->portGlobals->categoryStripes) {
+		return 1;
+	}
+
+	/* Over-allocate so the stripes can be aligned to a cache line */
+	memory = portLibrary->mem_allocate_memory(portLibrary, size + OMRMEM_CATEGORY_STRIPE_SIZE - 1, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == memory) {
+		return 1;
+	}
+	memset(memory, 0, size + OMRMEM_CATEGORY_STRIPE_SIZE - 1);
+
+	portLibrary->portGlobals->categoryStripesMemory = memory;
+	portLibrary->portGlobals->categoryStripes = (OMRMemCategoryStripe *)(((uintptr_t)memory + OMRMEM_CATEGORY_STRIPE_SIZE - 1) & ~(uintptr_t)(OMRMEM_CATEGORY_STRIPE_SIZE - 1));
+	return 0;
+}
+
 /**
  * Returns a reference to the OMRMemCategory structure represented by categoryCode.
  *
@@ -190,7 +373,11 @@ _recursive_category_walk_children(struct OMRPortLibrary *portLibrary, OMRMemCate
 	for (i = 0; i < parent->numberOfChildren; i++) {
 		uint32_t childCode = parent->children[i];
 		OMRMemCategory *child = omrmem_get_category(portLibrary, childCode);
-		result = state->walkFunction(child->categoryCode, child->name, child->liveBytes, child->liveAllocations, FALSE, parent->categoryCode, state);
+		uintptr_t liveBytes;
+		uintptr_t liveAllocations;
+
+		foldCategoryCounters(portLibrary, child, &liveBytes, &liveAllocations);
+		result = state->walkFunction(child->categoryCode, child->name, liveBytes, liveAllocations, FALSE, parent->categoryCode, state);
 
 		if (result == J9MEM_CATEGORIES_KEEP_ITERATING) {
 			result = _recursive_category_walk_children(portLibrary, state, child);
@@ -210,8 +397,11 @@ static uintptr_t
 _recursive_category_walk_root(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkState *state, OMRMemCategory *walkPoint)
 {
 	uintptr_t result;
+	uintptr_t liveBytes;
+	uintptr_t liveAllocations;
 
-	result = state->walkFunction(walkPoint->categoryCode, walkPoint->name, walkPoint->liveBytes, walkPoint->liveAllocations, TRUE, 0, state);
+	foldCategoryCounters(portLibrary, walkPoint, &liveBytes, &liveAllocations);
+	result = state->walkFunction(walkPoint->categoryCode, walkPoint->name, liveBytes, liveAllocations, TRUE, 0, state);
 
 	if (result == J9MEM_CATEGORIES_KEEP_ITERATING) {
 		return _recursive_category_walk_children(portLibrary, state, walkPoint);
@@ -279,6 +469,8 @@ omrmem_startup_categories(struct OMRPortLibrary *portLibrary)
 	portLibrary->portGlobals->control.language_memory_categories.categories = NULL;
 	portLibrary->portGlobals->control.omr_memory_categories.numberOfCategories = 0;
 	portLibrary->portGlobals->control.omr_memory_categories.categories = NULL;
+	portLibrary->portGlobals->categoryStripes = NULL;
+	portLibrary->portGlobals->categoryStripesMemory = NULL;
 	return 0;
 }
 
@@ -294,6 +486,13 @@ void
 omrmem_shutdown_categories(struct OMRPortLibrary *portLibrary)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	/* Free the stripes first, freeing memory below must not count against them. */
+	if (NULL != portLibrary->portGlobals->categoryStripesMemory) {
+		void *memory = portLibrary->portGlobals->categoryStripesMemory;
+		portLibrary->portGlobals->categoryStripes = NULL;
+		portLibrary->portGlobals->categoryStripesMemory = NULL;
+		portLibrary->mem_free_memory(OMRPORTLIB, memory);
+	}
 	/* Free any allocated memory categories data. */
 	if (NULL != portLibrary->portGlobals->control.language_memory_categories.categories) {
 		portLibrary->mem_free_memory(OMRPORTLIB, portLibrary->portGlobals->control.language_memory_categories.categories);
@@ -0,0 +1,512 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Thread-caching slab allocator for small blocks
+ */
+
+
+/*
+ * This file contains an optional allocator that sits under omrmem_allocate_memory
+ * in place of the omrmem_*_basic functions. It is enabled with
+ * omrport_control(OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE, arenaSize), normally right
+ * after the port library is started.
+ *
+ * Blocks up to OMRMEM_SLAB_MAX_BLOCK_SIZE bytes (including the memory tags added by
+ * omrmemtag.c) are rounded up to a size class and carved from fixed size slabs in a
+ * single arena. Each thread keeps a short free list per size class, so most
+ * allocations and frees do not take a lock. Threads move blocks between their cache
+ * and the shared size class in batches.
+ *
+ * Larger blocks, blocks allocated once the arena is exhausted and blocks allocated
+ * before the allocator was enabled all come from the basic allocator. The free path
+ * tells them apart by checking whether the block lies inside the arena.
+ *
+ * Tagging and memory category accounting happen in omrmemtag.c, around this allocator,
+ * exactly as they do around the basic allocator. Blocks held in the caches are not
+ * counted in any category, just as memory cached by malloc is not.
+ */
+#include <string.h>
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
+#include "omrmemslab.h"
+
+#define OMRMEM_SLAB_SIZE ((uintptr_t)64 * 1024)
+#define OMRMEM_SLAB_GRANULE ((uintptr_t)16)
+#define OMRMEM_SLAB_MAX_BLOCK_SIZE ((uintptr_t)1024)
+#define OMRMEM_SLAB_SIZE_CLASS_COUNT (OMRMEM_SLAB_MAX_BLOCK_SIZE / OMRMEM_SLAB_GRANULE)
+/* Number of bytes moved between a thread cache and a size class at a time */
+#define OMRMEM_SLAB_BATCH_BYTES ((uintptr_t)8 * 1024)
+
+#define SIZE_CLASS_INDEX(byteAmount) (((byteAmount) - 1) / OMRMEM_SLAB_GRANULE)
+
+/* Stored in the TLS slot of a thread once its cache has been finalized, so that frees
+ * made by later TLS finalizers on the same thread go to the size classes directly.
+ */
+#define OMRMEM_SLAB_CACHE_RETIRED ((void *)(uintptr_t)1)
+
+/* Free blocks are linked through their first word */
+#define NEXT_FREE_BLOCK(block) (*(void **)(block))
+
+typedef struct OMRMemSlabSizeClass {
+	MUTEX mutex;
+	uintptr_t blockSize;
+	uintptr_t batchCount;
+	void *freeList;
+	uint8_t *carveAlloc; /**< unused part of the slab this size class is carving */
+	uint8_t *carveTop;
+} OMRMemSlabSizeClass;
+
+typedef struct OMRMemSlabCacheBin {
+	void *head;
+	uintptr_t count;
+} OMRMemSlabCacheBin;
+
+typedef struct OMRMemSlabThreadCache {
+	struct OMRMemSlabAllocator *allocator;
+	struct OMRMemSlabThreadCache *next;
+	struct OMRMemSlabThreadCache *previous;
+	OMRMemSlabCacheBin bins[OMRMEM_SLAB_SIZE_CLASS_COUNT];
+} OMRMemSlabThreadCache;
+
+typedef struct OMRMemSlabAllocator {
+	struct OMRPortLibrary *portLibrary;
+	uint8_t *arenaBase;
+	uint8_t *arenaTop;
+	uintptr_t arenaAlloc; /**< next unused slab, advanced with compareAndSwapUDATA */
+	uint8_t *slabSizeClasses; /**< size class index of each slab handed out */
+	omrthread_tls_key_t tlsKey;
+	MUTEX cacheListMutex;
+	OMRMemSlabThreadCache *cacheList;
+	OMRMemSlabSizeClass sizeClasses[OMRMEM_SLAB_SIZE_CLASS_COUNT];
+} OMRMemSlabAllocator;
+
+static BOOLEAN
+isSlabBlock(OMRMemSlabAllocator *allocator, void *block)
+{
+	return ((uint8_t *)block >= allocator->arenaBase) && ((uint8_t *)block < allocator->arenaTop);
+}
+
+static OMRMemSlabSizeClass *
+sizeClassOfBlock(OMRMemSlabAllocator *allocator, void *block)
+{
+	uintptr_t slabIndex = ((uintptr_t)block - (uintptr_t)allocator->arenaBase) / OMRMEM_SLAB_SIZE;
+
+	return &allocator->sizeClasses[allocator->slabSizeClasses[slabIndex]];
+}
+
+/**
+ * Take an unused slab from the arena for the size class at index.
+ *
+ * @return the slab, or NULL if the arena is exhausted
+ */
+static uint8_t *
+takeSlab(OMRMemSlabAllocator *allocator, uintptr_t index)
+{
+	uintptr_t oldAlloc = 0;
+	uintptr_t newAlloc = 0;
+
+	do {
+		oldAlloc = allocator->arenaAlloc;
+		newAlloc = oldAlloc + OMRMEM_SLAB_SIZE;
+		if (newAlloc > (uintptr_t)allocator->arenaTop) {
+			return NULL;
+		}
+	} while (compareAndSwapUDATA(&allocator->arenaAlloc, oldAlloc, newAlloc) != oldAlloc);
+
+	allocator->slabSizeClasses[(oldAlloc - (uintptr_t)allocator->arenaBase) / OMRMEM_SLAB_SIZE] = (uint8_t)index;
+	return (uint8_t *)oldAlloc;
+}
+
+/**
+ * Take up to count blocks from a size class, refilling it from the arena if its free list runs out.
+ *
+ * @param[out] chain the blocks taken, linked through their first word
+ *
+ * @return the number of blocks taken, which is only less than count if the arena is exhausted
+ */
+static uintptr_t
+takeBlocks(OMRMemSlabAllocator *allocator, uintptr_t index, uintptr_t count, void **chain)
+{
+	OMRMemSlabSizeClass *sizeClass = &allocator->sizeClasses[index];
+	void *head = NULL;
+	uintptr_t taken = 0;
+
+	MUTEX_ENTER(sizeClass->mutex);
+	while ((taken < count) && (NULL != sizeClass->freeList)) {
+		void *block = sizeClass->freeList;
+		sizeClass->freeList = NEXT_FREE_BLOCK(block);
+		NEXT_FREE_BLOCK(block) = head;
+		head = block;
+		taken += 1;
+	}
+	while (taken < count) {
+		if ((uintptr_t)(sizeClass->carveTop - sizeClass->carveAlloc) < sizeClass->blockSize) {
+			uint8_t *slab = takeSlab(allocator, index);
+			if (NULL == slab) {
+				break;
+			}
+			sizeClass->carveAlloc = slab;
+			sizeClass->carveTop = slab + OMRMEM_SLAB_SIZE;
+		}
+		NEXT_FREE_BLOCK(sizeClass->carveAlloc) = head;
+		head = sizeClass->carveAlloc;
+		sizeClass->carveAlloc += sizeClass->blockSize;
+		taken += 1;
+	}
+	MUTEX_EXIT(sizeClass->mutex);
+
+	*chain = head;
+	return taken;
+}
+
+/**
+ * Return a chain of blocks running from head to tail to the free list of a size class.
+ */
+static void
+returnBlocks(OMRMemSlabSizeClass *sizeClass, void *head, void *tail)
+{
+	MUTEX_ENTER(sizeClass->mutex);
+	NEXT_FREE_BLOCK(tail) = sizeClass->freeList;
+	sizeClass->freeList = head;
+	MUTEX_EXIT(sizeClass->mutex);
+}
+
+static void
+flushThreadCache(OMRMemSlabAllocator *allocator, OMRMemSlabThreadCache *cache)
+{
+	uintptr_t index = 0;
+
+	for (index = 0; index < OMRMEM_SLAB_SIZE_CLASS_COUNT; index++) {
+		OMRMemSlabCacheBin *bin = &cache->bins[index];
+
+		if (NULL != bin->head) {
+			void *tail = bin->head;
+			while (NULL != NEXT_FREE_BLOCK(tail)) {
+				tail = NEXT_FREE_BLOCK(tail);
+			}
+			returnBlocks(&allocator->sizeClasses[index], bin->head, tail);
+			bin->head = NULL;
+			bin->count = 0;
+		}
+	}
+}
+
+/**
+ * TLS finalizer for the thread caches, called when a thread detaches.
+ */
+static void
+threadCacheFinalizer(void *value)
+{
+	OMRMemSlabThreadCache *cache = (OMRMemSlabThreadCache *)value;
+	omrthread_t self = omrthread_self();
+
+	if (OMRMEM_SLAB_CACHE_RETIRED != cache) {
+		OMRMemSlabAllocator *allocator = cache->allocator;
+
+		if ((NULL != self) && (cache == omrthread_tls_get(self, allocator->tlsKey))) {
+			omrthread_tls_set(self, allocator->tlsKey, OMRMEM_SLAB_CACHE_RETIRED);
+		}
+
+		flushThreadCache(allocator, cache);
+
+		MUTEX_ENTER(allocator->cacheListMutex);
+		if (NULL != cache->next) {
+			cache->next->previous = cache->previous;
+		}
+		if (allocator->cacheList == cache) {
+			allocator->cacheList = cache->next;
+		} else if (NULL != cache->previous) {
+			cache->previous->next = cache->next;
+		}
+		MUTEX_EXIT(allocator->cacheListMutex);
+
+		omrmem_free_memory_basic(allocator->portLibrary, cache);
+	}
+}
+
+/**
+ * Get the cache of the current thread, creating it on first use.
+ *
+ * @return the cache, or NULL if the thread is not attached to the thread library,
+ * its cache has been finalized, or the cache could not be allocated
+ */
+static OMRMemSlabThreadCache *
+getThreadCache(OMRMemSlabAllocator *allocator)
+{
+	omrthread_t self = omrthread_self();
+	OMRMemSlabThreadCache *cache = NULL;
+
+	if (NULL != self) {
+		cache = (OMRMemSlabThreadCache *)omrthread_tls_get(self, allocator->tlsKey);
+		if (NULL == cache) {
+			cache = (OMRMemSlabThreadCache *)omrmem_allocate_memory_basic(allocator->portLibrary, sizeof(OMRMemSlabThreadCache));
+			if (NULL != cache) {
+				memset(cache, 0, sizeof(OMRMemSlabThreadCache));
+				cache->allocator = allocator;
+
+				MUTEX_ENTER(allocator->cacheListMutex);
+				cache->next = allocator->cacheList;
+				if (NULL != allocator->cacheList) {
+					allocator->cacheList->previous = cache;
+				}
+				allocator->cacheList = cache;
+				MUTEX_EXIT(allocator->cacheListMutex);
+
+				omrthread_tls_set(self, allocator->tlsKey, cache);
+			}
+		} else if (OMRMEM_SLAB_CACHE_RETIRED == cache) {
+			cache = NULL;
+		}
+	}
+
+	return cache;
+}
+
+static void
+releaseBlock(OMRMemSlabAllocator *allocator, void *block)
+{
+	OMRMemSlabSizeClass *sizeClass = sizeClassOfBlock(allocator, block);
+	OMRMemSlabThreadCache *cache = getThreadCache(allocator);
+
+	if (NULL == cache) {
+		returnBlocks(sizeClass, block, block);
+	} else {
+		OMRMemSlabCacheBin *bin = &cache->bins[sizeClass - allocator->sizeClasses];
+
+		NEXT_FREE_BLOCK(block) = bin->head;
+		bin->head = block;
+		bin->count += 1;
+
+		/* keep one batch cached and hand the rest back so that other threads can use it */
+		if (bin->count > (2 * sizeClass->batchCount)) {
+			void *tail = bin->head;
+			uintptr_t i = 0;
+
+			for (i = 1; i < sizeClass->batchCount; i++) {
+				tail = NEXT_FREE_BLOCK(tail);
+			}
+			block = bin->head;
+			bin->head = NEXT_FREE_BLOCK(tail);
+			bin->count -= sizeClass->batchCount;
+			returnBlocks(sizeClass, block, tail);
+		}
+	}
+}
+
+void *
+omrmem_allocate_memory_slab(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+	void *block = NULL;
+
+	if (byteAmount <= OMRMEM_SLAB_MAX_BLOCK_SIZE) {
+		uintptr_t index = SIZE_CLASS_INDEX(byteAmount);
+		OMRMemSlabThreadCache *cache = getThreadCache(allocator);
+
+		if (NULL == cache) {
+			takeBlocks(allocator, index, 1, &block);
+		} else {
+			OMRMemSlabCacheBin *bin = &cache->bins[index];
+
+			if (NULL == bin->head) {
+				bin->count = takeBlocks(allocator, index, allocator->sizeClasses[index].batchCount, &bin->head);
+			}
+			block = bin->head;
+			if (NULL != block) {
+				bin->head = NEXT_FREE_BLOCK(block);
+				bin->count -= 1;
+			}
+		}
+	}
+
+	if (NULL == block) {
+		block = omrmem_allocate_memory_basic(portLibrary, byteAmount);
+	}
+
+	return block;
+}
+
+void
+omrmem_free_memory_slab(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+
+	if (isSlabBlock(allocator, memoryPointer)) {
+		releaseBlock(allocator, memoryPointer);
+	} else {
+		omrmem_free_memory_basic(portLibrary, memoryPointer);
+	}
+}
+
+void
+omrmem_advise_and_free_memory_slab(struct OMRPortLibrary *portLibrary, void *memoryPointer, uintptr_t memorySize)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+
+	/* slab blocks are smaller than a page and are reused, so there is nothing to advise */
+	if (isSlabBlock(allocator, memoryPointer)) {
+		releaseBlock(allocator, memoryPointer);
+	} else {
+		omrmem_advise_and_free_memory_basic(portLibrary, memoryPointer, memorySize);
+	}
+}
+
+void *
+omrmem_reallocate_memory_slab(struct OMRPortLibrary *portLibrary, void *memoryPointer, uintptr_t byteAmount)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+	void *pointer = NULL;
+
+	if (!isSlabBlock(allocator, memoryPointer)) {
+		pointer = omrmem_reallocate_memory_basic(portLibrary, memoryPointer, byteAmount);
+	} else {
+		OMRMemSlabSizeClass *sizeClass = sizeClassOfBlock(allocator, memoryPointer);
+
+		if ((byteAmount <= sizeClass->blockSize) && (byteAmount > (sizeClass->blockSize - OMRMEM_SLAB_GRANULE))) {
+			/* still the same size class */
+			pointer = memoryPointer;
+		} else {
+			pointer = omrmem_allocate_memory_slab(portLibrary, byteAmount);
+			if (NULL != pointer) {
+				memcpy(pointer, memoryPointer, OMR_MIN(byteAmount, sizeClass->blockSize));
+				releaseBlock(allocator, memoryPointer);
+			}
+		}
+	}
+
+	return pointer;
+}
+
+/**
+ * Enable the slab allocator.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] arenaSize Bytes to reserve for slabs, rounded down to a whole number of slabs
+ *
+ * @return 0 on success, -1 if the allocator is already enabled or could not be created
+ */
+int32_t
+startup_memory_slab(struct OMRPortLibrary *portLibrary, uintptr_t arenaSize)
+{
+	OMRMemSlabAllocator *allocator = NULL;
+	uintptr_t slabCount = arenaSize / OMRMEM_SLAB_SIZE;
+	uintptr_t index = 0;
+
+	if ((NULL != portLibrary->portGlobals->slabAllocator) || (0 == slabCount)) {
+		return -1;
+	}
+
+	allocator = (OMRMemSlabAllocator *)omrmem_allocate_memory_basic(portLibrary, sizeof(OMRMemSlabAllocator));
+	if (NULL == allocator) {
+		return -1;
+	}
+	memset(allocator, 0, sizeof(OMRMemSlabAllocator));
+	allocator->portLibrary = portLibrary;
+
+	/* the arena is only touched as slabs are carved, so most platforms only back the slabs in use */
+	allocator->arenaBase = (uint8_t *)omrmem_allocate_memory_basic(portLibrary, slabCount * OMRMEM_SLAB_SIZE);
+	allocator->slabSizeClasses = (uint8_t *)omrmem_allocate_memory_basic(portLibrary, slabCount);
+	if ((NULL == allocator->arenaBase) || (NULL == allocator->slabSizeClasses)) {
+		goto fail;
+	}
+	allocator->arenaTop = allocator->arenaBase + (slabCount * OMRMEM_SLAB_SIZE);
+	allocator->arenaAlloc = (uintptr_t)allocator->arenaBase;
+
+	if (0 != omrthread_tls_alloc_with_finalizer(&allocator->tlsKey, threadCacheFinalizer)) {
+		allocator->tlsKey = 0;
+		goto fail;
+	}
+	if (!MUTEX_INIT(allocator->cacheListMutex)) {
+		goto fail;
+	}
+	for (index = 0; index < OMRMEM_SLAB_SIZE_CLASS_COUNT; index++) {
+		OMRMemSlabSizeClass *sizeClass = &allocator->sizeClasses[index];
+
+		if (!MUTEX_INIT(sizeClass->mutex)) {
+			while (0 < index) {
+				index -= 1;
+				MUTEX_DESTROY(allocator->sizeClasses[index].mutex);
+			}
+			MUTEX_DESTROY(allocator->cacheListMutex);
+			goto fail;
+		}
+		sizeClass->blockSize = (index + 1) * OMRMEM_SLAB_GRANULE;
+		sizeClass->batchCount = OMR_MAX(OMRMEM_SLAB_BATCH_BYTES / sizeClass->blockSize, 1);
+	}
+
+	issueWriteBarrier();
+	portLibrary->portGlobals->slabAllocator = allocator;
+	return 0;
+
+fail:
+	if (0 != allocator->tlsKey) {
+		omrthread_tls_free(allocator->tlsKey);
+	}
+	omrmem_free_memory_basic(portLibrary, allocator->slabSizeClasses);
+	omrmem_free_memory_basic(portLibrary, allocator->arenaBase);
+	omrmem_free_memory_basic(portLibrary, allocator);
+	return -1;
+}
+
+/**
+ * Release the slab allocator. Every slab block is freed with the arena.
+ *
+ * @param[in] portLibrary The port library
+ */
+void
+shutdown_memory_slab(struct OMRPortLibrary *portLibrary)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+
+	if (NULL != allocator) {
+		OMRMemSlabThreadCache *cache = NULL;
+		uintptr_t index = 0;
+
+		portLibrary->portGlobals->slabAllocator = NULL;
+
+		/* freeing the key clears it in every thread, so the finalizer no longer runs */
+		omrthread_tls_free(allocator->tlsKey);
+
+		cache = allocator->cacheList;
+		while (NULL != cache) {
+			OMRMemSlabThreadCache *next = cache->next;
+			omrmem_free_memory_basic(portLibrary, cache);
+			cache = next;
+		}
+
+		for (index = 0; index < OMRMEM_SLAB_SIZE_CLASS_COUNT; index++) {
+			MUTEX_DESTROY(allocator->sizeClasses[index].mutex);
+		}
+		MUTEX_DESTROY(allocator->cacheListMutex);
+
+		omrmem_free_memory_basic(portLibrary, allocator->slabSizeClasses);
+		omrmem_free_memory_basic(portLibrary, allocator->arenaBase);
+		omrmem_free_memory_basic(portLibrary, allocator);
+	}
+}
@@ -54,6 +54,7 @@
 #endif /* (OMR_ENV_DATA64) */
 
 #include "omrmemtag_checks.h"
+#include "omrmemslab.h"
 
 static void setTagSumCheck(J9MemTag *tag, uint32_t eyeCatcher);
 static void *wrapBlockAndSetTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, uintptr_t byteAmount, const char *callSite, const uint32_t category);
@@ -95,7 +96,7 @@ wrapBlockAndSetTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, uin
 	}
 
 	category = omrmem_get_category(portLibrary, categoryCode);
-	omrmem_categories_increment_counters(category, ROUNDED_BYTE_AMOUNT(byteAmount));
+	omrmem_categories_increment_local_counters(portLibrary, category, ROUNDED_BYTE_AMOUNT(byteAmount));
 
 	/* Fill in the tags */
 	headerTag->allocSize = byteAmount;
@@ -131,7 +132,7 @@ unwrapBlockAndCheckTags(struct OMRPortLibrary *portLibrary, void *memoryPointer)
 		&& (checkTagSumCheck(footerTag, J9MEMTAG_EYECATCHER_ALLOC_FOOTER) == 0)
 		&& (checkPadding(headerTag) == 0)) {
 
-		omrmem_categories_decrement_counters(headerTag->category, ROUNDED_BYTE_AMOUNT(headerTag->allocSize));
+		omrmem_categories_decrement_local_counters(portLibrary, headerTag->category, ROUNDED_BYTE_AMOUNT(headerTag->allocSize));
 
 		/* Optimized freed header sumCheck setting */
 		headerTag->eyeCatcher = J9MEMTAG_EYECATCHER_FREED_HEADER;
@@ -173,6 +174,10 @@ omrmem_allocate_memory(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount,
 	uintptr_t allocationByteAmount;
 	allocate_memory_func_t allocateFunction = omrmem_allocate_memory_basic;
 
+	if (NULL != portLibrary->portGlobals->slabAllocator) {
+		allocateFunction = omrmem_allocate_memory_slab;
+	}
+
 	/* note that this monitor is protecting a larger area than strictly required but this will make the trace points sane */
 	Trc_PRT_mem_omrmem_allocate_memory_Entry(byteAmount, callSite);
 	allocationByteAmount = ROUNDED_BYTE_AMOUNT(byteAmount);
@@ -201,6 +206,10 @@ omrmem_free_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer)
 	free_memory_func_t freeFunction = omrmem_free_memory_basic;
 	Trc_PRT_mem_omrmem_free_memory_Entry(memoryPointer);
 
+	if (NULL != portLibrary->portGlobals->slabAllocator) {
+		freeFunction = omrmem_free_memory_slab;
+	}
+
 	if (memoryPointer != NULL) {
 		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
 		freeFunction(portLibrary, memoryPointer);
@@ -223,6 +232,10 @@ omrmem_advise_and_free_memory(struct OMRPortLibrary *portLibrary, void *memoryPo
 	advise_and_free_memory_func_t adviseAndFreeFunction = omrmem_advise_and_free_memory_basic;
 	Trc_PRT_mem_omrmem_advise_and_free_memory_Entry(memoryPointer);
 
+	if (NULL != portLibrary->portGlobals->slabAllocator) {
+		adviseAndFreeFunction = omrmem_advise_and_free_memory_slab;
+	}
+
 	if (memoryPointer != NULL) {
 #if (defined(LINUX) || defined (AIXPPC) || defined(J9ZOS390) || defined(OSX))
 
@@ -279,6 +292,10 @@ omrmem_reallocate_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer
 
 	Trc_PRT_mem_omrmem_reallocate_memory_Entry(memoryPointer, byteAmount, callSite, category);
 
+	if (NULL != portLibrary->portGlobals->slabAllocator) {
+		reallocateFunction = omrmem_reallocate_memory_slab;
+	}
+
 	if (memoryPointer == NULL) {
 		pointer = omrmem_allocate_memory(portLibrary, byteAmount, NULL == callSite ? OMR_GET_CALLSITE() : callSite, category);
 	} else if (byteAmount == 0) {
@@ -326,6 +343,8 @@ omrmem_shutdown(struct OMRPortLibrary *portLibrary)
 #endif /* OMR_ENV_DATA64 */
 
 	if (NULL != portLibrary->portGlobals) {
+		/* Category and allocate32 bookkeeping may live in slab blocks, so the arena goes last */
+		shutdown_memory_slab(portLibrary);
 		omrmem_shutdown_basic(portLibrary);
 		portLibrary->portGlobals = NULL;
 	}
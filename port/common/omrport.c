@@ -235,6 +235,8 @@ static OMRPortLibrary MasterPortLibraryTable = {
 	omrfile_convert_omrfile_fd_to_native_fd,
 	omrfile_blockingasync_unlock_bytes, /* file_blockingasync_unlock_bytes */
 	omrfile_blockingasync_lock_bytes, /* file_blockingasync_lock_bytes */
+	omrfile_blockingasync_submit, /* file_blockingasync_submit */
+	omrfile_blockingasync_drain, /* file_blockingasync_drain */
 	omrstr_ftime, /* str_ftime */
 	omrmmap_startup, /* mmap_startup */
 	omrmmap_shutdown, /* mmap_shutdown */
@@ -259,6 +261,7 @@ static OMRPortLibrary MasterPortLibraryTable = {
 	omrsysinfo_cgroup_is_limits_enabled, /* sysinfo_cgroup_is_limits_enabled */
 	omrsysinfo_cgroup_enable_limits, /* sysinfo_cgroup_enable_limits */
 	omrsysinfo_cgroup_get_memlimit, /* sysinfo_cgroup_get_memlimit */	
+	omrsysinfo_cgroup_get_cpulimit, /* sysinfo_cgroup_get_cpulimit */
 	omrport_init_library, /* port_init_library */
 	omrport_startup_library, /* port_startup_library */
 	omrport_create_library, /* port_create_library */
@@ -23,6 +23,7 @@
 #include <string.h>
 #include "omrport.h"
 #include "omrportpriv.h"
+#include "omrmemslab.h"
 #if defined(OMR_PORT_ZOS_CEEHDLRSUPPORT)
 #include <leawi.h>
 #include "omrsignal_ceehdlr.h"
@@ -250,6 +251,8 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 #endif
 			portControl->language_memory_categories.numberOfCategories = languageCategoryCount;
 			portControl->omr_memory_categories.numberOfCategories = omrCategoryCount;
+			/* Without stripes the categories keep counting on their shared counters */
+			omrmem_categories_startup_stripes(portLibrary);
 			return 0;
 		} else {
 			Trc_Assert_PRT_mem_categories_already_set(NULL != portControl->language_memory_categories.categories);
@@ -276,11 +279,27 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 		return 0;
 	}
 
+	if (0 == strcmp(OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE, key)) {
+		/* The slab allocator can only be enabled once, its blocks must stay valid until shutdown */
+		if (0 != startup_memory_slab(portLibrary, value)) {
+			return 1;
+		}
+		return 0;
+	}
+
 	if (0 == strcmp(OMRPORT_CTLDATA_VECTOR_REGS_SUPPORT_ON, key)) {
 		portLibrary->portGlobals->vectorRegsSupportOn = value;
 		return 0;
 	}
 
+#if defined(LINUX)
+	if (0 == strcmp(OMRPORT_CTLDATA_CGROUP_ROOT, key)) {
+		/* Allow tests to supply their own /proc/<pid>/cgroup and cgroup file system; the string must outlive its use */
+		PPG_cgroupRoot = (0 == value) ? "" : (const char *)value;
+		return 0;
+	}
+#endif /* defined(LINUX) */
+
 	return 1;
 }
 
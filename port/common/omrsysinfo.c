@@ -145,7 +145,8 @@ omrsysinfo_get_executable_name(struct OMRPortLibrary *portLibrary, const char *a
  * 	- OMRPORT_CPU_ONLINE: Number of online CPU's on this machine
  * 	- OMRPORT_CPU_BOUND: Number of physical CPU's bound to this process
  * 	- OMRPORT_CPU_ENTITLED: Number of CPU's the user has specified should be used by the process
- * 	- OMRPORT_CPU_TARGET: Number of CPU's that should be used by the process. This is OMR_MIN(BOUND, ENTITLED).
+ * 	- OMRPORT_CPU_TARGET: Number of CPU's that should be used by the process. This is OMR_MIN(BOUND, ENTITLED),
+ * 	  further limited on Linux by the CPU quota of the cgroup of the process (see omrsysinfo_cgroup_get_cpulimit).
  *
  * @param[in] portLibrary The port library.
  * @param[in] type Flag to indicate the information type (see function description).
@@ -867,3 +868,23 @@ omrsysinfo_cgroup_get_memlimit(struct OMRPortLibrary *portLibrary, uint64_t *lim
 {
 	return OMRPORT_ERROR_SYSINFO_CGROUP_UNSUPPORTED_PLATFORM;
 }
+
+/**
+ * Retrieves the number of CPUs the process may keep busy under the CPU bandwidth limit
+ * (cpu.max on cgroup v2, cpu.cfs_quota_us and cpu.cfs_period_us on cgroup v1) of the
+ * cgroup to which the current process belongs, or of any of its ancestors. The quota
+ * is rounded up to a whole number of CPUs.
+ * Unlike omrsysinfo_cgroup_get_memlimit(), this does not require cgroup limits to be
+ * enabled. The limit found when the port library started also caps OMRPORT_CPU_TARGET.
+ *
+ * @param[in] portLibrary pointer to OMRPortLibrary
+ * @param[out] limit pointer to uintptr_t which on successful return contains the number of CPUs
+ *
+ * @return 0 on success, OMRPORT_ERROR_SYSINFO_CGROUP_CPULIMIT_NOT_SET if no CPU quota applies
+ * to the process, otherwise negative error code
+ */
+int32_t
+omrsysinfo_cgroup_get_cpulimit(struct OMRPortLibrary *portLibrary, uintptr_t *limit)
+{
+	return OMRPORT_ERROR_SYSINFO_CGROUP_UNSUPPORTED_PLATFORM;
+}
@@ -107,6 +107,21 @@ typedef struct J9CudaGlobalData {
 } J9CudaGlobalData;
 #endif /* OMR_OPT_CUDA */
 
+/* Number of stripes the live counters of a memory category are spread across (log2) */
+#define OMRMEM_CATEGORY_STRIPE_COUNT_LOG2 3
+#define OMRMEM_CATEGORY_STRIPE_COUNT (1 << OMRMEM_CATEGORY_STRIPE_COUNT_LOG2)
+#define OMRMEM_CATEGORY_STRIPE_SIZE 64
+
+/**
+ * One stripe of the live counters of a memory category, padded to a cache line.
+ * The live totals of a category are its shared counters plus the sum of its stripes.
+ */
+typedef struct OMRMemCategoryStripe {
+	uintptr_t liveBytes;
+	uintptr_t liveAllocations;
+	uint8_t padding[OMRMEM_CATEGORY_STRIPE_SIZE - (2 * sizeof(uintptr_t))];
+} OMRMemCategoryStripe;
+
 /* these port library globals are initialized to zero in omrmem_startup_basic */
 typedef struct OMRPortLibraryGlobalData {
 	void *corruptedMemoryBlock;
@@ -126,6 +141,9 @@ typedef struct OMRPortLibraryGlobalData {
 	uintptr_t vmemAdviseOSonFree;					/** For softmx to determine whether OS should be advised of freed vmem */
 	uintptr_t vectorRegsSupportOn;				/* Turn on vector regs support */
 	uintptr_t entitledCPUs;							/** Number of entitled CPUs */
+	struct OMRMemSlabAllocator *slabAllocator;		/** Small block allocator, NULL unless enabled with OMRPORT_CTLDATA_MEM_SLAB_ARENA_SIZE */
+	OMRMemCategoryStripe *categoryStripes;			/** Counter stripes of the categories set through omrport_control, indexed by category code */
+	void *categoryStripesMemory;					/** Unaligned allocation backing categoryStripes */
 #if defined(OMR_OPT_CUDA)
 	J9CudaGlobalData cudaGlobals;
 #endif /* OMR_OPT_CUDA */
@@ -255,6 +273,10 @@ omrfile_blockingasync_set_length(struct OMRPortLibrary *portLibrary, intptr_t fd
 extern J9_CFUNC int64_t
 omrfile_blockingasync_flength(struct OMRPortLibrary *portLibrary, intptr_t fd);
 extern J9_CFUNC int32_t
+omrfile_blockingasync_submit(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *requests, uintptr_t count);
+extern J9_CFUNC void
+omrfile_blockingasync_drain(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC int32_t
 omrfile_blockingasync_startup(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC void
 omrfile_blockingasync_shutdown(struct OMRPortLibrary *portLibrary);
@@ -367,6 +389,12 @@ extern J9_CFUNC void
 omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size);
 extern J9_CFUNC void
 omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size);
+extern J9_CFUNC void
+omrmem_categories_increment_local_counters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t size);
+extern J9_CFUNC void
+omrmem_categories_decrement_local_counters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t size);
+extern J9_CFUNC int32_t
+omrmem_categories_startup_stripes(struct OMRPortLibrary *portLibrary);
 
 /* J9SourceJ9MemoryMap*/
 extern J9_CFUNC void
@@ -523,6 +551,8 @@ extern J9_CFUNC int32_t
 omrsysinfo_cgroup_enable_limits(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC int32_t 
 omrsysinfo_cgroup_get_memlimit(struct OMRPortLibrary *portLibrary, uint64_t *limit);
+extern J9_CFUNC int32_t
+omrsysinfo_cgroup_get_cpulimit(struct OMRPortLibrary *portLibrary, uintptr_t *limit);
 
 /* J9SourceJ9Signal*/
 extern J9_CFUNC int32_t
@@ -130,6 +130,7 @@ OBJECTS += omrheap
 OBJECTS += omrmem
 OBJECTS += omrmemtag
 OBJECTS += omrmemcategories
+OBJECTS += omrmemslab
 OBJECTS += omrport
 OBJECTS += omrmmap
 OBJECTS += j9nls
@@ -0,0 +1,533 @@
+/*******************************************************************************
+ * Copyright (c) 1991, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief file
+ *
+ * The blocking calls are performed directly on the caller. Requests queued with
+ * omrfile_blockingasync_submit are handed to a small set of I/O threads, one per lane.
+ * A request is assigned to a lane by its file descriptor, so the requests on a file
+ * are performed in the order they were submitted without any further coordination
+ * between the I/O threads. Lane threads are started the first time a request is
+ * queued on them.
+ */
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrthread.h"
+#include "omrutil.h"
+#include "omrutilbase.h"
+#include "ut_omrport.h"
+
+#define OMRFILE_ASYNC_LANE_COUNT 4
+#define OMRFILE_ASYNC_THREAD_STACK_SIZE (64 * 1024)
+
+typedef struct OMRFileAsyncLane {
+	struct OMRPortLibrary *portLibrary;
+	uintptr_t index;
+	omrthread_monitor_t monitor; /**< protects the queue and the thread state */
+	omrthread_t thread; /**< I/O thread, NULL until the first request is queued */
+	OMRFileAsyncRequest *head; /**< submission queue, in submission order */
+	OMRFileAsyncRequest *tail;
+	BOOLEAN shutdown; /**< set when the thread should exit once its queue is empty */
+	BOOLEAN exited; /**< set by the thread as it exits */
+} OMRFileAsyncLane;
+
+typedef struct OMRFileAsyncIOPool {
+	omrthread_monitor_t drainMonitor; /**< protects outstanding and signals omrfile_blockingasync_drain */
+	uintptr_t outstanding; /**< requests queued but not yet completed */
+	OMRFileAsyncLane lanes[OMRFILE_ASYNC_LANE_COUNT];
+} OMRFileAsyncIOPool;
+
+static int J9THREAD_PROC asyncIOThreadMain(void *userData);
+static void performRequest(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *request);
+
+/**
+ * Closes a file descriptor.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int32_t
+omrfile_blockingasync_close(struct OMRPortLibrary *portLibrary, intptr_t fd)
+{
+	return omrfile_close(portLibrary, fd);
+}
+
+/**
+ * Convert a pathname into a file descriptor.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] path Name of the file to be opened.
+ * @param[in] flags Portable file read/write attributes.
+ * @param[in] mode Platform file permissions.
+ *
+ * @return The file descriptor of the newly opened file, -1 on failure.
+ */
+intptr_t
+omrfile_blockingasync_open(struct OMRPortLibrary *portLibrary, const char *path, int32_t flags, int32_t mode)
+{
+	return omrfile_open(portLibrary, path, flags, mode);
+}
+
+/**
+ * This function will acquire a lock of the requested type on the given file, starting at offset bytes
+ * from the start of the file and continuing for length bytes
+ *
+ * @param [in]   portLibrary            The port library
+ * @param [in]   fd                     The file descriptor/handle of the file to be locked
+ * @param [in]   lockFlags              Flags indicating the type of lock required and whether the call should block
+ * @param [in]   offest                 Offset from start of file to start of locked region
+ * @param [in]   length                 Number of bytes to be locked
+ *
+ * @return                              0 on success, -1 on failure
+ */
+int32_t
+omrfile_blockingasync_lock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd, int32_t lockFlags, uint64_t offset, uint64_t length)
+{
+	return omrfile_lock_bytes(portLibrary, fd, lockFlags, offset, length);
+}
+
+/**
+ * This function will release the lock on the given file, starting at offset bytes
+ * from the start of the file and continuing for length bytes
+ *
+ * @param [in]   portLibrary            The port library
+ * @param [in]   fd                     The file descriptor/handle of the file to be locked
+ * @param [in]   offest                 Offset from start of file to start of locked region
+ * @param [in]   length                 Number of bytes to be unlocked
+ *
+ * @return                              0 on success, -1 on failure
+ */
+int32_t
+omrfile_blockingasync_unlock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd, uint64_t offset, uint64_t length)
+{
+	return omrfile_unlock_bytes(portLibrary, fd, offset, length);
+}
+
+/**
+ * Read bytes from a file descriptor into a user provided buffer.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in,out] buf Buffer to read into.
+ * @param[in] nbytes Size of buffer.
+ *
+ * @return The number of bytes read, or -1 on failure.
+ */
+intptr_t
+omrfile_blockingasync_read(struct OMRPortLibrary *portLibrary, intptr_t fd, void *buf, intptr_t nbytes)
+{
+	intptr_t rc = 0;
+
+	Trc_PRT_file_blockingasync_read_Entry(fd, buf, nbytes);
+	rc = omrfile_read(portLibrary, fd, buf, nbytes);
+	Trc_PRT_file_blockingasync_read_Exit(rc);
+	return rc;
+}
+
+/**
+ * Write to a file.
+ *
+ * Writes up to nbytes from the provided buffer  to the file referenced by the file descriptor.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd File descriptor to write.
+ * @param[in] buf Buffer to be written.
+ * @param[in] nbytes Size of buffer.
+ *
+ * @return Number of bytes written on success, portable error return code (which is negative) on failure.
+ */
+intptr_t
+omrfile_blockingasync_write(struct OMRPortLibrary *portLibrary, intptr_t fd, const void *buf, intptr_t nbytes)
+{
+	intptr_t rc = 0;
+
+	Trc_PRT_file_blockingasync_write_Entry(fd, buf, nbytes);
+	rc = omrfile_write(portLibrary, fd, buf, nbytes);
+	Trc_PRT_file_blockingasync_write_Exit(rc);
+	return rc;
+}
+
+/**
+ * Set the length of a file to a specified value.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] newLength Length to be set
+ *
+ * @return 0 on success, negative portable error code on failure
+ */
+int32_t
+omrfile_blockingasync_set_length(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t newLength)
+{
+	return omrfile_set_length(portLibrary, fd, newLength);
+}
+
+/**
+ * Answer the length in bytes of the file.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ *
+ * @return Length in bytes of the file on success, negative portable error code on failure
+ */
+int64_t
+omrfile_blockingasync_flength(struct OMRPortLibrary *portLibrary, intptr_t fd)
+{
+	return omrfile_flength(portLibrary, fd);
+}
+
+/**
+ * Perform a single queued request on the current (I/O) thread and store its result.
+ * Errors are reported as the negative portable error code recorded by the failing call.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] request The request to perform
+ */
+static void
+performRequest(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *request)
+{
+	intptr_t result = 0;
+	BOOLEAN transfer = (OMRPORT_FILE_ASYNC_READ == request->operation) || (OMRPORT_FILE_ASYNC_WRITE == request->operation);
+
+	if (transfer && (OMRPORT_FILE_ASYNC_OFFSET_CURRENT != request->offset)) {
+		if (-1 == omrfile_seek(portLibrary, request->fd, request->offset, EsSeekSet)) {
+			result = -1;
+		}
+	}
+
+	if (0 == result) {
+		switch (request->operation) {
+		case OMRPORT_FILE_ASYNC_READ:
+			result = omrfile_read(portLibrary, request->fd, request->buf, request->nbytes);
+			break;
+		case OMRPORT_FILE_ASYNC_WRITE:
+			result = omrfile_write(portLibrary, request->fd, request->buf, request->nbytes);
+			break;
+		case OMRPORT_FILE_ASYNC_SET_LENGTH:
+			result = omrfile_set_length(portLibrary, request->fd, request->offset);
+			break;
+		case OMRPORT_FILE_ASYNC_SYNC:
+			result = omrfile_sync(portLibrary, request->fd);
+			break;
+		case OMRPORT_FILE_ASYNC_CLOSE:
+			result = omrfile_close(portLibrary, request->fd);
+			break;
+		default:
+			result = portLibrary->error_set_last_error(portLibrary, 0, OMRPORT_ERROR_FILE_INVALID_PARAMETER);
+			break;
+		}
+	}
+
+	if (result < 0) {
+		result = portLibrary->error_last_error_number(portLibrary);
+		if (0 <= result) {
+			result = OMRPORT_ERROR_FILE_OPFAILED;
+		}
+	}
+	request->result = result;
+}
+
+/**
+ * Entry point of a lane's I/O thread. The thread takes the whole submission queue at once,
+ * performs and completes the batch outside the lane monitor, and exits once shutdown has
+ * been requested and the queue is empty.
+ *
+ * @param[in] userData The lane served by this thread
+ */
+static int J9THREAD_PROC
+asyncIOThreadMain(void *userData)
+{
+	OMRFileAsyncLane *lane = (OMRFileAsyncLane *)userData;
+	struct OMRPortLibrary *portLibrary = lane->portLibrary;
+	OMRFileAsyncIOPool *pool = PPG_fileAsyncIOPool;
+
+	omrthread_monitor_enter(lane->monitor);
+	while (TRUE) {
+		OMRFileAsyncRequest *batch = NULL;
+		uintptr_t batchCount = 0;
+
+		while ((NULL == lane->head) && !lane->shutdown) {
+			omrthread_monitor_wait(lane->monitor);
+		}
+		if (NULL == lane->head) {
+			break;
+		}
+		batch = lane->head;
+		lane->head = NULL;
+		lane->tail = NULL;
+		omrthread_monitor_exit(lane->monitor);
+
+		while (NULL != batch) {
+			/* the request may be reused or freed as soon as it is completed */
+			OMRFileAsyncRequest *next = batch->next;
+			performRequest(portLibrary, batch);
+			if (NULL != batch->callback) {
+				batch->callback(portLibrary, batch);
+			} else {
+				issueWriteBarrier();
+				batch->complete = 1;
+			}
+			batchCount += 1;
+			batch = next;
+		}
+		Trc_PRT_file_blockingasync_batch(lane->index, batchCount);
+
+		omrthread_monitor_enter(pool->drainMonitor);
+		pool->outstanding -= batchCount;
+		if (0 == pool->outstanding) {
+			omrthread_monitor_notify_all(pool->drainMonitor);
+		}
+		omrthread_monitor_exit(pool->drainMonitor);
+
+		omrthread_monitor_enter(lane->monitor);
+	}
+
+	omrport_tls_free(portLibrary);
+	lane->exited = TRUE;
+	omrthread_monitor_notify_all(lane->monitor);
+	omrthread_exit(lane->monitor);
+
+	/* unreachable */
+	return 0;
+}
+
+/**
+ * Queue a batch of asynchronous file operations.
+ *
+ * Requests on the same file descriptor are performed in the order they are submitted, one
+ * at a time; requests on different files may proceed in parallel. Each lane is locked
+ * once per call regardless of the number of requests queued on it.
+ *
+ * When a request completes its result is stored and its callback is invoked on an I/O thread.
+ * From then on the request belongs to the callback. Requests without a callback have their
+ * complete field set to 1 instead, after which the caller may reuse them.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] requests Array of requests to queue
+ * @param[in] count Number of requests in the array
+ *
+ * @return 0 if all requests were queued, negative portable error code if none were
+ */
+int32_t
+omrfile_blockingasync_submit(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *requests, uintptr_t count)
+{
+	OMRFileAsyncIOPool *pool = PPG_fileAsyncIOPool;
+	OMRFileAsyncRequest *heads[OMRFILE_ASYNC_LANE_COUNT];
+	OMRFileAsyncRequest *tails[OMRFILE_ASYNC_LANE_COUNT];
+	uintptr_t i = 0;
+	int32_t rc = 0;
+
+	Trc_PRT_file_blockingasync_submit_Entry(requests, count);
+
+	if (NULL == pool) {
+		rc = portLibrary->error_set_last_error(portLibrary, 0, OMRPORT_ERROR_FILE_OPFAILED);
+		goto done;
+	}
+
+	/* split the batch by lane, preserving submission order within each lane */
+	for (i = 0; i < OMRFILE_ASYNC_LANE_COUNT; i++) {
+		heads[i] = NULL;
+		tails[i] = NULL;
+	}
+	for (i = 0; i < count; i++) {
+		OMRFileAsyncRequest *request = &requests[i];
+		uintptr_t lane = ((uintptr_t)request->fd) % OMRFILE_ASYNC_LANE_COUNT;
+
+		request->result = 0;
+		request->complete = 0;
+		request->next = NULL;
+		if (NULL == heads[lane]) {
+			heads[lane] = request;
+		} else {
+			tails[lane]->next = request;
+		}
+		tails[lane] = request;
+	}
+
+	/* start any missing I/O threads before queueing anything, so that a failure queues nothing */
+	for (i = 0; i < OMRFILE_ASYNC_LANE_COUNT; i++) {
+		OMRFileAsyncLane *lane = &pool->lanes[i];
+
+		if (NULL != heads[i]) {
+			omrthread_monitor_enter(lane->monitor);
+			if (NULL == lane->thread) {
+				if (J9THREAD_SUCCESS != createThreadWithCategory(
+						&lane->thread,
+						OMRFILE_ASYNC_THREAD_STACK_SIZE,
+						J9THREAD_PRIORITY_NORMAL,
+						0,
+						&asyncIOThreadMain,
+						lane,
+						J9THREAD_CATEGORY_SYSTEM_THREAD)
+				) {
+					lane->thread = NULL;
+					omrthread_monitor_exit(lane->monitor);
+					Trc_PRT_file_blockingasync_submit_thread_failure(i);
+					rc = portLibrary->error_set_last_error(portLibrary, 0, OMRPORT_ERROR_FILE_OPFAILED);
+					goto done;
+				}
+			}
+			omrthread_monitor_exit(lane->monitor);
+		}
+	}
+
+	omrthread_monitor_enter(pool->drainMonitor);
+	pool->outstanding += count;
+	omrthread_monitor_exit(pool->drainMonitor);
+
+	for (i = 0; i < OMRFILE_ASYNC_LANE_COUNT; i++) {
+		OMRFileAsyncLane *lane = &pool->lanes[i];
+
+		if (NULL != heads[i]) {
+			omrthread_monitor_enter(lane->monitor);
+			if (NULL == lane->head) {
+				lane->head = heads[i];
+			} else {
+				lane->tail->next = heads[i];
+			}
+			lane->tail = tails[i];
+			omrthread_monitor_notify(lane->monitor);
+			omrthread_monitor_exit(lane->monitor);
+		}
+	}
+
+done:
+	Trc_PRT_file_blockingasync_submit_Exit(rc);
+	return rc;
+}
+
+/**
+ * Wait until every request queued with @ref omrfile_blockingasync_submit has completed.
+ *
+ * @param[in] portLibrary The port library
+ */
+void
+omrfile_blockingasync_drain(struct OMRPortLibrary *portLibrary)
+{
+	OMRFileAsyncIOPool *pool = PPG_fileAsyncIOPool;
+
+	if (NULL != pool) {
+		omrthread_monitor_enter(pool->drainMonitor);
+		while (0 != pool->outstanding) {
+			omrthread_monitor_wait(pool->drainMonitor);
+		}
+		omrthread_monitor_exit(pool->drainMonitor);
+	}
+}
+
+/**
+ * PortLibrary shutdown.
+ *
+ * This function is called during shutdown of the portLibrary.  Any resources that were created by @ref omrfile_blockingasync_startup
+ * should be destroyed here. Requests still queued are performed before the I/O threads exit.
+ *
+ * @param[in] portLibrary The port library
+ */
+void
+omrfile_blockingasync_shutdown(struct OMRPortLibrary *portLibrary)
+{
+	OMRFileAsyncIOPool *pool = PPG_fileAsyncIOPool;
+
+	Trc_PRT_file_blockingasync_shutdown_Entry();
+	if (NULL != pool) {
+		uintptr_t i = 0;
+
+		for (i = 0; i < OMRFILE_ASYNC_LANE_COUNT; i++) {
+			OMRFileAsyncLane *lane = &pool->lanes[i];
+
+			if (NULL != lane->monitor) {
+				omrthread_monitor_enter(lane->monitor);
+				if (NULL != lane->thread) {
+					lane->shutdown = TRUE;
+					omrthread_monitor_notify(lane->monitor);
+					while (!lane->exited) {
+						omrthread_monitor_wait(lane->monitor);
+					}
+				}
+				omrthread_monitor_exit(lane->monitor);
+				omrthread_monitor_destroy(lane->monitor);
+			}
+		}
+		if (NULL != pool->drainMonitor) {
+			omrthread_monitor_destroy(pool->drainMonitor);
+		}
+		portLibrary->mem_free_memory(portLibrary, pool);
+		PPG_fileAsyncIOPool = NULL;
+	}
+	Trc_PRT_file_blockingasync_shutdown_Exit();
+}
+
+/**
+ * PortLibrary startup.
+ *
+ * This function is called during startup of the portLibrary.  Any resources that are required for
+ * the file operations may be created here.  All resources created here should be destroyed
+ * in @ref omrfile_blockingasync_shutdown.
+ *
+ * The I/O threads themselves are not started until requests are first queued on them.
+ *
+ * @param[in] portLibrary The port library
+ *
+ * @return 0 on success, negative error code on failure.  Error code values returned are
+ * \arg OMRPORT_ERROR_STARTUP_FILE
+ */
+int32_t
+omrfile_blockingasync_startup(struct OMRPortLibrary *portLibrary)
+{
+	OMRFileAsyncIOPool *pool = NULL;
+	uintptr_t i = 0;
+
+	Trc_PRT_file_blockingasync_startup_Entry();
+	pool = (OMRFileAsyncIOPool *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRFileAsyncIOPool), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == pool) {
+		return OMRPORT_ERROR_STARTUP_FILE;
+	}
+	memset(pool, 0, sizeof(OMRFileAsyncIOPool));
+	PPG_fileAsyncIOPool = pool;
+
+	if (0 != omrthread_monitor_init_with_name(&pool->drainMonitor, 0, "portLibrary_omrfile_blockingasync_drain_monitor")) {
+		goto fail;
+	}
+	for (i = 0; i < OMRFILE_ASYNC_LANE_COUNT; i++) {
+		pool->lanes[i].portLibrary = portLibrary;
+		pool->lanes[i].index = i;
+		if (0 != omrthread_monitor_init_with_name(&pool->lanes[i].monitor, 0, "portLibrary_omrfile_blockingasync_lane_monitor")) {
+			goto fail;
+		}
+	}
+	Trc_PRT_file_blockingasync_startup_Exit();
+	return 0;
+
+fail:
+	omrfile_blockingasync_shutdown(portLibrary);
+	return OMRPORT_ERROR_STARTUP_FILE;
+}
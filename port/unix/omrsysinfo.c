@@ -256,6 +256,7 @@ struct  {
 #if defined(LINUX)
 
 #define OMR_CGROUP_V1_MOUNT_POINT "/sys/fs/cgroup"
+#define OMR_CGROUP_V2_CONTROLLERS_FILE OMR_CGROUP_V1_MOUNT_POINT "/cgroup.controllers"
 
 /* Currently 12 subsystems/resource controllers are defined.
  */
@@ -322,6 +323,10 @@ static char * getCgroupNameForSubsystem(struct OMRPortLibrary *portLibrary, OMRC
 static int32_t addCgroupEntry(struct OMRPortLibrary *portLibrary, OMRCgroupEntry **cgEntryList, int32_t hierId, const char *subsystem, const char *cgroupName);
 static int32_t readCgroupFile(struct OMRPortLibrary *portLibrary, int pid, OMRCgroupEntry **cgroupEntryList);
 static int32_t readCgroupSubsystemFile(struct OMRPortLibrary *portLibrary, OMRCgroupSubsystems subsystem, const char *fileName, int32_t numItemsToRead, const char *format, ...);
+static int32_t vreadCgroupHierarchyFile(struct OMRPortLibrary *portLibrary, const char *hierarchy, const char *cgroup, const char *fileName, int32_t numItemsToRead, const char *format, va_list args);
+static int32_t readCgroupHierarchyFile(struct OMRPortLibrary *portLibrary, const char *hierarchy, const char *cgroup, const char *fileName, int32_t numItemsToRead, const char *format, ...);
+static uintptr_t readCgroupCPUQuota(struct OMRPortLibrary *portLibrary, const char *cgroup, BOOLEAN isV2);
+static uintptr_t getCgroupCPULimit(struct OMRPortLibrary *portLibrary);
 #endif /* defined(LINUX) */
 
 
@@ -1194,6 +1199,12 @@ omrsysinfo_get_number_CPUs_by_type(struct OMRPortLibrary *portLibrary, uintptr_t
 		} else {
 			toReturn = bound;
 		}
+#if defined(LINUX) && !defined(OMRZTPF)
+		/* A container may be given a CPU quota that is far smaller than the number of CPUs it can run on */
+		if ((0 != PPG_cgroupCPULimit) && (PPG_cgroupCPULimit < toReturn)) {
+			toReturn = PPG_cgroupCPULimit;
+		}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
 #endif /* defined(J9OS_I5) */
 		break;
 	}
@@ -1660,6 +1671,8 @@ omrsysinfo_startup(struct OMRPortLibrary *portLibrary)
 
 #if defined(LINUX) && !defined(OMRZTPF)
 	PPG_cgroupEntryList = NULL;
+	PPG_cgroupRoot = "";
+	PPG_cgroupCPULimit = getCgroupCPULimit(portLibrary);
 #endif /* defined(LINUX) */
 	return 0;
 }
@@ -3377,7 +3390,7 @@ _end:
  * @param[in] pid process id
  * @param[out] cgroupEntryList pointer to OMRCgroupEntry *. On successful return, *cgroupEntry
  * points to a circular linked list. Each element of the list is populated based on the contents 
- * of /proc/<pid>/cgroup file. 
+ * of /proc/<pid>/cgroup file. The cgroup v2 entry, if any, is added with an empty subsystem name.
  *
  * returns 0 on success, negative code on error
  */
@@ -3388,22 +3401,23 @@ readCgroupFile(struct OMRPortLibrary *portLibrary, int pid, OMRCgroupEntry **cgr
 	uintptr_t requiredSize = 0; 
 	/* This array should be large enough to read names of all subsystems. 1024 should be enough. */
 	char subsystems[1024];
+	char line[sizeof(subsystems) + PATH_MAX];
 	FILE *cgroupFile = NULL;
 	OMRCgroupEntry *cgEntryList = NULL;
 	int32_t rc = 0;
 
 	Assert_PRT_true(NULL != cgroupEntryList);
 	
-	requiredSize = portLibrary->str_printf(portLibrary, NULL, (uint32_t)-1, "/proc/%d/cgroup", pid);
+	requiredSize = portLibrary->str_printf(portLibrary, NULL, (uint32_t)-1, "%s/proc/%d/cgroup", PPG_cgroupRoot, pid);
 	Assert_PRT_true(requiredSize <= PATH_MAX);
-	portLibrary->str_printf(portLibrary, cgroup, sizeof(cgroup), "/proc/%d/cgroup", pid);
+	portLibrary->str_printf(portLibrary, cgroup, sizeof(cgroup), "%s/proc/%d/cgroup", PPG_cgroupRoot, pid);
 	cgroupFile = fopen(cgroup, "r");
 	if (NULL == cgroupFile) {
 		rc = portLibrary->error_set_last_error(portLibrary, errno, OMRPORT_ERROR_SYSINFO_PROCESS_CGROUP_FILE_FOPEN_FAILED);
 		goto _end;
 	}
 
-	while (0 == feof(cgroupFile)) {
+	while (NULL != fgets(line, sizeof(line), cgroupFile)) {
 		char *cursor = NULL;
 		char *separator = NULL;
 		int32_t hierId = -1;
@@ -3416,15 +3430,24 @@ readCgroupFile(struct OMRPortLibrary *portLibrary, int pid, OMRCgroupEntry **cgr
 		 * 	1. hierarchy ID number
 		 * 	2. set of subsystems bound to the hierarchy
 		 * 	3. control group in the hierarchy to which the process belongs
+		 *
+		 * The cgroup v2 hierarchy has no subsystems listed, its entry is of type:
+		 * 	0::/daemons
 		 */
-		rc = fscanf(cgroupFile, "%d:%[^:]:%s", &hierId, subsystems, cgroup);
+		subsystems[0] = '\0';
+		cgroup[0] = '\0';
+		if (2 == sscanf(line, "%d::%s", &hierId, cgroup)) {
+			rc = 3;
+		} else {
+			rc = sscanf(line, "%d:%[^:]:%s", &hierId, subsystems, cgroup);
+		}
 		/* Ensure we didn't overflow */
 		Assert_PRT_true(strlen(subsystems) < 1024);
 		Assert_PRT_true(strlen(cgroup) < PATH_MAX);
 
 		if (EOF == rc) {
-			rc = 0;
-			break;
+			/* blank line */
+			continue;
 		} else if (3 != rc) {
 			rc = portLibrary->error_set_last_error_with_message_format(portLibrary, OMRPORT_ERROR_SYSINFO_PROCESS_CGROUP_FILE_READ_FAILED, "unexpcted format of /proc/%d/cgroup file", pid);
 			goto _end;
@@ -3472,40 +3495,30 @@ _end:
 }
 
 /**
- * Read a file under a subsystem in cgroup hierarchy based on the format specified
+ * Read a file of a cgroup in a cgroup hierarchy based on the format specified
  *
  * @param[in] portLibrary pointer to OMRPortLibrary
- * @param[in] subsystem cgroup subsystem
- * @param[in] fileName name of the file under cgroup subsystem
+ * @param[in] hierarchy directory of the hierarchy under the cgroup mount point, "" for the cgroup v2 hierarchy
+ * @param[in] cgroup name of the cgroup in the hierarchy
+ * @param[in] fileName name of the file in the cgroup
  * @param[in] numItemsToRead number of items to be read from the file
  * @param[in] format format to be used for reading the file
+ * @param[in] args locations in which to store the items read
  *
  * @return 0 on successfully reading 'numItemsToRead' items from the file, negative error code on any error
  */
 static int32_t
-readCgroupSubsystemFile(struct OMRPortLibrary *portLibrary, OMRCgroupSubsystems subsystem, const char *fileName, int32_t numItemsToRead, const char *format, ...)
+vreadCgroupHierarchyFile(struct OMRPortLibrary *portLibrary, const char *hierarchy, const char *cgroup, const char *fileName, int32_t numItemsToRead, const char *format, va_list args)
 {
 	char fileToRead[PATH_MAX];
 	char *fileNameBuf = fileToRead;
+	const char *separator = ('\0' == *hierarchy) ? "" : "/";
 	intptr_t fileNameLen = 0;
-	char *cgroup = NULL;
 	FILE *file = NULL;
 	int32_t rc = 0;
-	va_list args;
-
-	if (!portLibrary->sysinfo_cgroup_is_limits_enabled(portLibrary)) {
-		rc = portLibrary->error_set_last_error_with_message(portLibrary, OMRPORT_ERROR_SYSINFO_CGROUP_LIMITS_DISABLED, "cgroup limits is disabled");
-		goto _end;
-	}
-	
-	cgroup = getCgroupNameForSubsystem(portLibrary, PPG_cgroupEntryList, subsystemNames[subsystem]);
-	if (NULL == cgroup) {
-		rc = portLibrary->error_set_last_error_with_message_format(portLibrary, OMRPORT_ERROR_SYSINFO_CGROUP_NAME_NOT_AVAILABLE, "cgroup name for subsystem %s is not available", subsystemNames[MEMORY]);
-		goto _end;
-	}
 
-	/* absolute path of the file to be read is: /sys/fs/cgroup/subsystemNames[subsystem]/cgroup/filenName */
-	fileNameLen = portLibrary->str_printf(portLibrary, NULL, (uint32_t)-1, "%s/%s/%s/%s", OMR_CGROUP_V1_MOUNT_POINT, subsystemNames[subsystem], cgroup, fileName);
+	/* absolute path of the file to be read is: /sys/fs/cgroup/hierarchy/cgroup/fileName */
+	fileNameLen = portLibrary->str_printf(portLibrary, NULL, (uint32_t)-1, "%s%s%s%s%s/%s", PPG_cgroupRoot, OMR_CGROUP_V1_MOUNT_POINT, separator, hierarchy, cgroup, fileName);
 	if (fileNameLen > PATH_MAX) {
 		fileNameBuf = portLibrary->mem_allocate_memory(portLibrary, fileNameLen, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
 		if (NULL == fileNameBuf) {
@@ -3514,16 +3527,14 @@ readCgroupSubsystemFile(struct OMRPortLibrary *portLibrary, OMRCgroupSubsystems
 			
 		}
 	}
-	portLibrary->str_printf(portLibrary, fileNameBuf, fileNameLen, "%s/%s/%s/%s", OMR_CGROUP_V1_MOUNT_POINT, subsystemNames[subsystem], cgroup, fileName);
+	portLibrary->str_printf(portLibrary, fileNameBuf, fileNameLen, "%s%s%s%s%s/%s", PPG_cgroupRoot, OMR_CGROUP_V1_MOUNT_POINT, separator, hierarchy, cgroup, fileName);
 	file = fopen(fileNameBuf, "r");
 	if (NULL == file) {
-		portLibrary->error_set_last_error(portLibrary, errno, OMRPORT_ERROR_SYSINFO_CGROUP_MEMLIMIT_FILE_FOPEN_FAILED);
+		rc = portLibrary->error_set_last_error(portLibrary, errno, OMRPORT_ERROR_SYSINFO_CGROUP_MEMLIMIT_FILE_FOPEN_FAILED);
 		goto _end;
 	}
 
-	va_start(args, format);	
 	rc = vfscanf(file, format, args);
-	va_end(args);
 
 	if (numItemsToRead != rc) {
 		rc = portLibrary->error_set_last_error_with_message_format(portLibrary, OMRPORT_ERROR_SYSINFO_PROCESS_CGROUP_FILE_READ_FAILED, "unexpected format of file %s", fileNameBuf);
@@ -3542,6 +3553,171 @@ _end:
 	return rc;
 }
 
+/**
+ * Read a file of a cgroup in a cgroup hierarchy based on the format specified
+ *
+ * @param[in] portLibrary pointer to OMRPortLibrary
+ * @param[in] hierarchy directory of the hierarchy under the cgroup mount point, "" for the cgroup v2 hierarchy
+ * @param[in] cgroup name of the cgroup in the hierarchy
+ * @param[in] fileName name of the file in the cgroup
+ * @param[in] numItemsToRead number of items to be read from the file
+ * @param[in] format format to be used for reading the file
+ *
+ * @return 0 on successfully reading 'numItemsToRead' items from the file, negative error code on any error
+ */
+static int32_t
+readCgroupHierarchyFile(struct OMRPortLibrary *portLibrary, const char *hierarchy, const char *cgroup, const char *fileName, int32_t numItemsToRead, const char *format, ...)
+{
+	int32_t rc = 0;
+	va_list args;
+
+	va_start(args, format);
+	rc = vreadCgroupHierarchyFile(portLibrary, hierarchy, cgroup, fileName, numItemsToRead, format, args);
+	va_end(args);
+
+	return rc;
+}
+
+/**
+ * Read a file under a subsystem in cgroup hierarchy based on the format specified
+ *
+ * @param[in] portLibrary pointer to OMRPortLibrary
+ * @param[in] subsystem cgroup subsystem
+ * @param[in] fileName name of the file under cgroup subsystem
+ * @param[in] numItemsToRead number of items to be read from the file
+ * @param[in] format format to be used for reading the file
+ *
+ * @return 0 on successfully reading 'numItemsToRead' items from the file, negative error code on any error
+ */
+static int32_t
+readCgroupSubsystemFile(struct OMRPortLibrary *portLibrary, OMRCgroupSubsystems subsystem, const char *fileName, int32_t numItemsToRead, const char *format, ...)
+{
+	char *cgroup = NULL;
+	int32_t rc = 0;
+	va_list args;
+
+	if (!portLibrary->sysinfo_cgroup_is_limits_enabled(portLibrary)) {
+		rc = portLibrary->error_set_last_error_with_message(portLibrary, OMRPORT_ERROR_SYSINFO_CGROUP_LIMITS_DISABLED, "cgroup limits is disabled");
+		goto _end;
+	}
+	
+	cgroup = getCgroupNameForSubsystem(portLibrary, PPG_cgroupEntryList, subsystemNames[subsystem]);
+	if (NULL == cgroup) {
+		rc = portLibrary->error_set_last_error_with_message_format(portLibrary, OMRPORT_ERROR_SYSINFO_CGROUP_NAME_NOT_AVAILABLE, "cgroup name for subsystem %s is not available", subsystemNames[subsystem]);
+		goto _end;
+	}
+
+	va_start(args, format);
+	rc = vreadCgroupHierarchyFile(portLibrary, subsystemNames[subsystem], cgroup, fileName, numItemsToRead, format, args);
+	va_end(args);
+
+_end:
+	return rc;
+}
+
+/**
+ * Read the CPU bandwidth limit of a single cgroup, rounded up to a whole number of CPUs.
+ *
+ * @param[in] portLibrary pointer to OMRPortLibrary
+ * @param[in] cgroup name of the cgroup
+ * @param[in] isV2 TRUE if cgroup is in the cgroup v2 hierarchy, FALSE if it is in the cgroup v1 cpu hierarchy
+ *
+ * @return the number of CPUs, or 0 if the cgroup has no quota or it could not be read
+ */
+static uintptr_t
+readCgroupCPUQuota(struct OMRPortLibrary *portLibrary, const char *cgroup, BOOLEAN isV2)
+{
+	int64_t quota = -1;
+	int64_t period = 0;
+	uintptr_t cpus = 0;
+
+	if (isV2) {
+		/* cpu.max holds "<quota> <period>", with a quota of "max" if there is no limit */
+		char quotaString[32];
+
+		if (0 == readCgroupHierarchyFile(portLibrary, "", cgroup, "cpu.max", 2, "%31s %" SCNd64, quotaString, &period)) {
+			if ((0 == strcmp(quotaString, "max")) || (1 != sscanf(quotaString, "%" SCNd64, &quota))) {
+				quota = -1;
+			}
+		}
+	} else {
+		/* cpu.cfs_quota_us is -1 if there is no limit */
+		if ((0 == readCgroupHierarchyFile(portLibrary, subsystemNames[CPU], cgroup, "cpu.cfs_quota_us", 1, "%" SCNd64, &quota)) && (quota > 0)) {
+			if (0 != readCgroupHierarchyFile(portLibrary, subsystemNames[CPU], cgroup, "cpu.cfs_period_us", 1, "%" SCNd64, &period)) {
+				period = 0;
+			}
+		}
+	}
+
+	if ((quota > 0) && (period > 0)) {
+		cpus = (uintptr_t)((quota + period - 1) / period);
+	}
+	return cpus;
+}
+
+/**
+ * Find the number of CPUs allowed by the CPU bandwidth limits of the cgroup of the current
+ * process and its ancestors. The cgroup v1 cpu controller is used if the process has one,
+ * otherwise the cgroup v2 hierarchy if it is mounted on /sys/fs/cgroup.
+ *
+ * A container without its own cgroup namespace sees the path of its cgroup on the host in
+ * /proc/self/cgroup, but has only its own cgroup mounted, so the path may not exist under
+ * the mount point. Walking up to the mount point then finds the limit of the container.
+ *
+ * @param[in] portLibrary pointer to OMRPortLibrary
+ *
+ * @return the smallest limit found, or 0 if there is none
+ */
+static uintptr_t
+getCgroupCPULimit(struct OMRPortLibrary *portLibrary)
+{
+	char controllersFile[PATH_MAX];
+	char cgroup[PATH_MAX];
+	OMRCgroupEntry *cgEntryList = NULL;
+	const char *cgName = NULL;
+	BOOLEAN isV2 = FALSE;
+	uintptr_t limit = 0;
+
+	/* the cgroups of the process are read afresh rather than taken from PPG_cgroupEntryList, which is only set once cgroup limits are enabled */
+	if (0 != readCgroupFile(portLibrary, getpid(), &cgEntryList)) {
+		return 0;
+	}
+
+	/* the v1 cpu controller takes precedence over the v2 hierarchy of a hybrid system */
+	cgName = getCgroupNameForSubsystem(portLibrary, cgEntryList, subsystemNames[CPU]);
+	if (NULL == cgName) {
+		portLibrary->str_printf(portLibrary, controllersFile, sizeof(controllersFile), "%s%s", PPG_cgroupRoot, OMR_CGROUP_V2_CONTROLLERS_FILE);
+		if (0 == access(controllersFile, F_OK)) {
+			cgName = getCgroupNameForSubsystem(portLibrary, cgEntryList, "");
+			isV2 = TRUE;
+		}
+	}
+
+	if (NULL != cgName) {
+		char *separator = NULL;
+
+		/* readCgroupFile ensures that the name fits; the root cgroup "/" is walked as "" */
+		strcpy(cgroup, cgName);
+		if (0 == strcmp(cgroup, "/")) {
+			cgroup[0] = '\0';
+		}
+		do {
+			uintptr_t cgroupLimit = readCgroupCPUQuota(portLibrary, cgroup, isV2);
+
+			if ((0 != cgroupLimit) && ((0 == limit) || (cgroupLimit < limit))) {
+				limit = cgroupLimit;
+			}
+			separator = strrchr(cgroup, '/');
+			if (NULL != separator) {
+				*separator = '\0';
+			}
+		} while (NULL != separator);
+	}
+
+	freeCgroupEntries(portLibrary, cgEntryList);
+	return limit;
+}
+
 #endif /* defined(LINUX) */
 
 int32_t
@@ -3629,6 +3805,26 @@ _end:
 	return rc;
 }
 
+int32_t
+omrsysinfo_cgroup_get_cpulimit(struct OMRPortLibrary *portLibrary, uintptr_t *limit)
+{
+	int32_t rc = OMRPORT_ERROR_SYSINFO_CGROUP_UNSUPPORTED_PLATFORM;
+#if defined(LINUX) && !defined(OMRZTPF)
+	uintptr_t cgroupCPULimit = 0;
+
+	Assert_PRT_true(NULL != limit);
+
+	cgroupCPULimit = getCgroupCPULimit(portLibrary);
+	if (0 == cgroupCPULimit) {
+		rc = portLibrary->error_set_last_error_with_message(portLibrary, OMRPORT_ERROR_SYSINFO_CGROUP_CPULIMIT_NOT_SET, "cgroup of the process has no CPU quota");
+	} else {
+		*limit = cgroupCPULimit;
+		rc = 0;
+	}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+	return rc;
+}
+
 #if defined(OMRZTPF)
 /*
  *	Return the number of I-streams ("processors", as called by other
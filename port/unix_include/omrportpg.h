@@ -82,9 +82,12 @@ typedef struct OMRPortPlatformGlobals {
 #if defined(OMR_CONFIGURABLE_SUSPEND_SIGNAL)
 	int32_t introspect_threadSuspendSignal;
 #endif /* defined(OMR_CONFIGURABLE_SUSPEND_SIGNAL) */
+	struct OMRFileAsyncIOPool *fileAsyncIOPool; /**< I/O threads and queues behind omrfile_blockingasync_submit */
 #if defined(LINUX)
 	BOOLEAN cgroupLimitsEnabled; /**< indicates if port library supports cgroup limits */
 	OMRCgroupEntry *cgroupEntryList; /**< head of the circular linked list, each element contains information about cgroup of the process for a subsystem */
+	uintptr_t cgroupCPULimit; /**< number of CPUs allowed by the cgroup CPU quota when the port library started, 0 if there is no quota */
+	const char *cgroupRoot; /**< prefix of the /proc and /sys/fs/cgroup paths read for cgroup information, "" unless set with OMRPORT_CTLDATA_CGROUP_ROOT */
 #endif /* defined(LINUX) */
 } OMRPortPlatformGlobals;
 
@@ -123,9 +126,13 @@ typedef struct OMRPortPlatformGlobals {
 #define PPG_introspect_threadSuspendSignal (portLibrary->portGlobals->platformGlobals.introspect_threadSuspendSignal)
 #endif
 
+#define PPG_fileAsyncIOPool (portLibrary->portGlobals->platformGlobals.fileAsyncIOPool)
+
 #if defined(LINUX)
 #define PPG_cgroupLimitsEnabled (portLibrary->portGlobals->platformGlobals.cgroupLimitsEnabled)
 #define PPG_cgroupEntryList (portLibrary->portGlobals->platformGlobals.cgroupEntryList)
+#define PPG_cgroupCPULimit (portLibrary->portGlobals->platformGlobals.cgroupCPULimit)
+#define PPG_cgroupRoot (portLibrary->portGlobals->platformGlobals.cgroupRoot)
 #endif /* defined(LINUX) */
 
 #endif /* omrportpg_h */
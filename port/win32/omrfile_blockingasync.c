@@ -235,6 +235,63 @@ omrfile_blockingasync_flength(struct OMRPortLibrary *portLibrary, intptr_t fd)
 }
 
 
+/* Queued requests are performed on the submitting thread; each one is already an overlapped operation. */
+int32_t
+omrfile_blockingasync_submit(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *requests, uintptr_t count)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < count; i++) {
+		OMRFileAsyncRequest *request = &requests[i];
+		intptr_t result = 0;
+
+		if ((OMRPORT_FILE_ASYNC_OFFSET_CURRENT != request->offset)
+			&& ((OMRPORT_FILE_ASYNC_READ == request->operation) || (OMRPORT_FILE_ASYNC_WRITE == request->operation))
+			&& (-1 == omrfile_seek(portLibrary, request->fd, request->offset, EsSeekSet))
+		) {
+			result = portLibrary->error_last_error_number(portLibrary);
+		} else {
+			switch (request->operation) {
+			case OMRPORT_FILE_ASYNC_READ:
+				result = omrfile_blockingasync_read(portLibrary, request->fd, request->buf, request->nbytes);
+				break;
+			case OMRPORT_FILE_ASYNC_WRITE:
+				result = omrfile_blockingasync_write(portLibrary, request->fd, request->buf, request->nbytes);
+				break;
+			case OMRPORT_FILE_ASYNC_SET_LENGTH:
+				result = omrfile_set_length(portLibrary, request->fd, request->offset);
+				break;
+			case OMRPORT_FILE_ASYNC_SYNC:
+				result = omrfile_sync(portLibrary, request->fd);
+				break;
+			case OMRPORT_FILE_ASYNC_CLOSE:
+				result = omrfile_close(portLibrary, request->fd);
+				break;
+			default:
+				result = OMRPORT_ERROR_FILE_INVALID_PARAMETER;
+				break;
+			}
+			if (result < 0) {
+				result = portLibrary->error_last_error_number(portLibrary);
+			}
+		}
+		request->result = result;
+		if (NULL != request->callback) {
+			request->callback(portLibrary, request);
+		} else {
+			request->complete = 1;
+		}
+	}
+	return 0;
+}
+
+
+void
+omrfile_blockingasync_drain(struct OMRPortLibrary *portLibrary)
+{
+}
+
+
 static void J9THREAD_PROC
 tls_blockingasync_finalizer(void *entry)
 {
@@ -59,13 +59,13 @@ static intptr_t monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrth
 static void monitor_free(omrthread_library_t lib, omrthread_monitor_t monitor);
 static void monitor_free_nolock(omrthread_library_t lib, omrthread_t thread, omrthread_monitor_t monitor);
 #if !defined(OMR_THR_THREE_TIER_LOCKING)
-static intptr_t monitor_enter(omrthread_t self, omrthread_monitor_t monitor);
+static intptr_t monitor_enter(omrthread_t self, omrthread_monitor_t monitor, void *callsite);
 #endif /* !defined(OMR_THR_THREE_TIER_LOCKING) */
 static intptr_t monitor_exit(omrthread_t self, omrthread_monitor_t monitor);
 static intptr_t monitor_wait(omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible);
 static intptr_t monitor_notify_one_or_all(omrthread_monitor_t monitor, int notifyall);
 #if defined(OMR_THR_THREE_TIER_LOCKING)
-static intptr_t monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable);
+static intptr_t monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, void *callsite);
 static intptr_t monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible);
 static intptr_t monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int notifyall);
 #endif /* OMR_THR_THREE_TIER_LOCKING */
@@ -639,6 +639,9 @@ init_spinParameters(omrthread_library_t lib)
 	if (init_threadParam("adaptSpinSampleCountStopRatio", &lib->adaptSpinSampleCountStopRatio)) {
 		return -1;
 	}
+
+	lib->adaptSpinLoadPercent = 0;
+	lib->adaptSpinLoadTime = 0;
 #endif
 
 #if (defined(OMR_THR_YIELD_ALG))
@@ -3652,9 +3655,9 @@ omrthread_monitor_enter(omrthread_monitor_t monitor)
 	}
 
 #ifdef OMR_THR_THREE_TIER_LOCKING
-	return monitor_enter_three_tier(self, monitor, DONT_SET_ABORTABLE);
+	return monitor_enter_three_tier(self, monitor, DONT_SET_ABORTABLE, JLM_CONTENTION_CALLSITE());
 #else
-	return monitor_enter(self, monitor);
+	return monitor_enter(self, monitor, JLM_CONTENTION_CALLSITE());
 #endif
 }
 
@@ -3690,9 +3693,9 @@ omrthread_monitor_enter_using_threadId(omrthread_monitor_t monitor, omrthread_t
 	}
 
 #ifdef OMR_THR_THREE_TIER_LOCKING
-	return monitor_enter_three_tier(threadId, monitor, DONT_SET_ABORTABLE);
+	return monitor_enter_three_tier(threadId, monitor, DONT_SET_ABORTABLE, JLM_CONTENTION_CALLSITE());
 #else
-	return monitor_enter(threadId, monitor);
+	return monitor_enter(threadId, monitor, JLM_CONTENTION_CALLSITE());
 #endif
 }
 
@@ -3725,9 +3728,9 @@ omrthread_monitor_enter_abortable_using_threadId(omrthread_monitor_t monitor, om
 	}
 
 #ifdef OMR_THR_THREE_TIER_LOCKING
-	return monitor_enter_three_tier(threadId, monitor, SET_ABORTABLE);
+	return monitor_enter_three_tier(threadId, monitor, SET_ABORTABLE, JLM_CONTENTION_CALLSITE());
 #else
-	return monitor_enter(threadId, monitor);
+	return monitor_enter(threadId, monitor, JLM_CONTENTION_CALLSITE());
 #endif
 }
 
@@ -3742,12 +3745,17 @@ omrthread_monitor_enter_abortable_using_threadId(omrthread_monitor_t monitor, om
  *
  * @param[in] self current thread
  * @param[in] monitor monitor to enter
+ * @param[in] callsite return address of the caller entering the monitor, or NULL
  * @return 0 on success
  * @todo Get JLM code out of here
  */
 static intptr_t
-monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
+monitor_enter(omrthread_t self, omrthread_monitor_t monitor, void *callsite)
 {
+#if defined(OMR_THR_JLM) && defined(OMR_THR_JLM_HOLD_TIMES)
+	omrtime_t contentionStartTime = 0;
+#endif /* OMR_THR_JLM && OMR_THR_JLM_HOLD_TIMES */
+
 	ASSERT(self);
 	ASSERT(0 == self->monitor);
 	ASSERT(monitor);
@@ -3761,9 +3769,12 @@ monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
 	self->monitor = monitor;
 	THREAD_UNLOCK(self);
 
+	JLM_CONTENTION_SAMPLE_BEGIN(self, contentionStartTime);
+
 	MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER);
 
 	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, IS_SLOW_ENTER);
+	JLM_CONTENTION_SAMPLE_ACQUIRED(self, monitor, contentionStartTime, callsite);
 
 	THREAD_LOCK(self, CALLER_MONITOR_ENTER2);
 	self->flags &= ~J9THREAD_FLAG_BLOCKED;
@@ -3791,13 +3802,18 @@ monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
  *
  * @param[in] self current thread
  * @param[in] monitor monitor to enter
+ * @param[in] isAbortable whether the enter can be aborted
+ * @param[in] callsite return address of the caller entering the monitor, or NULL
  * @return 0 on success, J9THREAD_INTERRUPTED_MONITOR_ENTER otherwise
  * @todo Get JLM code out of here
  */
 static intptr_t
-monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable)
+monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, void *callsite)
 {
 	int blockedCount = 0;
+#if defined(OMR_THR_JLM) && defined(OMR_THR_JLM_HOLD_TIMES)
+	omrtime_t contentionStartTime = 0;
+#endif /* OMR_THR_JLM && OMR_THR_JLM_HOLD_TIMES */
 
 	ASSERT(self);
 	ASSERT(monitor);
@@ -3826,6 +3842,11 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 			break;
 		}
 
+#if defined(OMR_THR_JLM) && defined(OMR_THR_JLM_HOLD_TIMES)
+		if (0 == blockedCount) {
+			JLM_CONTENTION_SAMPLE_BEGIN(self, contentionStartTime);
+		}
+#endif /* OMR_THR_JLM && OMR_THR_JLM_HOLD_TIMES */
 		blockedCount++;
 
 		THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
@@ -3898,6 +3919,7 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 	}
 
 	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, (blockedCount > 0));
+	JLM_CONTENTION_SAMPLE_ACQUIRED(self, monitor, contentionStartTime, callsite);
 
 	ASSERT(!(self->flags & J9THREAD_FLAG_BLOCKED));
 	ASSERT(0 == self->monitor);
@@ -4115,6 +4137,7 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
 		self->lockedmonitorcount--; /* one less locked monitor on this thread */
 		monitor->owner = NULL;
 		UPDATE_JLM_MON_EXIT(self, monitor);
+		JLM_CONTENTION_SAMPLE_RELEASE(self, monitor);
 
 #ifdef OMR_THR_THREE_TIER_LOCKING
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
@@ -4367,6 +4390,7 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 
 #if defined(OMR_THR_JLM_HOLD_TIMES)
 	UPDATE_JLM_MON_WAIT(self, monitor);
+	JLM_CONTENTION_SAMPLE_RELEASE(self, monitor);
 #endif
 
 	ASSERT(self->flags & J9THREAD_FLAG_WAITING);
@@ -4511,7 +4535,8 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 #ifdef OMR_THR_THREE_TIER_LOCKING
 	if (monitor_enter_three_tier(
 			self, monitor,
-			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE))
+			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE),
+			NULL)
 		== J9THREAD_INTERRUPTED_MONITOR_ENTER
 	) {
 		/* we don't own the monitor */
@@ -4626,6 +4651,7 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 			self->tracing->pause_count++;
 		}
 	}
+	JLM_CONTENTION_SAMPLE_RELEASE(self, monitor);
 #endif
 
 	ASSERT(self->flags & J9THREAD_FLAG_WAITING);
@@ -4749,7 +4775,8 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 
 	if (monitor_enter_three_tier(
 			self, monitor,
-			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE))
+			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE),
+			NULL)
 		== J9THREAD_INTERRUPTED_MONITOR_ENTER
 	) {
 		/* we don't own the monitor */
@@ -26,11 +26,20 @@
  * @brief J9 Lock Monitoring
  */
 
+#include <stddef.h>
+#include <time.h>
+#if defined(LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
 #include "omrcfg.h"
 #include "omrcomp.h"
 #include "omrthread.h"
 #include "threaddef.h"
 #include "thread_internal.h"
+#include "omrutilbase.h"
+#include "ut_j9thr.h"
 
 /*
  * This file should be compiled only if OMR_THR_JLM is #defined.
@@ -43,6 +52,9 @@ static intptr_t jlm_init(omrthread_library_t lib);
 static intptr_t jlm_init_pools(omrthread_library_t lib);
 static intptr_t jlm_gc_lock_init(omrthread_library_t lib);
 static void jlm_thread_clear(omrthread_t thread);
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+static J9ThreadContentionBuffer *jlm_contention_buffer_allocate(omrthread_t self);
+#endif /* OMR_THR_JLM_HOLD_TIMES */
 
 /**
  * Initialize storage and clear structures for JLM thread and monitor tracing structures
@@ -191,6 +203,9 @@ jlm_adaptive_spin_init(void)
 	if (0 != *(uintptr_t *)omrthread_global("adaptSpinSlowPercentEnable")) {
 		adaptiveFlags |= J9THREAD_LIB_FLAG_JLM_SLOW_SAMPLING_ENABLED;
 	}
+	if (0 != *(uintptr_t *)omrthread_global("adaptSpinTuneEnable")) {
+		adaptiveFlags |= J9THREAD_LIB_FLAG_JLM_SPIN_TUNING_ENABLED;
+	}
 
 #if defined(OMR_THR_CUSTOM_SPIN_OPTIONS)
 	if (0 != *(uintptr_t *)omrthread_global("customAdaptSpinEnabled")) {
@@ -215,6 +230,157 @@ jlm_adaptive_spin_init(void)
 
 	return 0;
 }
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+/**
+ * Read the number of runnable threads as a percentage of the online CPUs.
+ *
+ * @return the load in percent, or 0 if it is not known
+ */
+static uintptr_t
+jlm_adaptive_spin_read_load(void)
+{
+	uintptr_t loadPercent = 0;
+#if defined(LINUX)
+	/* /proc/loadavg reads like "0.50 0.40 0.30 3/512 12345", the fourth field being runnable/total */
+	char buffer[128];
+	int fd = open("/proc/loadavg", O_RDONLY);
+
+	if (-1 != fd) {
+		ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		close(fd);
+		if ((length > 0) && (cpus > 0)) {
+			char *slash = NULL;
+			char *cursor = NULL;
+			uintptr_t runnable = 0;
+			uintptr_t scale = 1;
+
+			buffer[length] = '\0';
+			slash = strchr(buffer, '/');
+			if (NULL != slash) {
+				for (cursor = slash - 1; (cursor >= buffer) && (*cursor >= '0') && (*cursor <= '9'); cursor--) {
+					runnable += (uintptr_t)(*cursor - '0') * scale;
+					scale *= 10;
+				}
+				loadPercent = (runnable * 100) / (uintptr_t)cpus;
+			}
+		}
+	}
+#endif /* defined(LINUX) */
+	return loadPercent;
+}
+
+/**
+ * Get the system load used by the spin tuner. The load is read at most once a
+ * second and cached in the library; racing updates of the cache are harmless.
+ *
+ * @param[in] lib thread library
+ * @return the number of runnable threads as a percentage of the online CPUs, or 0 if it is not known
+ */
+static uintptr_t
+jlm_adaptive_spin_load(omrthread_library_t lib)
+{
+	uintptr_t now = (uintptr_t)time(NULL);
+
+	if (now != lib->adaptSpinLoadTime) {
+		lib->adaptSpinLoadPercent = jlm_adaptive_spin_read_load();
+		lib->adaptSpinLoadTime = now;
+	}
+	return lib->adaptSpinLoadPercent;
+}
+
+/**
+ * Adjust the three tier spin counts of a monitor from what spinning achieved
+ * on it since the last call.
+ *
+ * Spinning is cut back (spinCount2 first, then spinCount3) when fewer than
+ * ADAPT_SPIN_TUNE_LOW_SUCCESS_PERCENT of the spinning acquires got the lock,
+ * or when there are more runnable threads than CPUs. It is extended (spinCount3
+ * back to its default first, then spinCount2 up to ADAPT_SPIN_TUNE_MAX_SPIN2_FACTOR
+ * times its default) when spinning sometimes succeeds and the average hold time is
+ * below adaptSpinHoldtime. When nearly every spin succeeds on a lightly loaded
+ * system, counts that were cut back are restored towards the defaults.
+ * spinCount1 is never changed, and no count drops below 1.
+ *
+ * Called by the owner of the monitor each time its sample interval expires.
+ *
+ * @param[in] self current thread
+ * @param[in] monitor the monitor to tune
+ */
+void
+jlm_adaptive_spin_tune(omrthread_t self, omrthread_monitor_t monitor)
+{
+	omrthread_library_t lib = self->library;
+	J9ThreadMonitorTracing *tracing = monitor->tracing;
+	uintptr_t attempts = 0;
+	uintptr_t successes = 0;
+	uintptr_t successPercent = 0;
+	uintptr_t loadPercent = 0;
+	uintptr_t oldSpinCount2 = monitor->spinCount2;
+	uintptr_t oldSpinCount3 = monitor->spinCount3;
+	uintptr_t spinCount2 = oldSpinCount2;
+	uintptr_t spinCount3 = oldSpinCount3;
+	uintptr_t defaultSpinCount2 = lib->defaultMonitorSpinCount2;
+	uintptr_t defaultSpinCount3 = lib->defaultMonitorSpinCount3;
+	uint64_t holdtimeAvg = 0;
+
+	if ((NULL == tracing) || (0 != (monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING))) {
+		return;
+	}
+
+	/* the counts keep being updated by spinning threads, so take a snapshot */
+	attempts = tracing->spin_attempt_count - tracing->spin_tune_attempt_count;
+	if (attempts < ADAPT_SPIN_TUNE_MIN_ATTEMPTS) {
+		return;
+	}
+	successes = tracing->spin_success_count - tracing->spin_tune_success_count;
+	if (successes > attempts) {
+		successes = attempts;
+	}
+	tracing->spin_tune_attempt_count += attempts;
+	tracing->spin_tune_success_count += successes;
+
+	successPercent = (successes * 100) / attempts;
+	loadPercent = jlm_adaptive_spin_load(lib);
+	if (tracing->holdtime_count > 0) {
+		holdtimeAvg = (uint64_t)JLM_AVERAGE_HOLDTIME(monitor);
+	}
+
+	if ((loadPercent >= ADAPT_SPIN_TUNE_MAX_LOAD_PERCENT) || (successPercent < ADAPT_SPIN_TUNE_LOW_SUCCESS_PERCENT)) {
+		if (spinCount2 > 1) {
+			spinCount2 /= 2;
+		} else if (spinCount3 > 1) {
+			spinCount3 /= 2;
+		}
+	} else if (successPercent <= ADAPT_SPIN_TUNE_HIGH_SUCCESS_PERCENT) {
+		if ((0 == lib->adaptSpinHoldtime) || (0 == tracing->holdtime_count) || (holdtimeAvg < lib->adaptSpinHoldtime)) {
+			if (spinCount3 < defaultSpinCount3) {
+				spinCount3 = OMR_MIN(spinCount3 * 2, defaultSpinCount3);
+			} else if (spinCount2 < (defaultSpinCount2 * ADAPT_SPIN_TUNE_MAX_SPIN2_FACTOR)) {
+				spinCount2 = OMR_MIN(spinCount2 * 2, defaultSpinCount2 * ADAPT_SPIN_TUNE_MAX_SPIN2_FACTOR);
+			}
+		}
+	} else if (loadPercent < ADAPT_SPIN_TUNE_RESTORE_LOAD_PERCENT) {
+		if (spinCount3 < defaultSpinCount3) {
+			spinCount3 = OMR_MIN(spinCount3 * 2, defaultSpinCount3);
+		}
+		if (spinCount2 < defaultSpinCount2) {
+			spinCount2 = OMR_MIN(spinCount2 * 2, defaultSpinCount2);
+		}
+	}
+
+	if ((spinCount2 != oldSpinCount2) || (spinCount3 != oldSpinCount3)) {
+		monitor->spinCount2 = spinCount2;
+		monitor->spinCount3 = spinCount3;
+		tracing->spin_tune_count += 1;
+		Trc_THR_Adapt_TuneSpin((IS_OBJECT_MONITOR(monitor) ? "object" : "system"), monitor,
+			successes, attempts, successPercent, loadPercent, holdtimeAvg,
+			oldSpinCount2, spinCount2, oldSpinCount3, spinCount3);
+	}
+}
+#endif /* OMR_THR_THREE_TIER_LOCKING */
 #endif /* OMR_THR_ADAPTIVE_SPIN */
 
 
@@ -339,7 +505,12 @@ jlm_thread_clear(omrthread_t thread)
 	ASSERT(thread);
 #if	defined(OMR_THR_JLM_HOLD_TIMES)
 	ASSERT(thread->tracing);
-	memset(thread->tracing, 0, sizeof(*thread->tracing));
+	{
+		/* keep the contention samples, they belong to the contention sampler rather than to JLM */
+		J9ThreadContentionBuffer *buffer = thread->tracing->contention_buffer;
+		memset(thread->tracing, 0, sizeof(*thread->tracing));
+		thread->tracing->contention_buffer = buffer;
+	}
 #endif
 }
 
@@ -360,6 +531,12 @@ jlm_thread_free(omrthread_library_t lib, omrthread_t thread)
 	ASSERT(thread);
 
 	if (thread->tracing != NULL) {
+		J9ThreadContentionBuffer *buffer = thread->tracing->contention_buffer;
+		if (NULL != buffer) {
+			/* samples not drained yet are lost with the thread */
+			lib->contentionDroppedSamples += (buffer->head - buffer->tail) + (buffer->dropped - buffer->droppedReported);
+			omrthread_free_memory(lib, buffer);
+		}
 		ASSERT(lib->thread_tracing_pool);
 		pool_removeElement(lib->thread_tracing_pool, thread->tracing);
 		thread->tracing = NULL;
@@ -434,3 +611,228 @@ jlm_monitor_free(omrthread_library_t lib, omrthread_monitor_t monitor)
 	}
 
 }
+
+
+/**
+ * Start sampling contended monitor enters.
+ *
+ * Every samplingInterval'th monitor enter of a thread that has to block is timed.
+ * When the monitor is released, the time spent blocked, the time the monitor was held
+ * and the caller that entered it are added to a buffer owned by the thread, without
+ * any locking. The samples are collected with omrthread_jlm_contention_drain.
+ *
+ * The JLM tracing structures are initialized if needed, but JLM itself is not enabled.
+ * Sampling can be started again to change the interval. Buffers that already exist
+ * keep their size.
+ *
+ * @param[in] samplingInterval sample one in this many contended enters per thread (non-zero)
+ * @param[in] bufferSize number of samples each thread can buffer, rounded up to a power of 2 (non-zero)
+ * @return 0 on success, non-zero on failure or if hold times are not supported
+ */
+intptr_t
+omrthread_jlm_contention_sampling_start(uintptr_t samplingInterval, uintptr_t bufferSize)
+{
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+	omrthread_t self = MACRO_SELF();
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	uintptr_t size = 1;
+	intptr_t retVal;
+
+	ASSERT(self);
+	ASSERT(lib);
+
+	if ((0 == samplingInterval) || (0 == bufferSize)) {
+		return -1;
+	}
+	while (size < bufferSize) {
+		size <<= 1;
+	}
+
+	GLOBAL_LOCK(self, CALLER_JLM_INIT);
+
+	retVal = jlm_base_init(lib);
+	if (0 == retVal) {
+		lib->contentionSamplingInterval = samplingInterval;
+		lib->contentionBufferSize = size;
+		lib->flags |= J9THREAD_LIB_FLAG_JLM_CONTENTION_SAMPLING_ENABLED;
+	}
+
+	GLOBAL_UNLOCK(self);
+
+	return retVal;
+#else /* OMR_THR_JLM_HOLD_TIMES */
+	return -1;
+#endif /* OMR_THR_JLM_HOLD_TIMES */
+}
+
+
+/**
+ * Stop sampling contended monitor enters.
+ *
+ * Monitors that are still held when sampling stops are still recorded when they
+ * are released. The buffered samples can still be drained.
+ */
+void
+omrthread_jlm_contention_sampling_stop(void)
+{
+	omrthread_t self = MACRO_SELF();
+
+	ASSERT(self);
+
+	GLOBAL_LOCK(self, CALLER_JLM_INIT);
+	self->library->flags &= ~J9THREAD_LIB_FLAG_JLM_CONTENTION_SAMPLING_ENABLED;
+	GLOBAL_UNLOCK(self);
+}
+
+
+/**
+ * Move the buffered contention samples of all threads to samples.
+ *
+ * If there are more than maxSamples, the remaining ones are left for the
+ * next call. Samples of threads that exited before their samples were
+ * drained, and samples that did not fit in a full buffer, are counted in
+ * droppedSamples.
+ *
+ * @param[out] samples array of at least maxSamples samples
+ * @param[in] maxSamples
+ * @param[out] droppedSamples number of samples lost since the last call. May be NULL.
+ * @return the number of samples copied
+ */
+uintptr_t
+omrthread_jlm_contention_drain(J9ThreadContentionSample *samples, uintptr_t maxSamples, uintptr_t *droppedSamples)
+{
+	uintptr_t count = 0;
+	uintptr_t dropped = 0;
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+	omrthread_t self = MACRO_SELF();
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	omrthread_t thread;
+	pool_state state;
+
+	ASSERT(self);
+	ASSERT(lib);
+
+	GLOBAL_LOCK(self, CALLER_JLM_INIT);
+
+	dropped = lib->contentionDroppedSamples;
+	lib->contentionDroppedSamples = 0;
+
+	thread = pool_startDo(lib->thread_pool, &state);
+	while (NULL != thread) {
+		J9ThreadContentionBuffer *buffer = (NULL == thread->tracing) ? NULL : thread->tracing->contention_buffer;
+
+		if (NULL != buffer) {
+			uintptr_t head = buffer->head;
+			uintptr_t tail = buffer->tail;
+			uintptr_t threadDropped = buffer->dropped;
+
+			/* the samples below head were written before head was advanced */
+			issueReadBarrier();
+			while ((tail != head) && (count < maxSamples)) {
+				samples[count] = buffer->samples[tail & (buffer->size - 1)];
+				count += 1;
+				tail += 1;
+			}
+			/* finish reading the samples before their slots can be reused */
+			issueReadWriteBarrier();
+			buffer->tail = tail;
+
+			dropped += threadDropped - buffer->droppedReported;
+			buffer->droppedReported = threadDropped;
+		}
+		thread = pool_nextDo(&state);
+	}
+
+	GLOBAL_UNLOCK(self);
+#endif /* OMR_THR_JLM_HOLD_TIMES */
+
+	if (NULL != droppedSamples) {
+		*droppedSamples = dropped;
+	}
+	return count;
+}
+
+
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+/**
+ * Allocate the contention sample buffer of the current thread.
+ *
+ * @param[in] self current thread
+ * @return the buffer, or NULL if it could not be allocated
+ */
+static J9ThreadContentionBuffer *
+jlm_contention_buffer_allocate(omrthread_t self)
+{
+	omrthread_library_t lib = self->library;
+	uintptr_t size = lib->contentionBufferSize;
+	J9ThreadContentionBuffer *buffer = NULL;
+
+	if (0 != size) {
+		buffer = (J9ThreadContentionBuffer *)omrthread_allocate_memory(lib,
+			offsetof(J9ThreadContentionBuffer, samples) + (size * sizeof(J9ThreadContentionSample)),
+			OMRMEM_CATEGORY_THREADS);
+		if (NULL != buffer) {
+			buffer->head = 0;
+			buffer->tail = 0;
+			buffer->dropped = 0;
+			buffer->droppedReported = 0;
+			buffer->size = size;
+			/* the buffer is initialized before omrthread_jlm_contention_drain can see it */
+			issueWriteBarrier();
+			self->tracing->contention_buffer = buffer;
+		}
+	}
+
+	return buffer;
+}
+
+
+/**
+ * Record the sampled contended enter of a monitor that the current thread is releasing.
+ *
+ * The sample is dropped if the buffer of the thread is full or cannot be allocated.
+ *
+ * @param[in] self current thread
+ * @param[in] monitor the monitor being released, with a pending contention sample
+ */
+void
+jlm_contention_record(omrthread_t self, omrthread_monitor_t monitor)
+{
+	J9ThreadMonitorTracing *tracing = monitor->tracing;
+	omrtime_t holdTime = GET_HIRES_CLOCK() - tracing->contention_enter_time;
+	J9ThreadContentionBuffer *buffer = NULL;
+
+	tracing->contention_enter_time = 0;
+
+	if (NULL == self->tracing) {
+		return;
+	}
+	buffer = self->tracing->contention_buffer;
+	if (NULL == buffer) {
+		buffer = jlm_contention_buffer_allocate(self);
+		if (NULL == buffer) {
+			return;
+		}
+	}
+
+	if ((buffer->head - buffer->tail) >= buffer->size) {
+		buffer->dropped += 1;
+	} else {
+		J9ThreadContentionSample *sample = &buffer->samples[buffer->head & (buffer->size - 1)];
+
+		sample->callsite = tracing->contention_callsite;
+		sample->monitor = monitor;
+		sample->wait_time = tracing->contention_wait_time;
+		sample->hold_time = holdTime;
+		if (NULL == monitor->name) {
+			sample->monitor_name[0] = '\0';
+		} else {
+			strncpy(sample->monitor_name, monitor->name, J9THREAD_CONTENTION_NAME_LENGTH - 1);
+			sample->monitor_name[J9THREAD_CONTENTION_NAME_LENGTH - 1] = '\0';
+		}
+		/* the sample is complete before omrthread_jlm_contention_drain can see it */
+		issueWriteBarrier();
+		buffer->head += 1;
+	}
+}
+#endif /* OMR_THR_JLM_HOLD_TIMES */
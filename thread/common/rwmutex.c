@@ -22,16 +22,47 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "threaddef.h"
 #include "thread_internal.h"
+#include "omrutilbase.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+/*
+ * A J9THREAD_RWMUTEX_READER_BIASED mutex counts its readers in an array of reader slots,
+ * each on its own cache line, instead of in status. A reader picks a slot by hashing its
+ * omrthread_t, increments it, and then checks readerBias. While readerBias is set, that is
+ * all a reader does, so readers on different slots never write to a shared cache line.
+ *
+ * A writer revokes the bias by clearing readerBias, and then waits under syncMon until every
+ * slot is zero. A reader which finds the bias revoked backs out of its slot and takes the
+ * slow path through syncMon, and a reader which exits while the bias is revoked wakes the
+ * waiting writers. The barriers between updating the slot and reading readerBias in the
+ * reader, and between clearing readerBias and reading the slots in the writer, ensure that
+ * either the writer sees the reader or the reader sees that the bias has been revoked.
+ * The bias is restored when the last pending writer exits.
+ *
+ * status still counts the recursive enters of the writer, and is < 0 while it is writing.
+ */
+#define RWMUTEX_READER_SLOTS 64
+#define RWMUTEX_READER_SLOT_SIZE 64
+
+typedef struct RWMutexReaderSlot {
+	volatile uintptr_t count;
+	uint8_t padding[RWMUTEX_READER_SLOT_SIZE - sizeof(uintptr_t)];
+} RWMutexReaderSlot;
+
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	uintptr_t waitingWriters;
+	volatile uintptr_t readerBias;
+	RWMutexReaderSlot *readerSlots;	/* aligned to RWMUTEX_READER_SLOT_SIZE, or NULL if the mutex is not reader biased */
+	void *readerSlotsMemory;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -42,9 +73,59 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
 
+#define RWMUTEX_READER_BIASED(m)  (NULL != (m)->readerSlots)
+#define RWMUTEX_WRITER_PREFERENCE(m)  (J9THREAD_RWMUTEX_WRITER_PREFERENCE == ((m)->flags & J9THREAD_RWMUTEX_WRITER_PREFERENCE))
+
+/* readers wait in the slow path while a writer holds the mutex or, with writer preference, while one is waiting for it */
+#define RWMUTEX_READERS_BLOCKED(m)  (RWMUTEX_STATUS_WRITING(m) || (RWMUTEX_WRITER_PREFERENCE(m) && (0 != (m)->waitingWriters)))
+
+static volatile uintptr_t *readerSlot(omrthread_rwmutex_t mutex, omrthread_t self);
+static BOOLEAN biasedReadersActive(omrthread_rwmutex_t mutex);
+
+/**
+ * Find the reader slot of a thread in a reader biased mutex.
+ */
+static volatile uintptr_t *
+readerSlot(omrthread_rwmutex_t mutex, omrthread_t self)
+{
+	/* Fibonacci hashing, which spreads consecutively allocated threads over the slots */
+	uintptr_t hash = ((uintptr_t)self >> 4) * (uintptr_t)0x9E3779B9U;
+
+	return &mutex->readerSlots[(hash >> 16) & (RWMUTEX_READER_SLOTS - 1)].count;
+}
+
+/**
+ * Check whether any reader holds a reader biased mutex, or is about to find that the bias
+ * has been revoked. The bias must have been revoked, with a barrier, before this is called.
+ */
+static BOOLEAN
+biasedReadersActive(omrthread_rwmutex_t mutex)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < RWMUTEX_READER_SLOTS; i++) {
+		if (0 != mutex->readerSlots[i].count) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
+ * Flags may be 0, or a combination of:
+ *
+ * J9THREAD_RWMUTEX_READER_BIASED: readers enter and exit the mutex without touching any
+ * cache line shared with other readers, and writers pay for this by waiting for every
+ * reader slot to drain. Use this for mutexes which are entered for read far more often
+ * than for write.
+ *
+ * J9THREAD_RWMUTEX_WRITER_PREFERENCE: readers wait for pending writers, rather than
+ * only for the current writer, so that a stream of readers cannot starve a writer.
+ * A thread which holds the mutex for read must not enter it for read again, as the
+ * second enter could wait for a writer which is waiting for the first one to exit.
+ *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
  * @param[in] flags initial flag values for the mutex
  * @return J9THREAD_RWMUTEX_OK on success
@@ -69,12 +150,41 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 	if (NULL == mutex) {
 		ret = J9THREAD_RWMUTEX_FAIL;
 	} else {
-		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
+		mutex->flags = flags;
+		mutex->waitingWriters = 0;
+		mutex->readerBias = 0;
+		mutex->readerSlots = NULL;
+		mutex->readerSlotsMemory = NULL;
+
+		if (J9THREAD_RWMUTEX_READER_BIASED == (flags & J9THREAD_RWMUTEX_READER_BIASED)) {
+			uintptr_t size = (RWMUTEX_READER_SLOTS + 1) * sizeof(RWMutexReaderSlot);
+
+			mutex->readerSlotsMemory = omrthread_allocate_memory(lib, size, OMRMEM_CATEGORY_THREADS);
+			if (NULL == mutex->readerSlotsMemory) {
+				ret = J9THREAD_RWMUTEX_FAIL;
+			} else {
+				memset(mutex->readerSlotsMemory, 0, size);
+				mutex->readerSlots = (RWMutexReaderSlot *)(((uintptr_t)mutex->readerSlotsMemory + RWMUTEX_READER_SLOT_SIZE - 1) & ~(uintptr_t)(RWMUTEX_READER_SLOT_SIZE - 1));
+				mutex->readerBias = 1;
+			}
+		}
+	}
+
+	if (J9THREAD_RWMUTEX_OK == ret) {
+		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 
 		ASSERT(handle);
 		*handle = mutex;
+	} else if (NULL != mutex) {
+#if defined(OMR_THR_FORK_SUPPORT)
+		GLOBAL_LOCK_SIMPLE(lib);
+		pool_removeElement(lib->rwmutexPool, mutex);
+		GLOBAL_UNLOCK_SIMPLE(lib);
+#else /* defined(OMR_THR_FORK_SUPPORT) */
+		omrthread_free_memory(lib, mutex);
+#endif /* defined(OMR_THR_FORK_SUPPORT) */
 	}
 
 	return ret;
@@ -103,6 +213,9 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->readerSlotsMemory) {
+		omrthread_free_memory(lib, mutex->readerSlotsMemory);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -142,14 +255,40 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		volatile uintptr_t *slot = readerSlot(mutex, self);
+
+		addAtomic(slot, 1);
+		issueReadWriteBarrier();
+		if (0 != mutex->readerBias) {
+			return J9THREAD_RWMUTEX_OK;
+		}
+
+		/* the bias has been revoked: back out, and wake any writer waiting for this slot to drain */
+		subtractAtomic(slot, 1);
+
+		omrthread_monitor_enter(mutex->syncMon);
+		if (0 != mutex->waitingWriters) {
+			omrthread_monitor_notify_all(mutex->syncMon);
+		}
+		while (RWMUTEX_READERS_BLOCKED(mutex)) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		addAtomic(slot, 1);
+		omrthread_monitor_exit(mutex->syncMon);
+
 		return J9THREAD_RWMUTEX_OK;
 	}
 
 	omrthread_monitor_enter(mutex->syncMon);
 
-	while (mutex->status < 0) {
+	while (RWMUTEX_READERS_BLOCKED(mutex)) {
 		omrthread_monitor_wait(mutex->syncMon);
 	}
 	mutex->status++;
@@ -170,8 +309,24 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		subtractAtomic(readerSlot(mutex, self), 1);
+		issueReadWriteBarrier();
+		if (0 == mutex->readerBias) {
+			/* a writer may be waiting for the reader slots to drain */
+			omrthread_monitor_enter(mutex->syncMon);
+			if (0 != mutex->waitingWriters) {
+				omrthread_monitor_notify_all(mutex->syncMon);
+			}
+			omrthread_monitor_exit(mutex->syncMon);
+		}
+
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -179,7 +334,12 @@ omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 
 	mutex->status--;
 	if (0 == mutex->status) {
-		omrthread_monitor_notify(mutex->syncMon);
+		if (RWMUTEX_WRITER_PREFERENCE(mutex)) {
+			/* readers waiting for the pending writers must not take the only notification */
+			omrthread_monitor_notify_all(mutex->syncMon);
+		} else {
+			omrthread_monitor_notify(mutex->syncMon);
+		}
 	}
 
 	omrthread_monitor_exit(mutex->syncMon);
@@ -226,9 +386,15 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 
 	omrthread_monitor_enter(mutex->syncMon);
 
-	while (mutex->status != 0) {
+	mutex->waitingWriters++;
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		mutex->readerBias = 0;
+		issueReadWriteBarrier();
+	}
+	while ((mutex->status != 0) || (RWMUTEX_READER_BIASED(mutex) && biasedReadersActive(mutex))) {
 		omrthread_monitor_wait(mutex->syncMon);
 	}
+	mutex->waitingWriters--;
 	mutex->status--;
 	mutex->writer = self;
 
@@ -268,6 +434,17 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 		omrthread_monitor_exit(mutex->syncMon);
 		return J9THREAD_RWMUTEX_WOULDBLOCK;
 	}
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		mutex->readerBias = 0;
+		issueReadWriteBarrier();
+		if (biasedReadersActive(mutex)) {
+			if (0 == mutex->waitingWriters) {
+				mutex->readerBias = 1;
+			}
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+	}
 	mutex->status--;
 	mutex->writer = self;
 
@@ -299,6 +476,9 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		if (RWMUTEX_READER_BIASED(mutex) && (0 == mutex->waitingWriters)) {
+			mutex->readerBias = 1;
+		}
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -334,6 +514,17 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
+	if (RWMUTEX_READER_BIASED(rwmutex)) {
+		/* revoke the bias, so that the slots can be checked as a writer would */
+		rwmutex->readerBias = 0;
+		issueReadWriteBarrier();
+		if (biasedReadersActive(rwmutex)) {
+			fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
+			abort();
+		}
+	}
+	/* threads waiting to write do not exist in the child */
+	rwmutex->waitingWriters = 0;
 	if (rwmutex->writer != self) {
 		/* If another thread was writing or reading and the current thread is not blocked,
 		 * reset it. If current thread is writer, it stays writer. The syncMon is reset
@@ -341,6 +532,9 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		if (RWMUTEX_READER_BIASED(rwmutex)) {
+			rwmutex->readerBias = 1;
+		}
 	}
 }
 
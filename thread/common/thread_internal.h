@@ -111,6 +111,28 @@ jlm_monitor_free(omrthread_library_t lib, omrthread_monitor_t monitor);
 void
 jlm_monitor_clear(omrthread_library_t lib, omrthread_monitor_t monitor);
 
+#if defined(OMR_THR_JLM) && defined(OMR_THR_JLM_HOLD_TIMES)
+/**
+ * @brief
+ * @param self
+ * @param monitor
+ * @return void
+ */
+void
+jlm_contention_record(omrthread_t self, omrthread_monitor_t monitor);
+#endif /* OMR_THR_JLM && OMR_THR_JLM_HOLD_TIMES */
+
+#if defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING)
+/**
+ * @brief
+ * @param self
+ * @param monitor
+ * @return void
+ */
+void
+jlm_adaptive_spin_tune(omrthread_t self, omrthread_monitor_t monitor);
+#endif /* OMR_THR_ADAPTIVE_SPIN && OMR_THR_THREE_TIER_LOCKING */
+
 #endif /* OMR_THR_JLM */
 
 /* ---------------- omrthreadtls.c ---------------- */
@@ -251,7 +251,8 @@ enum {
 
 #if defined(OMR_THR_ADAPTIVE_SPIN)
 #define IS_JLM_TIME_STAMPS_ENABLED(thread, monitor) \
-	(((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_TIME_STAMPS_ENABLED) || IS_JLM_HOLDTIME_SAMPLING_ENABLED((thread), (monitor)))
+	(((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_TIME_STAMPS_ENABLED) || IS_JLM_HOLDTIME_SAMPLING_ENABLED((thread), (monitor)) \
+	 || IS_ADAPT_SPIN_TUNING_ENABLED((thread), (monitor)))
 #else /* IS_JLM_TIME_STAMPS_ENABLED */
 #define IS_JLM_TIME_STAMPS_ENABLED(thread, monitor) ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_TIME_STAMPS_ENABLED)
 #endif /* IS_JLM_TIME_STAMPS_ENABLED */
@@ -274,12 +275,16 @@ enum {
 											   ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_SLOW_SAMPLING_ENABLED) : \
 											   (CUSTOM_ADAPTIVE_SPIN_TRUE == (monitor)->customSpinOptions->customAdaptSpin))
 #define IS_ADAPTIVE_SPIN_REQUIRED(monitor) ((NULL == (monitor)->customSpinOptions) || (CUSTOM_ADAPTIVE_SPIN_TRUE == (monitor)->customSpinOptions->customAdaptSpin))
+/* Monitors with custom spin options keep the spin counts they were given. */
+#define IS_ADAPT_SPIN_TUNING_ENABLED(thread, monitor) ((NULL == (monitor)->customSpinOptions) && \
+													   ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_SPIN_TUNING_ENABLED))
 #else /* OMR_THR_CUSTOM_SPIN_OPTIONS */
 #define IS_JLM_SAMPLE_ENABLED(thread, monitor) ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_INFO_SAMPLING_ENABLED)
 #define IS_JLM_HOLDTIME_SAMPLING_ENABLED(thread, monitor) ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_HOLDTIME_SAMPLING_ENABLED)
 #define IS_ADAPT_HOLDTIME_ENABLED(thread, monitor) ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_HOLDTIME_SAMPLING_ENABLED)
 #define IS_ADAPT_SLOW_ENABLED(thread, monitor) ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_SLOW_SAMPLING_ENABLED)
 #define IS_ADAPTIVE_SPIN_REQUIRED(monitor)  (TRUE)
+#define IS_ADAPT_SPIN_TUNING_ENABLED(thread, monitor) ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_SPIN_TUNING_ENABLED)
 #endif /* OMR_THR_CUSTOM_SPIN_OPTIONS */
 
 #define IS_ADAPT_SLOW_PERCENT_ENABLED(thread, monitor) (IS_ADAPT_SLOW_ENABLED((thread), (monitor)) && (0 != (thread)->library->adaptSpinSlowPercent))
@@ -378,13 +383,38 @@ enum {
 
 #define JLM_INIT_SAMPLE_INTERVAL(lib, monitor) ((monitor)->sampleCounter = (lib)->adaptSpinSampleThreshold)
 
+/* Spin tuning: the fewest spinning acquires between two tuning decisions,
+ * and the success rates (in percent) below which spinning is cut back and
+ * above which it is restored towards the defaults.
+ */
+#define ADAPT_SPIN_TUNE_MIN_ATTEMPTS  16
+#define ADAPT_SPIN_TUNE_LOW_SUCCESS_PERCENT  25
+#define ADAPT_SPIN_TUNE_HIGH_SUCCESS_PERCENT  75
+/* Runnable threads as a percentage of the online CPUs: at or above the first
+ * spinning is cut back regardless of success, and cut back counts are only
+ * restored below the second.
+ */
+#define ADAPT_SPIN_TUNE_MAX_LOAD_PERCENT  100
+#define ADAPT_SPIN_TUNE_RESTORE_LOAD_PERCENT  50
+/* spinCount2 is never grown past this multiple of its default */
+#define ADAPT_SPIN_TUNE_MAX_SPIN2_FACTOR  4
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+#define ADAPT_SPIN_TUNE(thread, monitor) jlm_adaptive_spin_tune((thread), (monitor))
+#else /* OMR_THR_THREE_TIER_LOCKING */
+#define ADAPT_SPIN_TUNE(thread, monitor)
+#endif /* OMR_THR_THREE_TIER_LOCKING */
+
 #define DO_ADAPT_CHECK(thread, monitor) \
 	do { \
 		if (IS_ADAPTIVE_SPIN_REQUIRED(monitor)) { \
 			if (IS_ADAPT_SAMPLING_ENABLED((thread), (monitor))) { \
 				if (0 == (monitor)->sampleCounter) { \
 					JLM_INIT_SAMPLE_INTERVAL((thread)->library, (monitor)); \
-					if (SHOULD_DISABLE_ADAPT_SAMPLING((thread), (monitor))) { \
+					if (IS_ADAPT_SPIN_TUNING_ENABLED((thread), (monitor))) { \
+						/* the tuner needs the samples for as long as the monitor lives */ \
+						ADAPT_SPIN_TUNE((thread), (monitor)); \
+					} else if (SHOULD_DISABLE_ADAPT_SAMPLING((thread), (monitor))) { \
 						ADAPT_DISABLE_SAMPLING((thread), (monitor)); \
 					} \
 				} else { \
@@ -563,6 +593,70 @@ enum {
 #define UPDATE_JLM_MON_EXIT_HOLD_TIMES(self, monitor)
 #endif /* OMR_THR_JLM_HOLD_TIMES */
 
+/* MACROS FOR CONTENTION SAMPLING */
+#if defined(OMR_THR_JLM) && defined(OMR_THR_JLM_HOLD_TIMES)
+/*
+ * Per-thread ring of contention samples. Only the owning thread adds samples (at head),
+ * and only omrthread_jlm_contention_drain removes them (at tail), under the GLOBAL LOCK.
+ */
+typedef struct J9ThreadContentionBuffer {
+	volatile uintptr_t head;
+	volatile uintptr_t tail;
+	uintptr_t dropped;
+	uintptr_t droppedReported;
+	uintptr_t size;
+	J9ThreadContentionSample samples[1];
+} J9ThreadContentionBuffer;
+
+#if defined(__GNUC__)
+#define JLM_CONTENTION_CALLSITE() __builtin_return_address(0)
+#else /* defined(__GNUC__) */
+#define JLM_CONTENTION_CALLSITE() NULL
+#endif /* defined(__GNUC__) */
+
+#define IS_JLM_CONTENTION_SAMPLING_ENABLED(thread) ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_CONTENTION_SAMPLING_ENABLED)
+
+/*
+ * Called once per slow enter, just before the thread first blocks. Every
+ * contentionSamplingInterval'th slow enter of a thread is timed.
+ */
+#define JLM_CONTENTION_SAMPLE_BEGIN(self, startTime) \
+	do { \
+		if (IS_JLM_CONTENTION_SAMPLING_ENABLED(self) && (NULL != (self)->tracing)) { \
+			if (0 == (self)->tracing->contention_countdown) { \
+				(self)->tracing->contention_countdown = (self)->library->contentionSamplingInterval - 1; \
+				(startTime) = GET_HIRES_CLOCK(); \
+			} else { \
+				(self)->tracing->contention_countdown -= 1; \
+			} \
+		} \
+	} while (0)
+
+/* The sampled enter is complete: remember the wait time until the monitor is released. */
+#define JLM_CONTENTION_SAMPLE_ACQUIRED(self, monitor, startTime, callsite) \
+	do { \
+		if ((0 != (startTime)) && (NULL != (monitor)->tracing)) { \
+			omrtime_t acquiredTime = GET_HIRES_CLOCK(); \
+			(monitor)->tracing->contention_callsite = (callsite); \
+			(monitor)->tracing->contention_wait_time = acquiredTime - (startTime); \
+			(monitor)->tracing->contention_enter_time = acquiredTime; \
+		} \
+	} while (0)
+
+/* NOTE: This is only done for non-recursive exits and waits. */
+#define JLM_CONTENTION_SAMPLE_RELEASE(self, monitor) \
+	do { \
+		if ((NULL != (monitor)->tracing) && (0 != (monitor)->tracing->contention_enter_time)) { \
+			jlm_contention_record((self), (monitor)); \
+		} \
+	} while (0)
+#else /* OMR_THR_JLM && OMR_THR_JLM_HOLD_TIMES */
+#define JLM_CONTENTION_CALLSITE() NULL
+#define JLM_CONTENTION_SAMPLE_BEGIN(self, startTime)
+#define JLM_CONTENTION_SAMPLE_ACQUIRED(self, monitor, startTime, callsite)
+#define JLM_CONTENTION_SAMPLE_RELEASE(self, monitor)
+#endif /* OMR_THR_JLM && OMR_THR_JLM_HOLD_TIMES */
+
 #ifdef __cplusplus
 }
 #endif
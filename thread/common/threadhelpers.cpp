@@ -64,6 +64,12 @@ omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monitor)
 	if (OMR_ARE_ALL_BITS_SET(lib->flags, J9THREAD_LIB_FLAG_JLM_ENABLED)) {
 		tracing = monitor->tracing;
 	}
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+	J9ThreadMonitorTracing *tuneTracing = NULL;
+	if (IS_ADAPT_SPIN_TUNING_ENABLED(self, monitor)) {
+		tuneTracing = monitor->tracing;
+	}
+#endif /* OMR_THR_ADAPTIVE_SPIN */
 #endif /* OMR_THR_JLM */
 
 	uintptr_t spinCount3Init = monitor->spinCount3;
@@ -131,6 +137,20 @@ update_jlm:
 		VM_AtomicSupport::add(&tracing->yield_count, yield_count);
 		VM_AtomicSupport::add(&tracing->spin2_count, spin2_count);
 	}
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+	/* Count the acquires that had to spin, and how many of them got the lock
+	 * by spinning, for the spin tuner. An acquire that got the lock on the
+	 * first try did not spin at all.
+	 */
+	if ((NULL != tuneTracing)
+		&& ((0 != result) || (spinCount3 != spinCount3Init) || (spinCount2 != spinCount2Init))
+	) {
+		VM_AtomicSupport::add(&tuneTracing->spin_attempt_count, 1);
+		if (0 == result) {
+			VM_AtomicSupport::add(&tuneTracing->spin_success_count, 1);
+		}
+	}
+#endif /* OMR_THR_ADAPTIVE_SPIN */
 #endif /* OMR_THR_JLM */
 
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
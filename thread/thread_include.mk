@@ -110,6 +110,9 @@ ifeq (1,$(OMR_THR_JLM))
 define WRITE_JLM_THREAD_EXPORTS
 @echo omrthread_jlm_init >>$@
 @echo omrthread_jlm_get_gc_lock_tracing >>$@
+@echo omrthread_jlm_contention_sampling_start >>$@
+@echo omrthread_jlm_contention_sampling_stop >>$@
+@echo omrthread_jlm_contention_drain >>$@
 endef
 endif
 
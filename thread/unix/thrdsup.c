@@ -33,6 +33,12 @@
 #include <linux/prctl.h>
 #endif /* defined(LINUX) */
 
+#if J9THREAD_USE_FUTEX_COND
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif /* J9THREAD_USE_FUTEX_COND */
+
 #if defined(OMRZTPF)
 #include <tpf/c_eb0eb.h>
 #include <tpf/sysapi.h>
@@ -184,6 +190,71 @@ linux_pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex, const
 }
 #endif
 
+#if J9THREAD_USE_FUTEX_COND
+/**
+ * Wait on a futex condition. The caller must own mutex, which is released while
+ * the thread sleeps and owned again on return.
+ *
+ * A notify that advances the sequence after it was read here, but before the
+ * thread sleeps, makes FUTEX_WAIT_BITSET return immediately, so no wakeup is lost.
+ * A notifier skips the wake when it sees no waiters, which is safe because the
+ * waiter count is raised before the sequence is read.
+ *
+ * @param[in] cond the condition to wait on
+ * @param[in] mutex the mutex paired with cond
+ * @param[in] abstime the absolute time, on TIMEOUT_CLOCK, at which to stop waiting, or NULL to wait forever
+ * @return ETIMEDOUT if abstime passed, 0 otherwise (including spurious wakeups)
+ */
+int
+futex_cond_wait(J9FutexCond *cond, pthread_mutex_t *mutex, const struct timespec *abstime)
+{
+	int rc = 0;
+	int op = FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG;
+	uint32_t sequence = 0;
+
+	if ((NULL != abstime) && (CLOCK_REALTIME == TIMEOUT_CLOCK)) {
+		op |= FUTEX_CLOCK_REALTIME;
+	}
+
+	addAtomic(&cond->waiters, 1);
+	issueReadWriteBarrier();
+	sequence = cond->sequence;
+	pthread_mutex_unlock(mutex);
+
+	if ((-1 == syscall(SYS_futex, &cond->sequence, op, sequence, abstime, NULL, FUTEX_BITSET_MATCH_ANY))
+		&& (ETIMEDOUT == errno)
+	) {
+		rc = ETIMEDOUT;
+	}
+
+	pthread_mutex_lock(mutex);
+	subtractAtomic(&cond->waiters, 1);
+	return rc;
+}
+
+/**
+ * Wake one or all of the threads waiting on a futex condition.
+ *
+ * @param[in] cond the condition to notify
+ * @param[in] notifyAll TRUE to wake every waiter, FALSE to wake one
+ * @return 0
+ */
+int
+futex_cond_notify(J9FutexCond *cond, BOOLEAN notifyAll)
+{
+	uint32_t sequence = cond->sequence;
+
+	while (sequence != compareAndSwapU32((uint32_t *)&cond->sequence, sequence, sequence + 1)) {
+		sequence = cond->sequence;
+	}
+	issueReadWriteBarrier();
+	if (0 != cond->waiters) {
+		syscall(SYS_futex, &cond->sequence, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, notifyAll ? INT_MAX : 1, NULL, NULL, 0);
+	}
+	return 0;
+}
+#endif /* J9THREAD_USE_FUTEX_COND */
+
 #if defined(J9ZOS390) && defined(OMR_INTERP_HAS_SEMAPHORES)
 
 intptr_t
@@ -423,7 +494,7 @@ intptr_t
 j9OSCond_freeAndDestroy(J9OSCond cond)
 {
 	omrthread_library_t lib = GLOBAL_DATA(default_library);
-	intptr_t rc = pthread_cond_destroy(cond);
+	intptr_t rc = COND_DESTROY(*cond);
 	omrthread_free_memory(lib, cond);
 	return rc;
 }
@@ -435,7 +506,7 @@ j9OSCond_freeAndDestroy(J9OSCond cond)
 intptr_t
 j9OSCond_notifyAll(J9OSCond cond)
 {
-	return pthread_cond_broadcast(cond);
+	return COND_NOTIFY_ALL(*cond);
 }
 
 /**
@@ -445,7 +516,7 @@ j9OSCond_notifyAll(J9OSCond cond)
 intptr_t
 j9OSCond_notify(J9OSCond cond)
 {
-	return pthread_cond_signal(cond);
+	return COND_NOTIFY(*cond);
 }
 
 /**
@@ -458,11 +529,7 @@ j9OSCond_allocAndInit(J9OSCond *cond)
 	omrthread_library_t lib = GLOBAL_DATA(default_library);
 	intptr_t rc = 1;
 	*cond = (J9OSCond)omrthread_allocate_memory(lib, sizeof(**cond), OMRMEM_CATEGORY_OSCONDVARS);
-#if J9THREAD_USE_MONOTONIC_COND_CLOCK
-	rc = (NULL != *cond) && (pthread_cond_init(*cond, defaultCondAttr) == 0);
-#else
-	rc = (NULL != *cond) && (pthread_cond_init(*cond, NULL) == 0);
-#endif
+	rc = (NULL != *cond) && COND_INIT(**cond);
 	return rc;
 }
 
@@ -0,0 +1,590 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup AVL
+ * @brief B+-tree of disjoint address ranges
+ *
+ * An alternative to J9AVLTree for range lookups such as finding the code metadata
+ * that contains a PC. Keys are the start addresses of the ranges. Every node begins
+ * with J9BTREE_NODE_KEYS keys and a count, which fill two cache lines on 64-bit
+ * platforms, so one level of a lookup touches two or three cache lines instead of
+ * one scattered AVL node per comparison.
+ *
+ * Inner nodes hold J9BTREE_NODE_KEYS + 1 children. Every start in children[i] is
+ * below keys[i] and at least keys[i - 1]. Leaves hold the ranges in start order and
+ * are linked in both directions, so the range preceding an address can be found
+ * even when it sits at the end of the previous leaf.
+ *
+ * Deletion removes a leaf once it is empty, and an inner node once it has no
+ * children left, but does not merge half-empty nodes.
+ */
+
+#include <string.h>
+
+#include "omravl.h"
+#include "avl_internal.h"
+#include "omrutil.h"
+#include "pool_api.h"
+#include "ut_avl.h"
+
+/* Deep enough for more ranges than fit in the address space, with inner nodes at least half full after splits. */
+#define BTREE_MAX_HEIGHT 32
+#define BTREE_NODE_ALIGNMENT 64
+#define BTREE_UNUSED_KEY ((uintptr_t)-1)
+
+typedef struct J9BTreeNode {
+	uintptr_t keys[J9BTREE_NODE_KEYS]; /**< unused keys are BTREE_UNUSED_KEY */
+	uintptr_t count;
+} J9BTreeNode;
+
+typedef struct J9BTreeInnerNode {
+	J9BTreeNode node;
+	J9BTreeNode *children[J9BTREE_NODE_KEYS + 1];
+} J9BTreeInnerNode;
+
+typedef struct J9BTreeLeafNode {
+	J9BTreeNode node;
+	uintptr_t ends[J9BTREE_NODE_KEYS];
+	void *values[J9BTREE_NODE_KEYS];
+	struct J9BTreeLeafNode *previous;
+	struct J9BTreeLeafNode *next;
+} J9BTreeLeafNode;
+
+/* The inner nodes crossed on the way to a leaf, and the child taken at each. */
+typedef struct J9BTreePath {
+	J9BTreeInnerNode *nodes[BTREE_MAX_HEIGHT];
+	uintptr_t childIndexes[BTREE_MAX_HEIGHT];
+	uintptr_t depth;
+} J9BTreePath;
+
+/**
+ * Count the keys of node that are less than or equal to key.
+ *
+ * Every slot is compared, so the loop has no data dependent branch and
+ * the compiler can vectorize it. Unused slots hold BTREE_UNUSED_KEY and
+ * only count for a key of BTREE_UNUSED_KEY, hence the clamp.
+ */
+static VMINLINE uintptr_t
+nodeRank(J9BTreeNode *node, uintptr_t key)
+{
+	uintptr_t rank = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < J9BTREE_NODE_KEYS; i++) {
+		rank += (node->keys[i] <= key) ? 1 : 0;
+	}
+
+	return (rank < node->count) ? rank : node->count;
+}
+
+static J9BTreeNode *
+newNode(J9BTree *tree)
+{
+	J9BTreeNode *node = pool_newElement(tree->nodePool);
+
+	if (NULL != node) {
+		uintptr_t i = 0;
+		for (i = 0; i < J9BTREE_NODE_KEYS; i++) {
+			node->keys[i] = BTREE_UNUSED_KEY;
+		}
+		node->count = 0;
+	}
+
+	return node;
+}
+
+/**
+ * Walk from the root to the leaf whose key interval contains key.
+ *
+ * @param[out] path if not NULL, filled in with the inner nodes crossed
+ */
+static J9BTreeLeafNode *
+findLeaf(J9BTree *tree, uintptr_t key, J9BTreePath *path)
+{
+	J9BTreeNode *node = tree->root;
+	uintptr_t level = 1;
+
+	for (level = 1; level < tree->height; level++) {
+		J9BTreeInnerNode *inner = (J9BTreeInnerNode *)node;
+		uintptr_t childIndex = nodeRank(node, key);
+
+		if (NULL != path) {
+			path->nodes[level - 1] = inner;
+			path->childIndexes[level - 1] = childIndex;
+		}
+		node = inner->children[childIndex];
+	}
+	if (NULL != path) {
+		path->depth = tree->height - 1;
+	}
+
+	return (J9BTreeLeafNode *)node;
+}
+
+static void
+leafInsertAt(J9BTreeLeafNode *leaf, uintptr_t index, uintptr_t start, uintptr_t end, void *value)
+{
+	uintptr_t moved = leaf->node.count - index;
+
+	memmove(&leaf->node.keys[index + 1], &leaf->node.keys[index], moved * sizeof(uintptr_t));
+	memmove(&leaf->ends[index + 1], &leaf->ends[index], moved * sizeof(uintptr_t));
+	memmove(&leaf->values[index + 1], &leaf->values[index], moved * sizeof(void *));
+	leaf->node.keys[index] = start;
+	leaf->ends[index] = end;
+	leaf->values[index] = value;
+	leaf->node.count += 1;
+}
+
+static void
+leafRemoveAt(J9BTreeLeafNode *leaf, uintptr_t index)
+{
+	uintptr_t moved = leaf->node.count - index - 1;
+
+	memmove(&leaf->node.keys[index], &leaf->node.keys[index + 1], moved * sizeof(uintptr_t));
+	memmove(&leaf->ends[index], &leaf->ends[index + 1], moved * sizeof(uintptr_t));
+	memmove(&leaf->values[index], &leaf->values[index + 1], moved * sizeof(void *));
+	leaf->node.count -= 1;
+	leaf->node.keys[leaf->node.count] = BTREE_UNUSED_KEY;
+}
+
+/**
+ * Insert key and the child to its right at position index of an inner node that is not full.
+ */
+static void
+innerInsertAt(J9BTreeInnerNode *inner, uintptr_t index, uintptr_t key, J9BTreeNode *rightChild)
+{
+	uintptr_t moved = inner->node.count - index;
+
+	memmove(&inner->node.keys[index + 1], &inner->node.keys[index], moved * sizeof(uintptr_t));
+	memmove(&inner->children[index + 2], &inner->children[index + 1], moved * sizeof(J9BTreeNode *));
+	inner->node.keys[index] = key;
+	inner->children[index + 1] = rightChild;
+	inner->node.count += 1;
+}
+
+/**
+ * Split a full leaf around a new range, which goes in at index. The upper
+ * half moves to right, a node fresh from newNode.
+ */
+static void
+splitLeaf(J9BTreeLeafNode *leaf, J9BTreeLeafNode *right, uintptr_t index, uintptr_t start, uintptr_t end, void *value)
+{
+	uintptr_t leftCount = (J9BTREE_NODE_KEYS + 1) / 2;
+	BOOLEAN insertLeft = (index < leftCount);
+	uintptr_t i = 0;
+
+	/* Leave the left half one short if the new range goes in it. */
+	if (insertLeft) {
+		leftCount -= 1;
+	}
+	for (i = leftCount; i < J9BTREE_NODE_KEYS; i++) {
+		right->node.keys[i - leftCount] = leaf->node.keys[i];
+		right->ends[i - leftCount] = leaf->ends[i];
+		right->values[i - leftCount] = leaf->values[i];
+		leaf->node.keys[i] = BTREE_UNUSED_KEY;
+	}
+	right->node.count = J9BTREE_NODE_KEYS - leftCount;
+	leaf->node.count = leftCount;
+
+	if (insertLeft) {
+		leafInsertAt(leaf, index, start, end, value);
+	} else {
+		leafInsertAt(right, index - leftCount, start, end, value);
+	}
+
+	right->next = leaf->next;
+	right->previous = leaf;
+	if (NULL != leaf->next) {
+		leaf->next->previous = right;
+	}
+	leaf->next = right;
+}
+
+/**
+ * Split a full inner node around a new key and right child, which go in at
+ * index. The upper half moves to right, a node fresh from newNode.
+ *
+ * @return the key that moves up to the parent
+ */
+static uintptr_t
+splitInner(J9BTreeInnerNode *inner, J9BTreeInnerNode *right, uintptr_t index, uintptr_t key, J9BTreeNode *rightChild)
+{
+	uintptr_t keys[J9BTREE_NODE_KEYS + 1];
+	J9BTreeNode *children[J9BTREE_NODE_KEYS + 2];
+	uintptr_t leftCount = (J9BTREE_NODE_KEYS + 1) / 2;
+	uintptr_t i = 0;
+
+	memcpy(keys, inner->node.keys, index * sizeof(uintptr_t));
+	keys[index] = key;
+	memcpy(&keys[index + 1], &inner->node.keys[index], (J9BTREE_NODE_KEYS - index) * sizeof(uintptr_t));
+	memcpy(children, inner->children, (index + 1) * sizeof(J9BTreeNode *));
+	children[index + 1] = rightChild;
+	memcpy(&children[index + 2], &inner->children[index + 1], (J9BTREE_NODE_KEYS - index) * sizeof(J9BTreeNode *));
+
+	/* keys[leftCount] moves up; the left half keeps the keys below it and the right half those above. */
+	for (i = 0; i < J9BTREE_NODE_KEYS; i++) {
+		inner->node.keys[i] = (i < leftCount) ? keys[i] : BTREE_UNUSED_KEY;
+	}
+	memcpy(inner->children, children, (leftCount + 1) * sizeof(J9BTreeNode *));
+	inner->node.count = leftCount;
+
+	for (i = leftCount + 1; i <= J9BTREE_NODE_KEYS; i++) {
+		right->node.keys[i - leftCount - 1] = keys[i];
+	}
+	memcpy(right->children, &children[leftCount + 1], (J9BTREE_NODE_KEYS + 1 - leftCount) * sizeof(J9BTreeNode *));
+	right->node.count = J9BTREE_NODE_KEYS - leftCount;
+
+	return keys[leftCount];
+}
+
+/**
+ * Insert a new range into a full leaf: split the leaf, and every full inner
+ * node above it, growing the tree if the root splits. All the nodes needed
+ * are allocated first, so a failed allocation leaves the tree untouched.
+ *
+ * @return FALSE if the nodes could not be allocated
+ */
+static BOOLEAN
+splitAndInsert(J9BTree *tree, J9BTreePath *path, J9BTreeLeafNode *leaf, uintptr_t index, uintptr_t start, uintptr_t end, void *value)
+{
+	J9BTreeNode *spares[BTREE_MAX_HEIGHT + 1];
+	uintptr_t needed = 1;
+	uintptr_t depth = path->depth;
+	uintptr_t i = 0;
+	J9BTreeNode *rightChild = NULL;
+	uintptr_t key = 0;
+
+	/* One node for the leaf, one per full ancestor and one for a new root if they are all full. */
+	while ((0 != depth) && (J9BTREE_NODE_KEYS == path->nodes[depth - 1]->node.count)) {
+		needed += 1;
+		depth -= 1;
+	}
+	if (0 == depth) {
+		needed += 1;
+	}
+	for (i = 0; i < needed; i++) {
+		spares[i] = newNode(tree);
+		if (NULL == spares[i]) {
+			while (0 != i) {
+				i -= 1;
+				pool_removeElement(tree->nodePool, spares[i]);
+			}
+			return FALSE;
+		}
+	}
+
+	splitLeaf(leaf, (J9BTreeLeafNode *)spares[0], index, start, end, value);
+	rightChild = spares[0];
+	key = rightChild->keys[0];
+	i = 1;
+
+	for (depth = path->depth; 0 != depth; depth--) {
+		J9BTreeInnerNode *inner = path->nodes[depth - 1];
+		uintptr_t childIndex = path->childIndexes[depth - 1];
+
+		if (inner->node.count < J9BTREE_NODE_KEYS) {
+			innerInsertAt(inner, childIndex, key, rightChild);
+			return TRUE;
+		}
+		key = splitInner(inner, (J9BTreeInnerNode *)spares[i], childIndex, key, rightChild);
+		rightChild = spares[i];
+		i += 1;
+	}
+
+	/* The root was split: grow the tree by one level. */
+	{
+		J9BTreeInnerNode *root = (J9BTreeInnerNode *)spares[i];
+		root->node.keys[0] = key;
+		root->node.count = 1;
+		root->children[0] = tree->root;
+		root->children[1] = rightChild;
+		tree->root = (J9BTreeNode *)root;
+		tree->height += 1;
+	}
+
+	return TRUE;
+}
+
+/**
+ * Remove the child at path->childIndexes[depth - 1] of path->nodes[depth - 1], and
+ * the ancestors that are left without children, then drop root levels with one child.
+ */
+static void
+removeFromParent(J9BTree *tree, J9BTreePath *path, uintptr_t depth)
+{
+	while (0 != depth) {
+		J9BTreeInnerNode *inner = path->nodes[depth - 1];
+		uintptr_t index = path->childIndexes[depth - 1];
+
+		if (0 != inner->node.count) {
+			/* The key below the removed child goes with it, or the one above for the first child. */
+			uintptr_t keyIndex = (0 == index) ? 0 : (index - 1);
+			uintptr_t count = inner->node.count;
+
+			memmove(&inner->node.keys[keyIndex], &inner->node.keys[keyIndex + 1], (count - keyIndex - 1) * sizeof(uintptr_t));
+			memmove(&inner->children[index], &inner->children[index + 1], (count - index) * sizeof(J9BTreeNode *));
+			inner->node.count = count - 1;
+			inner->node.keys[count - 1] = BTREE_UNUSED_KEY;
+			break;
+		}
+		/* That was the only child. */
+		pool_removeElement(tree->nodePool, inner);
+		depth -= 1;
+	}
+
+	if (0 == depth) {
+		/* Every inner node on the path has gone, so has the tree. */
+		tree->root = NULL;
+		tree->height = 0;
+	} else {
+		while ((tree->height > 1) && (0 == tree->root->count)) {
+			J9BTreeInnerNode *root = (J9BTreeInnerNode *)tree->root;
+			tree->root = root->children[0];
+			tree->height -= 1;
+			pool_removeElement(tree->nodePool, root);
+		}
+	}
+}
+
+/**
+ * Create an empty range B+-tree.
+ *
+ * @param[in] portLib  The port library
+ * @param[in] memoryCategory  The memory category of the nodes
+ *
+ * @return  The tree or NULL in the case of error
+ */
+J9BTree *
+btree_new(OMRPortLibrary *portLib, uint32_t memoryCategory)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9BTree *tree = omrmem_allocate_memory(sizeof(J9BTree), memoryCategory);
+
+	Trc_AVL_btree_new_Entry(portLib, memoryCategory);
+
+	if (NULL != tree) {
+		uintptr_t nodeSize = (sizeof(J9BTreeLeafNode) > sizeof(J9BTreeInnerNode)) ? sizeof(J9BTreeLeafNode) : sizeof(J9BTreeInnerNode);
+
+		memset(tree, 0, sizeof(J9BTree));
+		tree->portLibrary = portLib;
+		tree->memoryCategory = memoryCategory;
+		tree->nodePool = pool_new(nodeSize, 0, BTREE_NODE_ALIGNMENT, POOL_NO_ZERO, OMR_GET_CALLSITE(), memoryCategory, POOL_FOR_PORT(portLib));
+		if (NULL == tree->nodePool) {
+			omrmem_free_memory(tree);
+			tree = NULL;
+		}
+	}
+
+	Trc_AVL_btree_new_Exit(tree);
+
+	return tree;
+}
+
+/**
+ * Free a range B+-tree. The values stored in it are not touched.
+ *
+ * @param[in] tree  The tree
+ */
+void
+btree_free(J9BTree *tree)
+{
+	if (NULL != tree) {
+		OMRPORT_ACCESS_FROM_OMRPORT(tree->portLibrary);
+
+		pool_kill(tree->nodePool);
+		omrmem_free_memory(tree);
+	}
+}
+
+/**
+ * Insert the range [start, end) into a range B+-tree
+ *
+ * @param[in] tree  The tree
+ * @param[in] start  The first address of the range
+ * @param[in] end  The address following the range, which must be greater than start
+ * @param[in] value  The value to associate with the range, which must not be NULL
+ *
+ * @return  value if the range was inserted, the value of an existing range
+ * that overlaps it, or NULL in the case of error
+ */
+void *
+btree_insert(J9BTree *tree, uintptr_t start, uintptr_t end, void *value)
+{
+	J9BTreePath path;
+	J9BTreeLeafNode *leaf = NULL;
+	uintptr_t index = 0;
+
+	Trc_AVL_btree_insert_Entry(tree, start, end, value);
+
+	if ((start >= end) || (NULL == value)) {
+		Trc_AVL_btree_insert_Exit(NULL);
+		return NULL;
+	}
+
+	if (NULL == tree->root) {
+		tree->root = newNode(tree);
+		if (NULL == tree->root) {
+			Trc_AVL_btree_insert_Exit(NULL);
+			return NULL;
+		}
+		tree->height = 1;
+		((J9BTreeLeafNode *)tree->root)->previous = NULL;
+		((J9BTreeLeafNode *)tree->root)->next = NULL;
+	}
+
+	leaf = findLeaf(tree, start, &path);
+	index = nodeRank(&leaf->node, start);
+
+	/* Refuse ranges that overlap their neighbours. */
+	{
+		J9BTreeLeafNode *before = leaf;
+		uintptr_t beforeIndex = index;
+		J9BTreeLeafNode *after = leaf;
+		uintptr_t afterIndex = index;
+
+		if ((0 == beforeIndex) && (NULL != before->previous)) {
+			before = before->previous;
+			beforeIndex = before->node.count;
+		}
+		if ((0 != beforeIndex) && (before->ends[beforeIndex - 1] > start)) {
+			Trc_AVL_btree_insert_Exists(before->values[beforeIndex - 1]);
+			return before->values[beforeIndex - 1];
+		}
+		if ((afterIndex == after->node.count) && (NULL != after->next)) {
+			after = after->next;
+			afterIndex = 0;
+		}
+		if ((afterIndex < after->node.count) && (after->node.keys[afterIndex] < end)) {
+			Trc_AVL_btree_insert_Exists(after->values[afterIndex]);
+			return after->values[afterIndex];
+		}
+	}
+
+	if (leaf->node.count < J9BTREE_NODE_KEYS) {
+		leafInsertAt(leaf, index, start, end, value);
+	} else if (!splitAndInsert(tree, &path, leaf, index, start, end, value)) {
+		Trc_AVL_btree_insert_Exit(NULL);
+		return NULL;
+	}
+	tree->numberOfRanges += 1;
+
+	Trc_AVL_btree_insert_Exit(value);
+
+	return value;
+}
+
+/**
+ * Delete the range starting at start from a range B+-tree
+ *
+ * @param[in] tree  The tree
+ * @param[in] start  The first address of the range
+ *
+ * @return  The value of the deleted range, or NULL if there is no range starting at start
+ */
+void *
+btree_delete(J9BTree *tree, uintptr_t start)
+{
+	J9BTreePath path;
+	J9BTreeLeafNode *leaf = NULL;
+	uintptr_t index = 0;
+	void *value = NULL;
+
+	Trc_AVL_btree_delete_Entry(tree, start);
+
+	if (NULL != tree->root) {
+		leaf = findLeaf(tree, start, &path);
+		index = nodeRank(&leaf->node, start);
+		if ((0 != index) && (leaf->node.keys[index - 1] == start)) {
+			value = leaf->values[index - 1];
+			leafRemoveAt(leaf, index - 1);
+			tree->numberOfRanges -= 1;
+
+			if (0 == leaf->node.count) {
+				if (NULL != leaf->previous) {
+					leaf->previous->next = leaf->next;
+				}
+				if (NULL != leaf->next) {
+					leaf->next->previous = leaf->previous;
+				}
+				pool_removeElement(tree->nodePool, leaf);
+				removeFromParent(tree, &path, path.depth);
+			}
+		}
+	}
+
+	Trc_AVL_btree_delete_Exit(value);
+
+	return value;
+}
+
+/**
+ * Search a range B+-tree for the range starting at start
+ *
+ * @param[in] tree  The tree
+ * @param[in] start  The first address of the range
+ *
+ * @return  The value of the range or NULL
+ */
+void *
+btree_search(J9BTree *tree, uintptr_t start)
+{
+	if (NULL != tree->root) {
+		J9BTreeLeafNode *leaf = findLeaf(tree, start, NULL);
+		uintptr_t index = nodeRank(&leaf->node, start);
+
+		if ((0 != index) && (leaf->node.keys[index - 1] == start)) {
+			return leaf->values[index - 1];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Search a range B+-tree for the range containing address
+ *
+ * @param[in] tree  The tree
+ * @param[in] address  The address to look up
+ *
+ * @return  The value of the range with start <= address < end, or NULL
+ */
+void *
+btree_findRange(J9BTree *tree, uintptr_t address)
+{
+	if (NULL != tree->root) {
+		J9BTreeLeafNode *leaf = findLeaf(tree, address, NULL);
+		uintptr_t index = nodeRank(&leaf->node, address);
+
+		if ((0 == index) && (NULL != leaf->previous)) {
+			/* Separators are not updated on delete, so the preceding range may end the previous leaf. */
+			leaf = leaf->previous;
+			index = leaf->node.count;
+		}
+		if ((0 != index) && (address < leaf->ends[index - 1])) {
+			return leaf->values[index - 1];
+		}
+	}
+
+	return NULL;
+}
@@ -0,0 +1,708 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/*
+ * file    : concurrenthashtable.c
+ *
+ *  Hash table for read-mostly tables shared between threads
+ *
+ *  Lookups take no locks. Each reader announces itself by incrementing one of a few
+ *  counters for the current epoch, spread over cache lines by stack address. Updates
+ *  serialize on one of J9CONCURRENT_HASH_TABLE_LOCK_STRIPES locks picked by hash, and
+ *  publish new links with a write barrier. Unlinked links and entries are retired and
+ *  only freed once the epoch has been advanced twice and the counters of the previous
+ *  epochs have drained, so a reader never sees freed memory.
+ *
+ *  The bucket array grows incrementally. Once it is over full a larger array is hung off
+ *  the current one and every update moves a few buckets across, replacing the head of a
+ *  moved bucket with BUCKET_MOVED so that lookups continue in the larger array. The old
+ *  array is retired when its last bucket has moved.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_internal.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
+
+#define CONCURRENT_HASH_TABLE_SIZE_MIN J9CONCURRENT_HASH_TABLE_LOCK_STRIPES
+#define CONCURRENT_HASH_TABLE_SIZE_MAX ((uintptr_t)1 << 26)
+
+/* Head of a bucket whose chain has been moved to the next bucket array */
+#define BUCKET_MOVED ((J9ConcurrentHashTableLink *)(uintptr_t)1)
+
+/* Number of buckets moved to the next bucket array by each update */
+#define BUCKETS_MOVED_PER_UPDATE 32
+
+/* Retired links are freed in batches, as each batch waits for all current readers */
+#define RETIRED_LINKS_RECLAIM_THRESHOLD 64
+
+/* Bits of a stack address discarded before hashing, so that call depth does not change the reader shard */
+#define READER_SHARD_STACK_SHIFT 16
+
+#define STRIPE_LOCK(table, hash) ((table)->stripeLocks[(hash) & (J9CONCURRENT_HASH_TABLE_LOCK_STRIPES - 1)])
+
+#if defined(OMR_ENV_DATA64)
+#define HASH_MULTIPLIER ((uintptr_t)J9CONST_U64(0x9E3779B97F4A7C15))
+#define HASH_FOLD 32
+#else /* OMR_ENV_DATA64 */
+#define HASH_MULTIPLIER ((uintptr_t)0x9E3779B9)
+#define HASH_FOLD 16
+#endif /* OMR_ENV_DATA64 */
+
+static uintptr_t spreadHash(J9ConcurrentHashTable *table, void *entry);
+static J9ConcurrentHashTableBuckets *allocateBuckets(J9ConcurrentHashTable *table, uintptr_t size);
+static volatile uintptr_t *enterReader(J9ConcurrentHashTable *table);
+static void exitReader(volatile uintptr_t *readerCount);
+static void synchronizeReaders(J9ConcurrentHashTable *table);
+static J9ConcurrentHashTableLink *volatile *findBucket(J9ConcurrentHashTable *table, uintptr_t hash);
+static void retireLinks(J9ConcurrentHashTable *table, J9ConcurrentHashTableLink *first, J9ConcurrentHashTableLink *last, uintptr_t count, BOOLEAN freeEntries);
+static void reclaimRetiredLinks(J9ConcurrentHashTable *table, BOOLEAN force);
+static uintptr_t moveBucket(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, uintptr_t index);
+static BOOLEAN isResizeNeeded(J9ConcurrentHashTable *table);
+static void helpResize(J9ConcurrentHashTable *table);
+static void forEachDoInChain(J9ConcurrentHashTable *table, J9ConcurrentHashTableLink *volatile *where, J9HashTableDoFn doFn, void *opaque);
+static uintptr_t removeAllFn(void *entry, void *userData);
+
+/**
+ * \brief       Create a new concurrent hash table
+ * \ingroup     hash_table
+ *
+ *
+ * @param portLibrary       The port library
+ * @param tableName         A string giving the name of the table, recommended to use OMR_GET_CALLSITE()
+ * @param tableSize         Initial number of entries expected (if zero, use a suitable default)
+ * @param entrySize         Size of the user-data for each entry
+ * @param memoryCategory    memoryCategory for which memory allocated by hashtable should use
+ * @param hashFn            Mandatory hashing function ptr
+ * @param hashEqualFn       Mandatory hash compare function ptr
+ * @param userData          Optional userData ptr to be passed to hashFn and hashEqualFn
+ * @return                  An initialized hash table, or NULL on failure
+ *
+ *  Creates a hash table that may be used by several threads without any external locking.
+ *  concurrentHashTableFind() never blocks, and adds and removes of entries that hash to
+ *  different lock stripes proceed in parallel. The table grows a few buckets at a time
+ *  as it is updated, instead of rehashing every entry at once.
+ *
+ *  Entries are never moved, so a pointer returned by concurrentHashTableAdd() or
+ *  concurrentHashTableFind() stays valid until the entry is removed. hashFn and
+ *  hashEqualFn are called without any lock held and must not update the table.
+ *  The calling threads must be attached to the thread library.
+ */
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	void *functionUserData)
+{
+	J9ConcurrentHashTable *table = NULL;
+	uintptr_t size = CONCURRENT_HASH_TABLE_SIZE_MIN;
+	uintptr_t i = 0;
+
+	table = portLibrary->mem_allocate_memory(portLibrary, sizeof(J9ConcurrentHashTable), tableName, memoryCategory);
+	if (NULL == table) {
+		goto error;
+	}
+	memset(table, 0, sizeof(J9ConcurrentHashTable));
+	/* Set portLibrary and other fields now, so we can use concurrentHashTableFree() if errors occur */
+	table->portLibrary = portLibrary;
+	table->tableName = tableName;
+	table->entrySize = entrySize;
+	table->memoryCategory = memoryCategory;
+	table->hashFn = hashFn;
+	table->hashEqualFn = hashEqualFn;
+	table->functionUserData = functionUserData;
+
+	if (0 != omrthread_monitor_init_with_name(&table->resizeMutex, 0, tableName)) {
+		goto error;
+	}
+	if (0 != omrthread_monitor_init_with_name(&table->retireMutex, 0, tableName)) {
+		goto error;
+	}
+	if (0 != omrthread_monitor_init_with_name(&table->synchronizeMutex, 0, tableName)) {
+		goto error;
+	}
+	for (i = 0; i < J9CONCURRENT_HASH_TABLE_LOCK_STRIPES; i++) {
+		if (0 != omrthread_monitor_init_with_name(&table->stripeLocks[i], 0, tableName)) {
+			goto error;
+		}
+	}
+
+	while ((size < tableSize) && (size < CONCURRENT_HASH_TABLE_SIZE_MAX)) {
+		size *= 2;
+	}
+	table->buckets = allocateBuckets(table, size);
+	if (NULL == table->buckets) {
+		goto error;
+	}
+
+	return table;
+
+error:
+	concurrentHashTableFree(table);
+	return NULL;
+}
+
+/**
+ * \brief       Free a previously allocated concurrent hash table.
+ * \ingroup     hash_table
+ *
+ * @param table
+ *
+ *  Frees the table and all of its entries. No other thread may be using the table.
+ */
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table)
+{
+	if (NULL != table) {
+		OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+		uintptr_t i = 0;
+
+		if (NULL != table->buckets) {
+			concurrentHashTableForEachDo(table, removeAllFn, NULL);
+			reclaimRetiredLinks(table, TRUE);
+			if (NULL != table->buckets->next) {
+				omrmem_free_memory(table->buckets->next);
+			}
+			omrmem_free_memory(table->buckets);
+		}
+		for (i = 0; i < J9CONCURRENT_HASH_TABLE_LOCK_STRIPES; i++) {
+			if (NULL != table->stripeLocks[i]) {
+				omrthread_monitor_destroy(table->stripeLocks[i]);
+			}
+		}
+		if (NULL != table->synchronizeMutex) {
+			omrthread_monitor_destroy(table->synchronizeMutex);
+		}
+		if (NULL != table->retireMutex) {
+			omrthread_monitor_destroy(table->retireMutex);
+		}
+		if (NULL != table->resizeMutex) {
+			omrthread_monitor_destroy(table->resizeMutex);
+		}
+		omrmem_free_memory(table);
+	}
+}
+
+/**
+ * \brief       Find an entry in the concurrent hash table.
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @param entry
+ * @return                  NULL if entry is not present in the table; otherwise a pointer to the user-data
+ *
+ *  Does not take any lock.
+ */
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = spreadHash(table, entry);
+	volatile uintptr_t *readerCount = enterReader(table);
+	J9ConcurrentHashTableLink *link = *findBucket(table, hash);
+	void *result = NULL;
+
+	while (NULL != link) {
+		if ((hash == link->hash) && (0 != table->hashEqualFn(link->entry, entry, table->functionUserData))) {
+			result = link->entry;
+			break;
+		}
+		link = link->next;
+	}
+
+	exitReader(readerCount);
+	return result;
+}
+
+/**
+ * \brief       Add an entry to the concurrent hash table.
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @param entry
+ * @return                  NULL on failure (to allocate a new entry); otherwise the entry pointer
+ *
+ *  If the entry is already present in the table, returns a pointer to it.
+ *  Otherwise, returns a pointer to the newly added entry.
+ */
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	uintptr_t hash = spreadHash(table, entry);
+	omrthread_monitor_t lock = STRIPE_LOCK(table, hash);
+	volatile uintptr_t *readerCount = NULL;
+	J9ConcurrentHashTableLink *volatile *head = NULL;
+	J9ConcurrentHashTableLink *link = NULL;
+	BOOLEAN resize = FALSE;
+	void *result = NULL;
+
+	/* The bucket arrays are only guaranteed to stay allocated while announced as a reader */
+	readerCount = enterReader(table);
+	omrthread_monitor_enter(lock);
+
+	head = findBucket(table, hash);
+	for (link = *head; NULL != link; link = link->next) {
+		if ((hash == link->hash) && (0 != table->hashEqualFn(link->entry, entry, table->functionUserData))) {
+			result = link->entry;
+			break;
+		}
+	}
+
+	if (NULL == result) {
+		void *newEntry = omrmem_allocate_memory(table->entrySize, table->memoryCategory);
+		link = omrmem_allocate_memory(sizeof(J9ConcurrentHashTableLink), table->memoryCategory);
+		if ((NULL != newEntry) && (NULL != link)) {
+			memcpy(newEntry, entry, table->entrySize);
+			link->hash = hash;
+			link->entry = newEntry;
+			link->retiredNext = NULL;
+			link->next = *head;
+			/* Readers must see a complete link and entry before they can reach it */
+			issueWriteBarrier();
+			*head = link;
+			addAtomic(&table->numberOfEntries, 1);
+			result = newEntry;
+			resize = TRUE;
+		} else {
+			omrmem_free_memory(newEntry);
+			omrmem_free_memory(link);
+		}
+	}
+
+	omrthread_monitor_exit(lock);
+	if (resize) {
+		resize = isResizeNeeded(table);
+	}
+	exitReader(readerCount);
+
+	if (resize) {
+		helpResize(table);
+	}
+	return result;
+}
+
+/**
+ * \brief       Remove an entry matching given key from the concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param table         hash table
+ * @param entry         key of the entry to remove
+ * @return              0 on success, 1 on failure
+ *
+ *  The entry is freed once no thread can still be looking at it.
+ */
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = spreadHash(table, entry);
+	omrthread_monitor_t lock = STRIPE_LOCK(table, hash);
+	volatile uintptr_t *readerCount = NULL;
+	J9ConcurrentHashTableLink *volatile *where = NULL;
+	J9ConcurrentHashTableLink *removed = NULL;
+	BOOLEAN resize = FALSE;
+	uint32_t rc = 1;
+
+	readerCount = enterReader(table);
+	omrthread_monitor_enter(lock);
+
+	where = findBucket(table, hash);
+	while (NULL != *where) {
+		J9ConcurrentHashTableLink *link = *where;
+		if ((hash == link->hash) && (0 != table->hashEqualFn(link->entry, entry, table->functionUserData))) {
+			/* Leave link->next intact for readers still walking through the removed link */
+			*where = link->next;
+			subtractAtomic(&table->numberOfEntries, 1);
+			removed = link;
+			rc = 0;
+			break;
+		}
+		where = &link->next;
+	}
+
+	omrthread_monitor_exit(lock);
+	resize = isResizeNeeded(table);
+	exitReader(readerCount);
+
+	if (NULL != removed) {
+		removed->retiredNext = NULL;
+		retireLinks(table, removed, removed, 1, TRUE);
+		reclaimRetiredLinks(table, FALSE);
+	}
+	if (resize) {
+		helpResize(table);
+	}
+	return rc;
+}
+
+/**
+ * \brief       Call a user-defined function for all entries in the concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @param doFn           function to be called
+ * @param opaque        user data to be passed to doFn
+ *
+ *  If doFn returns TRUE the entry is removed from the table. Resizing is held off and each
+ *  lock stripe is held while its buckets are walked, so entries added or removed by other
+ *  threads during the walk may or may not be seen. doFn must not update the table.
+ */
+void
+concurrentHashTableForEachDo(J9ConcurrentHashTable *table, J9HashTableDoFn doFn, void *opaque)
+{
+	J9ConcurrentHashTableBuckets *buckets = NULL;
+	uintptr_t index = 0;
+
+	omrthread_monitor_enter(table->resizeMutex);
+	buckets = table->buckets;
+	for (index = 0; index < buckets->size; index++) {
+		omrthread_monitor_t lock = table->stripeLocks[index & (J9CONCURRENT_HASH_TABLE_LOCK_STRIPES - 1)];
+
+		/* The two buckets a bucket moves to use the same lock stripe as the bucket itself */
+		omrthread_monitor_enter(lock);
+		if (BUCKET_MOVED == buckets->heads[index]) {
+			forEachDoInChain(table, &buckets->next->heads[index], doFn, opaque);
+			forEachDoInChain(table, &buckets->next->heads[index + buckets->size], doFn, opaque);
+		} else {
+			forEachDoInChain(table, &buckets->heads[index], doFn, opaque);
+		}
+		omrthread_monitor_exit(lock);
+	}
+	omrthread_monitor_exit(table->resizeMutex);
+
+	reclaimRetiredLinks(table, FALSE);
+}
+
+/**
+ * \brief       Return the number of entries in a concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @return                  Number of table entries
+ */
+uintptr_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table)
+{
+	return table->numberOfEntries;
+}
+
+/* Spread the user hash so that the bucket and lock stripe depend on all of its bits */
+static uintptr_t
+spreadHash(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = table->hashFn(entry, table->functionUserData) * HASH_MULTIPLIER;
+	return hash ^ (hash >> HASH_FOLD);
+}
+
+static J9ConcurrentHashTableBuckets *
+allocateBuckets(J9ConcurrentHashTable *table, uintptr_t size)
+{
+	uintptr_t allocSize = sizeof(J9ConcurrentHashTableBuckets) + ((size - 1) * sizeof(J9ConcurrentHashTableLink *));
+	J9ConcurrentHashTableBuckets *buckets = table->portLibrary->mem_allocate_memory(table->portLibrary, allocSize, table->tableName, table->memoryCategory);
+
+	if (NULL != buckets) {
+		memset(buckets, 0, allocSize);
+		buckets->size = size;
+	}
+	return buckets;
+}
+
+/**
+ * Announce the calling thread as a reader for the current epoch and return the counter to pass to exitReader().
+ *
+ * Threads run on disjoint stacks, so the address of a local picks a counter shard without a
+ * thread-local lookup. The address is spread with a Fibonacci hash since thread stacks are
+ * usually allocated at a fixed stride.
+ */
+static volatile uintptr_t *
+enterReader(J9ConcurrentHashTable *table)
+{
+	uintptr_t stackMarker = 0;
+	uint32_t shard = ((uint32_t)(((uintptr_t)&stackMarker) >> READER_SHARD_STACK_SHIFT) * 0x9E3779B9U) >> (32 - J9CONCURRENT_HASH_TABLE_READER_SHARDS_LOG2);
+	volatile uintptr_t *readerCount = &table->readers[shard].count[table->epoch & 1];
+
+	addAtomic(readerCount, 1);
+	/* The count must be visible before any bucket or link is read */
+	issueReadWriteBarrier();
+	return readerCount;
+}
+
+static void
+exitReader(volatile uintptr_t *readerCount)
+{
+	issueReadWriteBarrier();
+	subtractAtomic(readerCount, 1);
+}
+
+/**
+ * Wait until every reader that was announced when this was called has exited.
+ *
+ * A reader may read the epoch just before it is advanced and only increment the counter
+ * of the old epoch afterwards, so the epoch is advanced and drained twice.
+ * Must not be called while announced as a reader.
+ */
+static void
+synchronizeReaders(J9ConcurrentHashTable *table)
+{
+	uintptr_t flip = 0;
+
+	omrthread_monitor_enter(table->synchronizeMutex);
+	for (flip = 0; flip < 2; flip++) {
+		uintptr_t parity = table->epoch & 1;
+		uintptr_t shard = 0;
+
+		table->epoch += 1;
+		issueReadWriteBarrier();
+		for (shard = 0; shard < J9CONCURRENT_HASH_TABLE_READER_SHARDS; shard++) {
+			while (0 != table->readers[shard].count[parity]) {
+				omrthread_yield();
+			}
+		}
+	}
+	issueReadWriteBarrier();
+	omrthread_monitor_exit(table->synchronizeMutex);
+}
+
+/* Returns the head of the chain for hash, following buckets that have moved to a larger array */
+static J9ConcurrentHashTableLink *volatile *
+findBucket(J9ConcurrentHashTable *table, uintptr_t hash)
+{
+	J9ConcurrentHashTableBuckets *buckets = table->buckets;
+	J9ConcurrentHashTableLink *volatile *head = &buckets->heads[hash & (buckets->size - 1)];
+
+	while (BUCKET_MOVED == *head) {
+		/* The moved chain was published in the next array before its old head was replaced */
+		issueReadBarrier();
+		buckets = buckets->next;
+		head = &buckets->heads[hash & (buckets->size - 1)];
+	}
+	return head;
+}
+
+/* Queue links chained through retiredNext to be freed, along with their entries if freeEntries is set */
+static void
+retireLinks(J9ConcurrentHashTable *table, J9ConcurrentHashTableLink *first, J9ConcurrentHashTableLink *last, uintptr_t count, BOOLEAN freeEntries)
+{
+	omrthread_monitor_enter(table->retireMutex);
+	if (freeEntries) {
+		last->retiredNext = table->retiredEntries;
+		table->retiredEntries = first;
+	} else {
+		last->retiredNext = table->retiredLinks;
+		table->retiredLinks = first;
+	}
+	table->numberOfRetiredLinks += count;
+	omrthread_monitor_exit(table->retireMutex);
+}
+
+/* Free the retired links once enough have been queued, or always if force is set. Must not be called while announced as a reader. */
+static void
+reclaimRetiredLinks(J9ConcurrentHashTable *table, BOOLEAN force)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	J9ConcurrentHashTableLink *links = NULL;
+	J9ConcurrentHashTableLink *entries = NULL;
+
+	if (!force && (table->numberOfRetiredLinks < RETIRED_LINKS_RECLAIM_THRESHOLD)) {
+		return;
+	}
+
+	omrthread_monitor_enter(table->retireMutex);
+	links = table->retiredLinks;
+	entries = table->retiredEntries;
+	table->retiredLinks = NULL;
+	table->retiredEntries = NULL;
+	table->numberOfRetiredLinks = 0;
+	omrthread_monitor_exit(table->retireMutex);
+
+	if ((NULL != links) || (NULL != entries)) {
+		/* Everything detached above was unreachable before this started */
+		synchronizeReaders(table);
+		while (NULL != links) {
+			J9ConcurrentHashTableLink *next = links->retiredNext;
+			omrmem_free_memory(links);
+			links = next;
+		}
+		while (NULL != entries) {
+			J9ConcurrentHashTableLink *next = entries->retiredNext;
+			omrmem_free_memory(entries->entry);
+			omrmem_free_memory(entries);
+			entries = next;
+		}
+	}
+}
+
+/**
+ * Move bucket index of buckets to the two buckets it splits into in buckets->next.
+ * The old chain is left intact for readers still walking it and retired.
+ * Returns 0 on success, 1 if memory for the new links could not be allocated.
+ */
+static uintptr_t
+moveBucket(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, uintptr_t index)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	J9ConcurrentHashTableBuckets *next = buckets->next;
+	omrthread_monitor_t lock = table->stripeLocks[index & (J9CONCURRENT_HASH_TABLE_LOCK_STRIPES - 1)];
+	J9ConcurrentHashTableLink *lower = NULL;
+	J9ConcurrentHashTableLink *upper = NULL;
+	J9ConcurrentHashTableLink *oldLinks = NULL;
+	J9ConcurrentHashTableLink *lastOldLink = NULL;
+	J9ConcurrentHashTableLink *link = NULL;
+	uintptr_t count = 0;
+	uintptr_t rc = 0;
+
+	omrthread_monitor_enter(lock);
+	oldLinks = buckets->heads[index];
+	for (link = oldLinks; NULL != link; link = link->next) {
+		J9ConcurrentHashTableLink *copy = omrmem_allocate_memory(sizeof(J9ConcurrentHashTableLink), table->memoryCategory);
+		if (NULL == copy) {
+			rc = 1;
+			break;
+		}
+		copy->hash = link->hash;
+		copy->entry = link->entry;
+		copy->retiredNext = NULL;
+		if (0 == (link->hash & buckets->size)) {
+			copy->next = lower;
+			lower = copy;
+		} else {
+			copy->next = upper;
+			upper = copy;
+		}
+		link->retiredNext = link->next;
+		lastOldLink = link;
+		count += 1;
+	}
+
+	if (0 == rc) {
+		next->heads[index] = lower;
+		next->heads[index + buckets->size] = upper;
+		issueWriteBarrier();
+		buckets->heads[index] = BUCKET_MOVED;
+	} else {
+		while (NULL != lower) {
+			link = lower->next;
+			omrmem_free_memory(lower);
+			lower = link;
+		}
+		while (NULL != upper) {
+			link = upper->next;
+			omrmem_free_memory(upper);
+			upper = link;
+		}
+	}
+	omrthread_monitor_exit(lock);
+
+	if ((0 == rc) && (NULL != oldLinks)) {
+		retireLinks(table, oldLinks, lastOldLink, count, FALSE);
+	}
+	return rc;
+}
+
+/**
+ * Check if the table should start growing, or is growing and could use help.
+ * Must be called while announced as a reader, since a resizing thread may free
+ * the bucket array as soon as no reader can see it.
+ */
+static BOOLEAN
+isResizeNeeded(J9ConcurrentHashTable *table)
+{
+	J9ConcurrentHashTableBuckets *buckets = table->buckets;
+
+	return (NULL != buckets->next) || (table->numberOfEntries > buckets->size);
+}
+
+/**
+ * Start growing the table once it holds more entries than buckets, and move a few buckets
+ * if it is growing. Only one thread resizes at a time; others carry on without waiting.
+ * Callers check isResizeNeeded() first.
+ * Must not be called while announced as a reader or holding a lock stripe.
+ */
+static void
+helpResize(J9ConcurrentHashTable *table)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	J9ConcurrentHashTableBuckets *buckets = NULL;
+
+	/* The bucket array is only freed by the thread holding resizeMutex, so it can be read while holding it */
+	if (0 != omrthread_monitor_try_enter(table->resizeMutex)) {
+		return;
+	}
+
+	buckets = table->buckets;
+	if ((NULL == buckets->next) && (table->numberOfEntries > buckets->size) && (buckets->size < CONCURRENT_HASH_TABLE_SIZE_MAX)) {
+		J9ConcurrentHashTableBuckets *next = allocateBuckets(table, buckets->size * 2);
+		if (NULL != next) {
+			issueWriteBarrier();
+			buckets->next = next;
+			table->moveIndex = 0;
+		}
+	}
+
+	if (NULL != buckets->next) {
+		uintptr_t end = table->moveIndex + BUCKETS_MOVED_PER_UPDATE;
+
+		if (end > buckets->size) {
+			end = buckets->size;
+		}
+		while ((table->moveIndex < end) && (0 == moveBucket(table, buckets, table->moveIndex))) {
+			table->moveIndex += 1;
+		}
+		if (table->moveIndex == buckets->size) {
+			/* Every bucket has moved, so the old array is only needed by threads that read it before this */
+			issueWriteBarrier();
+			table->buckets = buckets->next;
+			synchronizeReaders(table);
+			omrmem_free_memory(buckets);
+		}
+	}
+	omrthread_monitor_exit(table->resizeMutex);
+
+	reclaimRetiredLinks(table, FALSE);
+}
+
+static void
+forEachDoInChain(J9ConcurrentHashTable *table, J9ConcurrentHashTableLink *volatile *where, J9HashTableDoFn doFn, void *opaque)
+{
+	while (NULL != *where) {
+		J9ConcurrentHashTableLink *link = *where;
+		if (doFn(link->entry, opaque)) {
+			*where = link->next;
+			subtractAtomic(&table->numberOfEntries, 1);
+			link->retiredNext = NULL;
+			retireLinks(table, link, link, 1, TRUE);
+		} else {
+			where = &link->next;
+		}
+	}
+}
+
+static uintptr_t
+removeAllFn(void *entry, void *userData)
+{
+	return TRUE;
+}
@@ -37,6 +37,14 @@
 #include "omrutilbase.h"
 #include "omrutil.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define OPEN_ADDRESSING_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define OPEN_ADDRESSING_NEON
+#include <arm_neon.h>
+#endif
+
 #undef HASHTABLE_DEBUG
 #define HASHTABLE_ENABLE_ASSERTS
 
@@ -67,6 +75,29 @@
 #define AVL_TREE_TAG(p) ((J9AVLTree *)(((uintptr_t)(p)) | AVL_TREE_TAG_BIT))
 #define AVL_TREE_UNTAG(p) ((J9AVLTree *)(((uintptr_t)(p)) & (~AVL_TREE_TAG_BIT)))
 
+/**
+ * Open addressing macros. In J9HASH_TABLE_OPEN_ADDRESSING mode nodes holds tableSize entry pointers
+ * followed by tableSize control bytes. A control byte is EMPTY, DELETED, or the low 7 bits (h2) of the
+ * hash of the entry in that slot, so a group of control bytes can be compared against h2 at once.
+ */
+#define OPEN_ADDRESSING_GROUP_WIDTH 16
+#define OPEN_ADDRESSING_CTRL_EMPTY ((uint8_t)0x80)
+#define OPEN_ADDRESSING_CTRL_DELETED ((uint8_t)0xFE)
+#define OPEN_ADDRESSING_CTRL_IS_FULL(c) (0 == ((c) & 0x80))
+#define OPEN_ADDRESSING_SIZE_MIN 16
+#define OPEN_ADDRESSING_SIZE_MAX ((uint32_t)1 << 24)
+#define OPEN_ADDRESSING_CONTROL(table) ((uint8_t *)&(table)->nodes[(table)->tableSize])
+#define OPEN_ADDRESSING_LOAD_LIMIT(size) ((size) - ((size) >> 3))
+#define OPEN_ADDRESSING_H1(hash) ((hash) >> 7)
+#define OPEN_ADDRESSING_H2(hash) ((uint8_t)((hash) & 0x7F))
+#if defined(OMR_ENV_DATA64)
+#define OPEN_ADDRESSING_HASH_MULTIPLIER ((uintptr_t)J9CONST_U64(0x9E3779B97F4A7C15))
+#define OPEN_ADDRESSING_HASH_FOLD 32
+#else /* OMR_ENV_DATA64 */
+#define OPEN_ADDRESSING_HASH_MULTIPLIER ((uintptr_t)0x9E3779B9)
+#define OPEN_ADDRESSING_HASH_FOLD 16
+#endif /* OMR_ENV_DATA64 */
+
 /**
  * Stolen from gc_base/gcutils.h
  */
@@ -92,6 +123,18 @@ static void rebuildFromPools(J9HashTable *table, uint32_t newSize, void **newNod
 static uintptr_t hashTableGrowSpaceOpt(J9HashTable *, uint32_t newSize);
 static uintptr_t hashTableGrowListNodes(J9HashTable *table, uint32_t newSize);
 static uintptr_t collisionResilientHashTableGrow(J9HashTable *table, uint32_t newSize);
+static uint32_t openAddressingGroupMatch(const uint8_t *group, uint8_t value);
+static uint32_t openAddressingGroupMatchFree(const uint8_t *group);
+static uintptr_t openAddressingLowestBit(uint32_t mask);
+static uintptr_t openAddressingHash(J9HashTable *table, void *entry);
+static uintptr_t openAddressingFindIndex(J9HashTable *table, void *entry, uintptr_t hash);
+static uintptr_t openAddressingFindFreeIndex(J9HashTable *table, uintptr_t hash);
+static uintptr_t openAddressingNextFullIndex(J9HashTable *table, uintptr_t index);
+static void *openAddressingAdd(J9HashTable *table, void *entry);
+static void openAddressingRemoveIndex(J9HashTable *table, uintptr_t index);
+static uintptr_t openAddressingAllocateNodes(J9HashTable *table, uint32_t newSize);
+static uintptr_t openAddressingRebuild(J9HashTable *table, uint32_t newSize);
+static uintptr_t openAddressingGrow(J9HashTable *table);
 
 static const uint32_t primesTable[] = {
 	17,
@@ -180,7 +223,7 @@ comparatorToEqualFn(void *leftKey, void *rightKey, void *userData)
  *
  * In general, you should expect collisionResilientHashTable to be slower than a regular hashtable and use more memory.
  *
- *  J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION is not supported (will be ignored)
+ *  J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION and J9HASH_TABLE_OPEN_ADDRESSING are not supported (will be ignored)
  *
  */
 J9HashTable *
@@ -197,7 +240,7 @@ collisionResilientHashTableNew(
 	J9HashTablePrintFn printFn,
 	void *functionUserData)
 {
-	return hashTableNewImpl(portLibrary, tableName, tableSize, entrySize, sizeof(uintptr_t), flags | J9HASH_TABLE_COLLISION_RESILIENT, memoryCategory, listToTreeThreshold, hashFn, NULL, comparatorFn, printFn, functionUserData);
+	return hashTableNewImpl(portLibrary, tableName, tableSize, entrySize, sizeof(uintptr_t), (flags & ~J9HASH_TABLE_OPEN_ADDRESSING) | J9HASH_TABLE_COLLISION_RESILIENT, memoryCategory, listToTreeThreshold, hashFn, NULL, comparatorFn, printFn, functionUserData);
 }
 
 /**
@@ -235,6 +278,15 @@ collisionResilientHashTableNew(
  *  	hashTableRehash()
  *  	hashTableDoRemove()
  *
+ *  When J9HASH_TABLE_OPEN_ADDRESSING is set, collisions are resolved by probing a flat,
+ *  power of two sized slot array instead of chaining through the nodes. Each slot has a
+ *  control byte holding 7 bits of the hash, and a lookup compares a group of 16 control
+ *  bytes at once (using SSE2 or NEON where available) so that most mismatches never touch
+ *  the entries. Entries are still allocated from the backing pool, so pointers returned by
+ *  hashTableAdd() and hashTableFind() stay valid until the entry is removed. The table
+ *  grows once 7/8 of the slots are in use. J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION is ignored
+ *  in this mode and all functions are supported.
+ *
  */
 J9HashTable *
 hashTableNew(
@@ -291,8 +343,14 @@ hashTableNewImpl(
 	hashTable->listToTreeThreshold = listToTreeThreshold;
 	hashTable->hashFnUserData = functionUserData;
 
-	/* fixup tableSize to be the first prime >= to users choice */
-	if (tableSize <= HASH_TABLE_SIZE_MIN) {
+	if (J9HASH_TABLE_OPEN_ADDRESSING == (flags & J9HASH_TABLE_OPEN_ADDRESSING)) {
+		/* fixup tableSize to the first power of two that holds the users choice within the load limit */
+		uint32_t minimumSize = tableSize + (tableSize / 7);
+		hashTable->tableSize = OPEN_ADDRESSING_SIZE_MIN;
+		while ((hashTable->tableSize < minimumSize) && (hashTable->tableSize < OPEN_ADDRESSING_SIZE_MAX)) {
+			hashTable->tableSize *= 2;
+		}
+	} else if (tableSize <= HASH_TABLE_SIZE_MIN) {
 		hashTable->tableSize = HASH_TABLE_SIZE_MIN;
 	} else if (tableSize >= HASH_TABLE_SIZE_MAX) {
 		hashTable->tableSize = HASH_TABLE_SIZE_MAX;
@@ -301,8 +359,15 @@ hashTableNewImpl(
 	}
 
 	hashTable->entrySize = entrySize;
-	/* listNodeSize is sizeof user-data + a next-pointer */
-	if (entryAlignment) {
+	/* listNodeSize is sizeof user-data + a next-pointer, except in open addressing mode where nodes are never chained */
+	if (J9HASH_TABLE_OPEN_ADDRESSING == (flags & J9HASH_TABLE_OPEN_ADDRESSING)) {
+		if (entryAlignment) {
+			hashTable->listNodeSize = ((ROUND_TO_SIZEOF_UDATA(entrySize) + entryAlignment - 1) / entryAlignment) * entryAlignment;
+		} else {
+			hashTable->listNodeSize = ROUND_TO_SIZEOF_UDATA(entrySize);
+		}
+		hashTable->treeNodeSize = 0;
+	} else if (entryAlignment) {
 		hashTable->listNodeSize = (((ROUND_TO_SIZEOF_UDATA(entrySize) + sizeof(uintptr_t)) + entryAlignment - 1) / entryAlignment) * entryAlignment;
 		hashTable->treeNodeSize = (((ROUND_TO_SIZEOF_UDATA(entrySize) + sizeof(J9AVLTreeNode)) + entryAlignment - 1) / entryAlignment) * entryAlignment;
 	} else {
@@ -318,6 +383,7 @@ hashTableNewImpl(
 		&& (0 == (flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32))
 #endif /* OMR_ENV_DATA64 */
 		&& (!(J9HASH_TABLE_COLLISION_RESILIENT == (flags & J9HASH_TABLE_COLLISION_RESILIENT)))
+		&& (!(J9HASH_TABLE_OPEN_ADDRESSING == (flags & J9HASH_TABLE_OPEN_ADDRESSING)))
 	) {
 		/* create a hashTable with no backing pool */
 		spaceOpt = TRUE;
@@ -377,13 +443,19 @@ hashTableNewImpl(
 		hashTable->hashEqualFn = hashEqualFn;
 	}
 
-	hashTable->nodes = portLibrary->mem_allocate_memory(portLibrary, sizeof(uintptr_t) * hashTable->tableSize, tableName, memoryCategory);
-	if (NULL == hashTable->nodes) {
-		goto error;
-	}
+	if (hashTableIsOpenAddressing(hashTable)) {
+		if (0 != openAddressingAllocateNodes(hashTable, hashTable->tableSize)) {
+			goto error;
+		}
+	} else {
+		hashTable->nodes = portLibrary->mem_allocate_memory(portLibrary, sizeof(uintptr_t) * hashTable->tableSize, tableName, memoryCategory);
+		if (NULL == hashTable->nodes) {
+			goto error;
+		}
 
-	/* reset all the nodes */
-	memset(hashTable->nodes, 0, sizeof(uintptr_t) * hashTable->tableSize);
+		/* reset all the nodes */
+		memset(hashTable->nodes, 0, sizeof(uintptr_t) * hashTable->tableSize);
+	}
 
 	return hashTable;
 
@@ -441,22 +513,28 @@ hashTableFree(J9HashTable *hashTable)
 void *
 hashTableFind(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
 	void *findNode = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableFind <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
-	if (NULL == table->listNodePool) {
-		void **node = hashTableFindNodeSpaceOpt(table, entry, head);
-		findNode = (NULL != *node) ? node : NULL;
-	} else if (NULL == *head) {
-		findNode =  NULL;
-	} else if (AVL_TREE_TAGGED(*head)) {
-		findNode = hashTableFindNodeInTree(table, entry, head);
+	if (hashTableIsOpenAddressing(table)) {
+		uintptr_t index = openAddressingFindIndex(table, entry, openAddressingHash(table, entry));
+		findNode = (index < table->tableSize) ? table->nodes[index] : NULL;
 	} else {
-		findNode = *hashTableFindNodeInList(table, entry, head);
+		uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+		void **head = &table->nodes[hash];
+
+		if (NULL == table->listNodePool) {
+			void **node = hashTableFindNodeSpaceOpt(table, entry, head);
+			findNode = (NULL != *node) ? node : NULL;
+		} else if (NULL == *head) {
+			findNode =  NULL;
+		} else if (AVL_TREE_TAGGED(*head)) {
+			findNode = hashTableFindNodeInTree(table, entry, head);
+		} else {
+			findNode = *hashTableFindNodeInList(table, entry, head);
+		}
 	}
 	return findNode;
 }
@@ -516,14 +594,22 @@ hashTableFindNodeInTree(J9HashTable *table, void *entry, void **head)
 void *
 hashTableAdd(J9HashTable *table, void *entry)
 {
-	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
-	void **head = &table->nodes[hashCode % table->tableSize];
+	uintptr_t hashCode = 0;
+	void **head = NULL;
 	void *addNode = NULL;
 	BOOLEAN growFailure = FALSE;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableAdd <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		addNode = openAddressingAdd(table, entry);
+		goto done;
+	}
+
+	hashCode = table->hashFn(entry, table->hashFnUserData);
+	head = &table->nodes[hashCode % table->tableSize];
+
 	if ((table->numberOfNodes + 1) == table->tableSize) {
 		if (!hashTableCanGrow(table)) {
 			goto done;
@@ -702,21 +788,30 @@ listToTree(J9HashTable *table, void **head, uintptr_t listLength)
 uint32_t
 hashTableRemove(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
 	uint32_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableRemove <%s>: table=%p, entry=%p\n", table->tableName, table, entry);
 
-	if (NULL == table->listNodePool) {
-		rc = hashTableRemoveNodeSpaceOpt(table, entry, head);
-	} else if (NULL == *head) {
-		rc = 1;
-	} else if (AVL_TREE_TAGGED(*head)) {
-		rc = hashTableRemoveNodeInTree(table, entry, head);
+	if (hashTableIsOpenAddressing(table)) {
+		uintptr_t index = openAddressingFindIndex(table, entry, openAddressingHash(table, entry));
+		if (index < table->tableSize) {
+			openAddressingRemoveIndex(table, index);
+			rc = 0;
+		}
 	} else {
-		rc = hashTableRemoveNodeInList(table, entry, head);
+		uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+		void **head = &table->nodes[hash];
+
+		if (NULL == table->listNodePool) {
+			rc = hashTableRemoveNodeSpaceOpt(table, entry, head);
+		} else if (NULL == *head) {
+			rc = 1;
+		} else if (AVL_TREE_TAGGED(*head)) {
+			rc = hashTableRemoveNodeInTree(table, entry, head);
+		} else {
+			rc = hashTableRemoveNodeInList(table, entry, head);
+		}
 	}
 
 	return rc;
@@ -870,6 +965,12 @@ hashTableRehash(J9HashTable *table)
 		Assert_hashTable_unreachable();
 	}
 
+	if (hashTableIsOpenAddressing(table)) {
+		/* Rebuilding in place re-evaluates every hash and cannot fail */
+		openAddressingRebuild(table, table->tableSize);
+		return;
+	}
+
 	/* connect all the node-chains into one big chain */
 	for (i = 0; i < tableSize; i++) {
 		if (table->nodes[i]) {
@@ -1012,7 +1113,15 @@ hashTableStartDo(J9HashTable *table,  J9HashTableState *handle)
 	handle->didDeleteCurrentNode = FALSE;
 	handle->iterateState = J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		handle->bucketIndex = (uint32_t)openAddressingNextFullIndex(table, 0);
+		if (handle->bucketIndex < table->tableSize) {
+			handle->pointerToCurrentNode = &table->nodes[handle->bucketIndex];
+			result = *handle->pointerToCurrentNode;
+		} else {
+			handle->iterateState = J9HASH_TABLE_ITERATE_STATE_FINISHED;
+		}
+	} else if (NULL == table->listNodePool) {
 		/* find the first non-empty bucket */
 		while (handle->bucketIndex < table->tableSize) {
 			void **node = &table->nodes[handle->bucketIndex];
@@ -1071,7 +1180,19 @@ hashTableNextDo(J9HashTableState *handle)
 	void *result = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		/* advance to the next full slot, a removed current slot does not change where to continue from */
+		if (J9HASH_TABLE_ITERATE_STATE_FINISHED != handle->iterateState) {
+			handle->bucketIndex = (uint32_t)openAddressingNextFullIndex(table, (uintptr_t)handle->bucketIndex + 1);
+			handle->didDeleteCurrentNode = FALSE;
+			if (handle->bucketIndex < table->tableSize) {
+				handle->pointerToCurrentNode = &table->nodes[handle->bucketIndex];
+				result = *handle->pointerToCurrentNode;
+			} else {
+				handle->iterateState = J9HASH_TABLE_ITERATE_STATE_FINISHED;
+			}
+		}
+	} else if (NULL == table->listNodePool) {
 		/* space optimized hashTable - advance to the next bucket */
 		handle->bucketIndex += 1;
 		while (handle->bucketIndex < table->tableSize) {
@@ -1158,8 +1279,14 @@ hashTableDoRemove(J9HashTableState *handle)
 	uintptr_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	/* operation not supported on a space optimized hashTable */
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		if ((J9HASH_TABLE_ITERATE_STATE_FINISHED != handle->iterateState) && (FALSE == handle->didDeleteCurrentNode)) {
+			openAddressingRemoveIndex(table, handle->bucketIndex);
+			handle->didDeleteCurrentNode = TRUE;
+			rc = 0;
+		}
+	} else if (NULL == table->listNodePool) {
+		/* operation not supported on a space optimized hashTable */
 		Assert_hashTable_unreachable();
 	} else {
 		void *currentNode = NULL;
@@ -1322,6 +1449,279 @@ error:
 }
 
 
+/* Bit i of the result is set if control byte i of the group is value */
+static uint32_t
+openAddressingGroupMatch(const uint8_t *group, uint8_t value)
+{
+#if defined(OPEN_ADDRESSING_SSE2)
+	__m128i control = _mm_loadu_si128((const __m128i *)group);
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)value)));
+#elif defined(OPEN_ADDRESSING_NEON)
+	static const uint8_t bitWeights[OPEN_ADDRESSING_GROUP_WIDTH] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+	uint8x16_t matches = vandq_u8(vceqq_u8(vld1q_u8(group), vdupq_n_u8(value)), vld1q_u8(bitWeights));
+	return (uint32_t)vaddv_u8(vget_low_u8(matches)) | ((uint32_t)vaddv_u8(vget_high_u8(matches)) << 8);
+#else
+	uint32_t mask = 0;
+	uintptr_t i = 0;
+	for (i = 0; i < OPEN_ADDRESSING_GROUP_WIDTH; i++) {
+		if (value == group[i]) {
+			mask |= (uint32_t)1 << i;
+		}
+	}
+	return mask;
+#endif
+}
+
+/* Bit i of the result is set if control byte i of the group is EMPTY or DELETED */
+static uint32_t
+openAddressingGroupMatchFree(const uint8_t *group)
+{
+#if defined(OPEN_ADDRESSING_SSE2)
+	return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#elif defined(OPEN_ADDRESSING_NEON)
+	static const uint8_t bitWeights[OPEN_ADDRESSING_GROUP_WIDTH] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+	uint8x16_t matches = vandq_u8(vtstq_u8(vld1q_u8(group), vdupq_n_u8(0x80)), vld1q_u8(bitWeights));
+	return (uint32_t)vaddv_u8(vget_low_u8(matches)) | ((uint32_t)vaddv_u8(vget_high_u8(matches)) << 8);
+#else
+	uint32_t mask = 0;
+	uintptr_t i = 0;
+	for (i = 0; i < OPEN_ADDRESSING_GROUP_WIDTH; i++) {
+		if (!OPEN_ADDRESSING_CTRL_IS_FULL(group[i])) {
+			mask |= (uint32_t)1 << i;
+		}
+	}
+	return mask;
+#endif
+}
+
+static uintptr_t
+openAddressingLowestBit(uint32_t mask)
+{
+#if defined(__GNUC__)
+	return (uintptr_t)__builtin_ctz(mask);
+#else
+	uintptr_t bit = 0;
+	while (0 == (mask & 1)) {
+		mask >>= 1;
+		bit += 1;
+	}
+	return bit;
+#endif
+}
+
+/* Spread the user hash so that both h1 and h2 depend on all of its bits */
+static uintptr_t
+openAddressingHash(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) * OPEN_ADDRESSING_HASH_MULTIPLIER;
+	return hash ^ (hash >> OPEN_ADDRESSING_HASH_FOLD);
+}
+
+/*
+ * Groups are probed quadratically (group, group + 1, group + 3, ...), which visits every group
+ * of a power of two sized table once. A probe sequence ends at the first group with an EMPTY slot.
+ * Returns the slot index of the entry, or tableSize if it is not in the table.
+ */
+static uintptr_t
+openAddressingFindIndex(J9HashTable *table, void *entry, uintptr_t hash)
+{
+	uint8_t *control = OPEN_ADDRESSING_CONTROL(table);
+	uintptr_t groupMask = (table->tableSize / OPEN_ADDRESSING_GROUP_WIDTH) - 1;
+	uintptr_t group = OPEN_ADDRESSING_H1(hash) & groupMask;
+	uint8_t h2 = OPEN_ADDRESSING_H2(hash);
+	uintptr_t probe = 0;
+
+#if defined(__GNUC__)
+	/* Most lookups end in the first group, so overlap fetching its slots with the control byte compare */
+	__builtin_prefetch(&table->nodes[group * OPEN_ADDRESSING_GROUP_WIDTH]);
+#endif /* defined(__GNUC__) */
+	for (probe = 0; probe <= groupMask; probe++) {
+		uint8_t *groupControl = &control[group * OPEN_ADDRESSING_GROUP_WIDTH];
+		uint32_t matches = openAddressingGroupMatch(groupControl, h2);
+
+		while (0 != matches) {
+			uintptr_t index = (group * OPEN_ADDRESSING_GROUP_WIDTH) + openAddressingLowestBit(matches);
+			if (0 != table->hashEqualFn(table->nodes[index], entry, table->equalFnUserData)) {
+				return index;
+			}
+			matches &= matches - 1;
+		}
+		if (0 != openAddressingGroupMatch(groupControl, OPEN_ADDRESSING_CTRL_EMPTY)) {
+			break;
+		}
+		group = (group + probe + 1) & groupMask;
+	}
+	return table->tableSize;
+}
+
+/* Returns the first EMPTY or DELETED slot on the probe sequence for hash, or tableSize if there is none */
+static uintptr_t
+openAddressingFindFreeIndex(J9HashTable *table, uintptr_t hash)
+{
+	uint8_t *control = OPEN_ADDRESSING_CONTROL(table);
+	uintptr_t groupMask = (table->tableSize / OPEN_ADDRESSING_GROUP_WIDTH) - 1;
+	uintptr_t group = OPEN_ADDRESSING_H1(hash) & groupMask;
+	uintptr_t probe = 0;
+
+	for (probe = 0; probe <= groupMask; probe++) {
+		uint32_t freeSlots = openAddressingGroupMatchFree(&control[group * OPEN_ADDRESSING_GROUP_WIDTH]);
+		if (0 != freeSlots) {
+			return (group * OPEN_ADDRESSING_GROUP_WIDTH) + openAddressingLowestBit(freeSlots);
+		}
+		group = (group + probe + 1) & groupMask;
+	}
+	return table->tableSize;
+}
+
+/* Returns the first full slot at or after index, or tableSize if there is none */
+static uintptr_t
+openAddressingNextFullIndex(J9HashTable *table, uintptr_t index)
+{
+	uint8_t *control = OPEN_ADDRESSING_CONTROL(table);
+
+	while ((index < table->tableSize) && !OPEN_ADDRESSING_CTRL_IS_FULL(control[index])) {
+		index += 1;
+	}
+	return index;
+}
+
+static void *
+openAddressingAdd(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = openAddressingHash(table, entry);
+	uintptr_t index = openAddressingFindIndex(table, entry, hash);
+	void *newNode = NULL;
+
+	if (index < table->tableSize) {
+		/* found the entry in the table */
+		newNode = table->nodes[index];
+	} else {
+		if ((table->numberOfNodes + table->numberOfDeletedSlots) >= OPEN_ADDRESSING_LOAD_LIMIT(table->tableSize)) {
+			if (!hashTableCanGrow(table)) {
+				goto done;
+			}
+			/* Failing to grow is okay as long as there is still a free slot on the probe sequence */
+			if (0 != hashTableCanRehash(table)) {
+				openAddressingGrow(table);
+			}
+		}
+
+		index = openAddressingFindFreeIndex(table, hash);
+		if (index < table->tableSize) {
+			newNode = pool_newElement(table->listNodePool);
+			if (NULL != newNode) {
+				uint8_t *control = OPEN_ADDRESSING_CONTROL(table);
+
+				memcpy(newNode, entry, table->entrySize);
+				table->nodes[index] = newNode;
+				if (!hashTableCanGrow(table)) {
+					/* Concurrent readers must see the entry pointer before the control byte that publishes it */
+					issueWriteBarrier();
+				}
+				if (OPEN_ADDRESSING_CTRL_DELETED == control[index]) {
+					table->numberOfDeletedSlots -= 1;
+				}
+				control[index] = OPEN_ADDRESSING_H2(hash);
+				table->numberOfNodes += 1;
+			}
+		}
+	}
+done:
+	return newNode;
+}
+
+static void
+openAddressingRemoveIndex(J9HashTable *table, uintptr_t index)
+{
+	uint8_t *control = OPEN_ADDRESSING_CONTROL(table);
+	uint8_t *groupControl = &control[index & ~(uintptr_t)(OPEN_ADDRESSING_GROUP_WIDTH - 1)];
+
+	HASHTABLE_ASSERT(OPEN_ADDRESSING_CTRL_IS_FULL(control[index]));
+	pool_removeElement(table->listNodePool, table->nodes[index]);
+	table->nodes[index] = NULL;
+
+	/* Probe sequences already stop at a group with an EMPTY slot, so the slot can only be reused as EMPTY in that case */
+	if (0 != openAddressingGroupMatch(groupControl, OPEN_ADDRESSING_CTRL_EMPTY)) {
+		control[index] = OPEN_ADDRESSING_CTRL_EMPTY;
+	} else {
+		control[index] = OPEN_ADDRESSING_CTRL_DELETED;
+		table->numberOfDeletedSlots += 1;
+	}
+	table->numberOfNodes -= 1;
+}
+
+/* Allocate newSize slots and control bytes, all EMPTY, and install them in the table */
+static uintptr_t
+openAddressingAllocateNodes(J9HashTable *table, uint32_t newSize)
+{
+	uintptr_t rc = 1;
+	void **newNodes = table->portLibrary->mem_allocate_memory(table->portLibrary, (sizeof(uintptr_t) + 1) * newSize, table->tableName, table->memoryCategory);
+
+	if (NULL != newNodes) {
+		memset(newNodes, 0, sizeof(uintptr_t) * newSize);
+		memset(&newNodes[newSize], OPEN_ADDRESSING_CTRL_EMPTY, newSize);
+		table->nodes = newNodes;
+		table->tableSize = newSize;
+		table->numberOfDeletedSlots = 0;
+		rc = 0;
+	}
+	return rc;
+}
+
+/*
+ * Re-insert every entry from the pool into newSize slots. Entries are not moved, only their slots.
+ * Rebuilding at the current size is done in place and cannot fail.
+ */
+static uintptr_t
+openAddressingRebuild(J9HashTable *table, uint32_t newSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	void **oldNodes = table->nodes;
+	uint32_t numberOfNodes = 0;
+	pool_state state = {0};
+	void *node = NULL;
+
+	if (newSize == table->tableSize) {
+		memset(oldNodes, 0, sizeof(uintptr_t) * newSize);
+		memset(OPEN_ADDRESSING_CONTROL(table), OPEN_ADDRESSING_CTRL_EMPTY, newSize);
+		table->numberOfDeletedSlots = 0;
+	} else if (0 == openAddressingAllocateNodes(table, newSize)) {
+		omrmem_free_memory(oldNodes);
+	} else {
+		return 1;
+	}
+
+	node = pool_startDo(table->listNodePool, &state);
+	while (NULL != node) {
+		uintptr_t hash = openAddressingHash(table, node);
+		uintptr_t index = openAddressingFindFreeIndex(table, hash);
+
+		/* The table is below its load limit, so there is always a free slot */
+		HASHTABLE_ASSERT(index < table->tableSize);
+		table->nodes[index] = node;
+		OPEN_ADDRESSING_CONTROL(table)[index] = OPEN_ADDRESSING_H2(hash);
+		numberOfNodes += 1;
+		node = pool_nextDo(&state);
+	}
+	/* Sanity check to make sure that the table had counted the right number of nodes */
+	HASHTABLE_ASSERT(numberOfNodes == table->numberOfNodes);
+	return 0;
+}
+
+/* Double the table, or only clear out DELETED slots if they make up most of the load */
+static uintptr_t
+openAddressingGrow(J9HashTable *table)
+{
+	uint32_t newSize = table->tableSize;
+
+	if ((table->numberOfNodes >= (OPEN_ADDRESSING_LOAD_LIMIT(newSize) / 2)) && (newSize < OPEN_ADDRESSING_SIZE_MAX)) {
+		newSize *= 2;
+	} else if (0 == table->numberOfDeletedSlots) {
+		return 1;
+	}
+	return openAddressingRebuild(table, newSize);
+}
+
 static uintptr_t
 hashTableGrow(J9HashTable *table)
 {
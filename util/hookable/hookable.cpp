@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
  *******************************************************************************/
 
+#include <stddef.h>
 #include <string.h>
 #include <stdarg.h>
 #include "pool_api.h"
@@ -27,6 +28,7 @@
 #include "omrhookable.h"
 #include "omrmemcategories.h"
 #include "omrutil.h"
+#include "omrutilbase.h"
 #include "AtomicSupport.hpp"
 #include "ut_j9hook.h"
 #include "omrtrace.h"
@@ -43,6 +45,9 @@ static void J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t tag
 static intptr_t J9HookReserve(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum);
 static uintptr_t J9HookAllocateAgentID(struct J9HookInterface **hookInterface);
 static void J9HookDeallocateAgentID(struct J9HookInterface **hookInterface, uintptr_t agentID);
+static bool publishListeners(J9CommonHookInterface *commonInterface, uintptr_t eventNum);
+static void calibrateTimebase(J9CommonHookInterface *commonInterface);
+static void recordHookTime(J9CommonHookInterface *commonInterface, OMREventInfo4Dump *eventDump, J9HookFunction function, const char *callsite, bool cycleTiming, uint64_t start);
 
 static const J9HookInterface hookFunctionTable = {
 	J9HookDispatch,
@@ -63,6 +68,15 @@ static const J9HookInterface hookFunctionTable = {
 /* records are stored at the END of the interface in descending order */
 #define HOOK_RECORD(interface, event) (((J9HookRecord**)( (uint8_t*)(interface) + (interface)->size ))[ -1 - (event)])
 
+/* listener arrays live outside the interface, so that the layout generated for each hook interface is unchanged */
+#define HOOK_LISTENERS(interface, event) ((interface)->listeners[event])
+
+/* the mode flags accepted by J9HookSetDispatchMode */
+#define HOOK_DISPATCH_MODE_FLAGS (J9HOOK_FLAG_FLATTENED | J9HOOK_FLAG_CYCLE_TIMING)
+
+/* how long the time base is compared against the nanosecond clock to find its frequency */
+#define HOOK_TIMEBASE_CALIBRATION_NANOS ((int64_t)1000000)
+
 /* e.g.
  0: J9CommonInterface::interface
  4: J9CommonInterface::size
@@ -164,6 +178,244 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
 	if (commonInterface->pool) {
 		pool_kill(commonInterface->pool);
 	}
+
+	if (NULL != commonInterface->listeners) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		J9HookListeners *retired = commonInterface->retiredListeners;
+		uintptr_t eventNum = 0;
+
+		while (NULL != retired) {
+			J9HookListeners *next = retired->retiredNext;
+			omrmem_free_memory(retired);
+			retired = next;
+		}
+		for (eventNum = 0; eventNum < commonInterface->eventSize; eventNum++) {
+			omrmem_free_memory(HOOK_LISTENERS(commonInterface, eventNum));
+		}
+		omrmem_free_memory(commonInterface->listeners);
+		commonInterface->listeners = NULL;
+		commonInterface->retiredListeners = NULL;
+	}
+}
+
+/*
+ * Select how the listeners of an event are dispatched. modeFlags is a combination of:
+ *
+ * J9HOOK_FLAG_FLATTENED: the valid records of the event are copied into an immutable array
+ * whenever a listener is registered or unregistered, and J9HookDispatch calls the listeners
+ * from the array without checking each record. A listener removed while the event is being
+ * dispatched may still be called from the array read before it was removed, so arrays which
+ * have been replaced are only freed when the interface is shut down. Use this for events which
+ * are reported often and whose listeners rarely change.
+ *
+ * J9HOOK_FLAG_CYCLE_TIMING: sampled listeners are timed with the processor time base instead
+ * of the wall clock. The durations and start times in the dump info are still in milliseconds.
+ * The flag is ignored if the platform has no usable time base.
+ *
+ * Mode flags which are not passed are cleared. This function may be called directly.
+ *
+ * Returns 0 on success, or J9HOOK_ERR_NOMEM if the listener array could not be allocated
+ */
+intptr_t
+J9HookSetDispatchMode(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, uintptr_t modeFlags)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
+	intptr_t rc = 0;
+
+	if ((0 != (modeFlags & J9HOOK_FLAG_CYCLE_TIMING)) && (0 == commonInterface->timebaseTicksPerMilli)) {
+		/* calibrate outside the lock, as it takes a millisecond */
+		calibrateTimebase(commonInterface);
+	}
+
+	omrthread_monitor_enter(commonInterface->lock);
+
+	if ((0 != (modeFlags & J9HOOK_FLAG_FLATTENED)) && (NULL == commonInterface->listeners)) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		uintptr_t tableSize = commonInterface->eventSize * sizeof(J9HookListeners *);
+
+		commonInterface->listeners = (J9HookListeners **)omrmem_allocate_memory(tableSize, OMRMEM_CATEGORY_VM);
+		if (NULL == commonInterface->listeners) {
+			rc = J9HOOK_ERR_NOMEM;
+		} else {
+			memset(commonInterface->listeners, 0, tableSize);
+		}
+	}
+
+	if (0 == rc) {
+		uint8_t flags = HOOK_FLAGS(commonInterface, eventNum) & ~HOOK_DISPATCH_MODE_FLAGS;
+
+		if (0 != (modeFlags & J9HOOK_FLAG_FLATTENED)) {
+			if (publishListeners(commonInterface, eventNum)) {
+				flags |= J9HOOK_FLAG_FLATTENED;
+			} else {
+				rc = J9HOOK_ERR_NOMEM;
+			}
+		}
+		if ((0 != (modeFlags & J9HOOK_FLAG_CYCLE_TIMING)) && (0 != commonInterface->timebaseTicksPerMilli)) {
+			flags |= J9HOOK_FLAG_CYCLE_TIMING;
+		}
+
+		/* the listener array must be visible before the flag which tells dispatchers to use it */
+		VM_AtomicSupport::writeBarrier();
+		HOOK_FLAGS(commonInterface, eventNum) = flags;
+	}
+
+	omrthread_monitor_exit(commonInterface->lock);
+
+	return rc;
+}
+
+/*
+ * Copy the valid records of an event into a new listener array, publish it, and retire the
+ * array it replaces. An event without listeners has no array. The caller must hold the lock.
+ *
+ * Returns false, leaving the published array unchanged, if the array could not be allocated.
+ */
+static bool
+publishListeners(J9CommonHookInterface *commonInterface, uintptr_t eventNum)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	J9HookListeners *listeners = NULL;
+	J9HookListeners *old = HOOK_LISTENERS(commonInterface, eventNum);
+	J9HookRecord *record = NULL;
+	uintptr_t count = 0;
+
+	for (record = HOOK_RECORD(commonInterface, eventNum); NULL != record; record = record->next) {
+		if (HOOK_IS_VALID_ID(record->id)) {
+			count += 1;
+		}
+	}
+
+	if (0 != count) {
+		uintptr_t size = offsetof(J9HookListeners, listeners) + (count * sizeof(J9HookListener));
+
+		listeners = (J9HookListeners *)omrmem_allocate_memory(size, OMRMEM_CATEGORY_VM);
+		if (NULL == listeners) {
+			return false;
+		}
+		listeners->retiredNext = NULL;
+		listeners->count = 0;
+		for (record = HOOK_RECORD(commonInterface, eventNum); NULL != record; record = record->next) {
+			if (HOOK_IS_VALID_ID(record->id)) {
+				J9HookListener *listener = &listeners->listeners[listeners->count];
+				listener->function = record->function;
+				listener->userData = record->userData;
+				listener->callsite = record->callsite;
+				listeners->count += 1;
+			}
+		}
+	}
+
+	VM_AtomicSupport::writeBarrier();
+	HOOK_LISTENERS(commonInterface, eventNum) = listeners;
+
+	if (NULL != old) {
+		/* dispatchers may still be calling listeners from the old array */
+		old->retiredNext = commonInterface->retiredListeners;
+		commonInterface->retiredListeners = old;
+	}
+
+	return true;
+}
+
+/*
+ * Find how many time base ticks there are in a millisecond by reading the time base across
+ * HOOK_TIMEBASE_CALIBRATION_NANOS of the nanosecond clock, and note the time base and wall
+ * clock at that point so that later time base readings can be converted to wall clock times.
+ * timebaseTicksPerMilli is left 0 if the time base does not advance.
+ */
+static void
+calibrateTimebase(J9CommonHookInterface *commonInterface)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	uint64_t startMillis = (uint64_t)omrtime_current_time_millis();
+	uint64_t startTicks = getTimebase();
+	int64_t startNanos = omrtime_nano_time();
+	int64_t elapsedNanos = 0;
+	uint64_t elapsedTicks = 0;
+
+	do {
+		elapsedNanos = omrtime_nano_time() - startNanos;
+	} while (elapsedNanos < HOOK_TIMEBASE_CALIBRATION_NANOS);
+	elapsedTicks = getTimebase() - startTicks;
+
+	omrthread_monitor_enter(commonInterface->lock);
+	commonInterface->timebaseStart = startTicks;
+	commonInterface->timebaseStartMillis = startMillis;
+	commonInterface->timebaseTicksPerMilli = (elapsedTicks * 1000000) / (uint64_t)elapsedNanos;
+	omrthread_monitor_exit(commonInterface->lock);
+}
+
+/*
+ * Read the clock used to time a sampled listener: the time base if cycleTiming is set,
+ * or the wall clock in milliseconds otherwise.
+ */
+static VMINLINE uint64_t
+hookStartTime(J9CommonHookInterface *commonInterface, bool cycleTiming)
+{
+	uint64_t start = 0;
+
+	if (cycleTiming) {
+		start = getTimebase();
+	} else {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		start = omrtime_current_time_millis();
+	}
+
+	return start;
+}
+
+/*
+ * Record the time taken by a sampled listener, which started at start as read by
+ * hookStartTime(), in the dump info of its event, and trace it if it took longer than
+ * the threshold.
+ */
+static void
+recordHookTime(J9CommonHookInterface *commonInterface, OMREventInfo4Dump *eventDump, J9HookFunction function, const char *callsite, bool cycleTiming, uint64_t start)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	uint64_t startTime = start;
+	uint64_t timeDelta = 0;
+
+	if (cycleTiming) {
+		uint64_t ticksPerMilli = 0;
+
+		/* the calibration is written before J9HOOK_FLAG_CYCLE_TIMING is set */
+		VM_AtomicSupport::readBarrier();
+		ticksPerMilli = commonInterface->timebaseTicksPerMilli;
+
+		timeDelta = (getTimebase() - start) / ticksPerMilli;
+		startTime = commonInterface->timebaseStartMillis;
+		if (start > commonInterface->timebaseStart) {
+			startTime += (start - commonInterface->timebaseStart) / ticksPerMilli;
+		}
+	} else {
+		timeDelta = omrtime_current_time_millis() - start;
+	}
+
+	eventDump->lastHook.startTime = startTime;
+	eventDump->lastHook.callsite = callsite;
+	eventDump->lastHook.func_ptr = (void *)function;
+	eventDump->lastHook.duration = timeDelta;
+
+	if ((eventDump->longestHook.duration < timeDelta) ||
+		(0 == eventDump->longestHook.startTime)) {
+			eventDump->longestHook.startTime = startTime;
+			eventDump->longestHook.callsite = callsite;
+			eventDump->longestHook.func_ptr = (void *)function;
+			eventDump->longestHook.duration = timeDelta;
+	}
+
+	if (commonInterface->threshold4Trace <= timeDelta) {
+		char buffer[32];
+		if (NULL == callsite) {
+			/* if the callsite info can not be retrieved, use callback function pointer instead  */
+			omrstr_printf(buffer, sizeof(buffer), "0x%p", function);
+			callsite = buffer;
+		}
+		Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
+	}
 }
 
 
@@ -187,6 +439,8 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
 	uintptr_t samplingInterval = (taggedEventNum & J9HOOK_TAG_SAMPLING_MASK) >> 16;
 	bool sampling = false;
+	bool cycleTiming = false;
+	uint8_t flags = 0;
 
 	if (taggedEventNum & J9HOOK_TAG_ONCE) {
 		uint8_t oldFlags;
@@ -203,6 +457,44 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 		}
 	}
 
+	flags = HOOK_FLAGS(commonInterface, eventNum);
+	cycleTiming = (0 != (flags & J9HOOK_FLAG_CYCLE_TIMING));
+
+	if (0 != (flags & J9HOOK_FLAG_FLATTENED)) {
+		J9HookListeners *listeners = NULL;
+
+		/* the array is published before the flag is set, and never changes once published */
+		VM_AtomicSupport::readBarrier();
+		listeners = HOOK_LISTENERS(commonInterface, eventNum);
+		if (NULL != listeners) {
+			uintptr_t listenerCount = listeners->count;
+			uintptr_t count = 0;
+			uintptr_t i = 0;
+
+			VM_AtomicSupport::readBarrier();
+			if (NULL != eventDump) {
+				/* count all of the listeners at once, rather than with an atomic add for each of them */
+				count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, listenerCount) - listenerCount;
+			}
+
+			for (i = 0; i < listenerCount; i++) {
+				J9HookListener *listener = &listeners->listeners[i];
+
+				count += 1;
+				sampling = (NULL != eventDump)
+					&& ((1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval))));
+				if (sampling) {
+					uint64_t start = hookStartTime(commonInterface, cycleTiming);
+					listener->function(hookInterface, eventNum, eventData, listener->userData);
+					recordHookTime(commonInterface, eventDump, listener->function, listener->callsite, cycleTiming, start);
+				} else {
+					listener->function(hookInterface, eventNum, eventData, listener->userData);
+				}
+			}
+		}
+		return;
+	}
+
 	while (record) {
 		J9HookFunction function;
 		void *userData;
@@ -227,41 +519,14 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 				} else {
 					sampling =  false;
 				}
-				OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
 				if (sampling) {
-					startTime = omrtime_current_time_millis();
+					startTime = hookStartTime(commonInterface, cycleTiming);
 				}
 
 				function(hookInterface, eventNum, eventData, userData);
 
 				if (sampling) {
-					uint64_t timeDelta = omrtime_current_time_millis() - startTime;
-
-					eventDump->lastHook.startTime = startTime;
-					eventDump->lastHook.callsite = record->callsite;
-					eventDump->lastHook.func_ptr = (void *)record->function;
-					eventDump->lastHook.duration = timeDelta;
-
-					if ((eventDump->longestHook.duration < timeDelta) ||
-						(0 == eventDump->longestHook.startTime)) {
-							eventDump->longestHook.startTime = startTime;
-							eventDump->longestHook.callsite = record->callsite;
-							eventDump->longestHook.func_ptr = (void *)record->function;
-							eventDump->longestHook.duration = timeDelta;
-					}
-
-					if (commonInterface->threshold4Trace <= timeDelta) {
-						const char *callsite = "UNKNOWN";
-						char buffer[32];
-						if (NULL != record->callsite) {
-							callsite = record->callsite;
-						} else {
-							/* if the callsite info can not be retrieved, use callback function pointer instead  */
-							omrstr_printf(buffer, sizeof(buffer), "0x%p", record->function);
-							callsite = buffer;
-						}
-						Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
-					}
+					recordHookTime(commonInterface, eventDump, record->function, record->callsite, cycleTiming, startTime);
 				}
 			} else {
 				/* this record has been updated while we were reading it. Skip it. */
@@ -428,6 +693,13 @@ J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintpt
 				HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
 			}
 		}
+
+		if ((0 == rc) && (HOOK_FLAGS(commonInterface, eventNum) & J9HOOK_FLAG_FLATTENED)) {
+			if (!publishListeners(commonInterface, eventNum)) {
+				/* the records are still correct, so dispatch from them instead */
+				HOOK_FLAGS(commonInterface, eventNum) &= ~J9HOOK_FLAG_FLATTENED;
+			}
+		}
 	}
 
 	omrthread_monitor_exit(commonInterface->lock);
@@ -552,6 +824,13 @@ J9HookUnregister(struct J9HookInterface **hookInterface, uintptr_t taggedEventNu
 		HOOK_FLAGS(commonInterface, eventNum) &= ~J9HOOK_FLAG_HOOKED;
 	}
 
+	if ((hooksRemoved != 0) && (HOOK_FLAGS(commonInterface, eventNum) & J9HOOK_FLAG_FLATTENED)) {
+		if (!publishListeners(commonInterface, eventNum)) {
+			/* the records are still correct, so dispatch from them instead */
+			HOOK_FLAGS(commonInterface, eventNum) &= ~J9HOOK_FLAG_FLATTENED;
+		}
+	}
+
 	omrthread_monitor_exit(commonInterface->lock);
 
 	if (hooksRemoved != 0) {
@@ -0,0 +1,332 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "contentionprofiler.h"
+
+#if defined(OMR_THR_JLM)
+
+/*
+ * The samples are drained from the thread library into a table of sites, and the
+ * wait time of each sample is added to a space-saving sketch of the sites. The sketch
+ * keeps the heaviest sites in bounded space. After each aggregation, the sites that
+ * fell out of the sketch are removed from the table, so it stays bounded too.
+ *
+ * The per-thread sample buffers are small, so they are drained periodically by an
+ * aggregator thread, or by the caller if it does not start one.
+ */
+
+static uintptr_t
+siteHashFn(void *entry, void *userData)
+{
+	return (uintptr_t)((OMRContentionSite *)entry)->key;
+}
+
+static uintptr_t
+siteEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	return ((OMRContentionSite *)leftEntry)->key == ((OMRContentionSite *)rightEntry)->key;
+}
+
+static OMRContentionSite *
+findSite(OMRContentionProfiler *profiler, void *key)
+{
+	OMRContentionSite query;
+	query.key = key;
+	return hashTableFind(profiler->sites, &query);
+}
+
+static void
+addSample(OMRContentionProfiler *profiler, J9ThreadContentionSample *sample)
+{
+	void *key = (NULL != sample->callsite) ? sample->callsite : (void *)sample->monitor;
+	OMRContentionSite *site = findSite(profiler, key);
+
+	if (NULL == site) {
+		OMRContentionSite newSite;
+		memset(&newSite, 0, sizeof(newSite));
+		newSite.key = key;
+		newSite.callsite = sample->callsite;
+		site = hashTableAdd(profiler->sites, &newSite);
+		if (NULL == site) {
+			profiler->droppedSamples += 1;
+			return;
+		}
+	}
+
+	/* the monitor at a call site can vary, report the latest one */
+	site->monitor = sample->monitor;
+	memcpy(site->monitorName, sample->monitor_name, sizeof(site->monitorName));
+	site->count += 1;
+	site->waitTime += sample->wait_time;
+	site->holdTime += sample->hold_time;
+	profiler->sampleCount += 1;
+
+	/* count every sample, even if the wait was too short to measure */
+	spaceSavingUpdate(profiler->hotSites, key, (uintptr_t)sample->wait_time + 1);
+}
+
+/*
+ * Remove the sites that are no longer tracked by the sketch.
+ */
+static void
+pruneSites(OMRContentionProfiler *profiler)
+{
+	uintptr_t hotCount = spaceSavingGetCurSize(profiler->hotSites);
+	J9HashTableState state;
+	OMRContentionSite *site = NULL;
+	uintptr_t k = 0;
+
+	if (hashTableGetCount(profiler->sites) <= hotCount) {
+		return;
+	}
+
+	site = hashTableStartDo(profiler->sites, &state);
+	while (NULL != site) {
+		site->hot = FALSE;
+		site = hashTableNextDo(&state);
+	}
+	for (k = 1; k <= hotCount; k++) {
+		site = findSite(profiler, spaceSavingGetKthMostFreq(profiler->hotSites, k));
+		if (NULL != site) {
+			site->hot = TRUE;
+		}
+	}
+	site = hashTableStartDo(profiler->sites, &state);
+	while (NULL != site) {
+		if (!site->hot) {
+			hashTableDoRemove(&state);
+		}
+		site = hashTableNextDo(&state);
+	}
+}
+
+OMRContentionProfiler *
+contentionProfilerNew(OMRPortLibrary *portLibrary, uint32_t topN)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint32_t sketchSize = topN * CONTENTION_PROFILER_SKETCH_RATIO;
+	OMRContentionProfiler *profiler = NULL;
+
+	if (0 == topN) {
+		return NULL;
+	}
+	profiler = omrmem_allocate_memory(sizeof(OMRContentionProfiler), OMRMEM_CATEGORY_THREADS);
+	if (NULL == profiler) {
+		return NULL;
+	}
+	profiler->portLib = portLibrary;
+	profiler->topN = topN;
+	profiler->sampleCount = 0;
+	profiler->droppedSamples = 0;
+	profiler->mutex = NULL;
+	profiler->aggregatorState = CONTENTION_PROFILER_AGGREGATOR_STOPPED;
+	profiler->aggregateIntervalMillis = 0;
+	profiler->aggregations = 0;
+	profiler->hotSites = spaceSavingNew(portLibrary, sketchSize);
+	profiler->sites = hashTableNew(portLibrary, OMR_GET_CALLSITE(), sketchSize * 2, sizeof(OMRContentionSite), 0, 0, OMRMEM_CATEGORY_THREADS, siteHashFn, siteEqualFn, NULL, NULL);
+	profiler->samples = omrmem_allocate_memory(CONTENTION_PROFILER_DRAIN_BATCH * sizeof(J9ThreadContentionSample), OMRMEM_CATEGORY_THREADS);
+	if ((NULL == profiler->hotSites) || (NULL == profiler->sites) || (NULL == profiler->samples)
+		|| (0 != omrthread_monitor_init_with_name(&profiler->mutex, 0, "contention profiler"))
+	) {
+		contentionProfilerFree(profiler);
+		return NULL;
+	}
+
+	return profiler;
+}
+
+void
+contentionProfilerFree(OMRContentionProfiler *profiler)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(profiler->portLib);
+
+	if (NULL != profiler->mutex) {
+		contentionProfilerStopAggregator(profiler);
+		omrthread_monitor_destroy(profiler->mutex);
+	}
+	if (NULL != profiler->hotSites) {
+		spaceSavingFree(profiler->hotSites);
+	}
+	if (NULL != profiler->sites) {
+		hashTableFree(profiler->sites);
+	}
+	omrmem_free_memory(profiler->samples);
+	omrmem_free_memory(profiler);
+}
+
+void
+contentionProfilerClear(OMRContentionProfiler *profiler)
+{
+	J9HashTableState state;
+	OMRContentionSite *site = NULL;
+
+	omrthread_monitor_enter(profiler->mutex);
+	site = hashTableStartDo(profiler->sites, &state);
+	while (NULL != site) {
+		hashTableDoRemove(&state);
+		site = hashTableNextDo(&state);
+	}
+	spaceSavingClear(profiler->hotSites);
+	profiler->sampleCount = 0;
+	profiler->droppedSamples = 0;
+	omrthread_monitor_exit(profiler->mutex);
+}
+
+uintptr_t
+contentionProfilerAggregate(OMRContentionProfiler *profiler)
+{
+	uintptr_t total = 0;
+	uintptr_t count = 0;
+
+	omrthread_monitor_enter(profiler->mutex);
+	do {
+		uintptr_t dropped = 0;
+		uintptr_t i = 0;
+
+		count = omrthread_jlm_contention_drain(profiler->samples, CONTENTION_PROFILER_DRAIN_BATCH, &dropped);
+		profiler->droppedSamples += dropped;
+		for (i = 0; i < count; i++) {
+			addSample(profiler, &profiler->samples[i]);
+		}
+		total += count;
+	} while (CONTENTION_PROFILER_DRAIN_BATCH == count);
+
+	pruneSites(profiler);
+	omrthread_monitor_exit(profiler->mutex);
+
+	return total;
+}
+
+static int J9THREAD_PROC
+aggregatorMain(void *entryArg)
+{
+	OMRContentionProfiler *profiler = (OMRContentionProfiler *)entryArg;
+
+	omrthread_monitor_enter(profiler->mutex);
+	while (CONTENTION_PROFILER_AGGREGATOR_RUNNING == profiler->aggregatorState) {
+		omrthread_monitor_wait_timed(profiler->mutex, profiler->aggregateIntervalMillis, 0);
+		if (CONTENTION_PROFILER_AGGREGATOR_RUNNING == profiler->aggregatorState) {
+			contentionProfilerAggregate(profiler);
+			profiler->aggregations += 1;
+		}
+	}
+	profiler->aggregatorState = CONTENTION_PROFILER_AGGREGATOR_STOPPED;
+	omrthread_monitor_notify_all(profiler->mutex);
+	omrthread_exit(profiler->mutex);
+
+	/* NOT REACHED */
+	return 0;
+}
+
+intptr_t
+contentionProfilerStartAggregator(OMRContentionProfiler *profiler, uintptr_t intervalMillis)
+{
+	intptr_t rc = -1;
+
+	if (0 == intervalMillis) {
+		return rc;
+	}
+	omrthread_monitor_enter(profiler->mutex);
+	if (CONTENTION_PROFILER_AGGREGATOR_STOPPED == profiler->aggregatorState) {
+		omrthread_t thread = NULL;
+
+		profiler->aggregateIntervalMillis = intervalMillis;
+		profiler->aggregatorState = CONTENTION_PROFILER_AGGREGATOR_RUNNING;
+		rc = omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, aggregatorMain, profiler);
+		if (0 != rc) {
+			profiler->aggregatorState = CONTENTION_PROFILER_AGGREGATOR_STOPPED;
+		}
+	}
+	omrthread_monitor_exit(profiler->mutex);
+
+	return rc;
+}
+
+void
+contentionProfilerStopAggregator(OMRContentionProfiler *profiler)
+{
+	omrthread_monitor_enter(profiler->mutex);
+	if (CONTENTION_PROFILER_AGGREGATOR_RUNNING == profiler->aggregatorState) {
+		profiler->aggregatorState = CONTENTION_PROFILER_AGGREGATOR_STOPPING;
+		omrthread_monitor_notify_all(profiler->mutex);
+	}
+	while (CONTENTION_PROFILER_AGGREGATOR_STOPPED != profiler->aggregatorState) {
+		omrthread_monitor_wait(profiler->mutex);
+	}
+	omrthread_monitor_exit(profiler->mutex);
+}
+
+uintptr_t
+contentionProfilerGetTopSites(OMRContentionProfiler *profiler, OMRContentionSite *sites, uintptr_t maxSites)
+{
+	uintptr_t hotCount = 0;
+	uintptr_t found = 0;
+	uintptr_t k = 0;
+
+	omrthread_monitor_enter(profiler->mutex);
+	hotCount = spaceSavingGetCurSize(profiler->hotSites);
+	for (k = 1; (k <= hotCount) && (found < maxSites); k++) {
+		OMRContentionSite *site = findSite(profiler, spaceSavingGetKthMostFreq(profiler->hotSites, k));
+		if (NULL != site) {
+			sites[found] = *site;
+			found += 1;
+		}
+	}
+	omrthread_monitor_exit(profiler->mutex);
+
+	return found;
+}
+
+void
+contentionProfilerReport(OMRContentionProfiler *profiler)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(profiler->portLib);
+	OMRContentionSite *sites = omrmem_allocate_memory(profiler->topN * sizeof(OMRContentionSite), OMRMEM_CATEGORY_THREADS);
+	uintptr_t sampleCount = 0;
+	uintptr_t droppedSamples = 0;
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(profiler->mutex);
+	sampleCount = profiler->sampleCount;
+	droppedSamples = profiler->droppedSamples;
+	if (NULL != sites) {
+		count = contentionProfilerGetTopSites(profiler, sites, profiler->topN);
+	}
+	omrthread_monitor_exit(profiler->mutex);
+
+	omrtty_printf("Monitor contention: %zu samples, %zu dropped\n", sampleCount, droppedSamples);
+	if (NULL == sites) {
+		return;
+	}
+	omrtty_printf("%4s %18s %-32s %10s %20s %20s\n", "rank", "callsite", "monitor", "samples", "wait", "hold");
+	for (i = 0; i < count; i++) {
+		OMRContentionSite *site = &sites[i];
+		omrtty_printf("%4zu %18p %-32s %10zu %20llu %20llu\n",
+			i + 1, site->callsite, site->monitorName, site->count, site->waitTime, site->holdTime);
+	}
+	omrmem_free_memory(sites);
+}
+
+#endif /* OMR_THR_JLM */
@@ -454,45 +454,26 @@ pool_kill(J9Pool *pool)
 }
 
 /**
- *	Asks for the address of a new pool element.
- *
- *	If it succeeds, the address returned will have space for
- *	one element of the correct structure size.
- *
- *	The contents of the element will be set to 0's unless the
- *  POOL_NO_ZERO flag is set on the pool, in which case the
- *  contents are undefined.
- *
- *	If all puddles in the pool are full, a new puddle will be
- *  grafted onto the end of the pool's puddle chain and the
- *  element returned will come from this puddle.
+ * Take the first free slot of the first available puddle, allocating a new
+ * puddle if none are available. This is the body of @ref pool_newElement,
+ * shared with @ref pool_newElements.
  *
  * @param[in] pool
+ * @param[in] puddleList The puddle list of the pool.
  *
- * @return NULL on error
+ * @return NULL if a new puddle could not be allocated
  * @return pointer to a new element otherwise
- *
  */
-void *
-pool_newElement(J9Pool *pool)
+static void *
+pool_takeFreeSlot(J9Pool *pool, J9PoolPuddleList *puddleList)
 {
 	int32_t slot;
 	void *newElement;
 	void *nextFreeElement;
 	J9SRP *puddleSRP;
 	J9PoolPuddle *puddle;
-	J9PoolPuddleList *puddleList;
-
-	Trc_pool_newElement_Entry(pool);
-
-	if (NULL == pool) {
-		Trc_pool_newElement_ExitNoop();
-		return NULL;
-	}
 
 	/* Check if there is a puddle with free slots - if so use it. */
-	puddleList = J9POOL_PUDDLELIST(pool);
-
 	puddle = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
 	if (NULL == puddle) {
 		J9PoolPuddle *head;
@@ -500,7 +481,6 @@ pool_newElement(J9Pool *pool)
 		/* No available puddles. Allocate a new one. */
 		puddle = poolPuddle_new(pool);
 		if (NULL == puddle) {
-			Trc_pool_newElement_Exit(NULL);
 			return NULL;
 		}
 
@@ -547,53 +527,123 @@ pool_newElement(J9Pool *pool)
 		WSRP_SET(puddle->prevAvailablePuddle, NULL);
 	}
 
+	return newElement;
+}
+
+/**
+ *	Asks for the address of a new pool element.
+ *
+ *	If it succeeds, the address returned will have space for
+ *	one element of the correct structure size.
+ *
+ *	The contents of the element will be set to 0's unless the
+ *  POOL_NO_ZERO flag is set on the pool, in which case the
+ *  contents are undefined.
+ *
+ *	If all puddles in the pool are full, a new puddle will be
+ *  grafted onto the end of the pool's puddle chain and the
+ *  element returned will come from this puddle.
+ *
+ * @param[in] pool
+ *
+ * @return NULL on error
+ * @return pointer to a new element otherwise
+ *
+ */
+void *
+pool_newElement(J9Pool *pool)
+{
+	void *newElement;
+
+	Trc_pool_newElement_Entry(pool);
+
+	if (NULL == pool) {
+		Trc_pool_newElement_ExitNoop();
+		return NULL;
+	}
+
+	newElement = pool_takeFreeSlot(pool, J9POOL_PUDDLELIST(pool));
+
 	Trc_pool_newElement_Exit(newElement);
 
 	return newElement;
 }
 
 /**
- *	Deallocates an element from a pool.
+ *	Allocates several pool elements at once.
  *
- * It is safe to call pool_removeElement() while looping over the
- * pool with @ref pool_startDo / @ref pool_nextDo on the element
- * returned by those calls.
+ *	Each element is allocated as by @ref pool_newElement, but the
+ *  argument checks and trace points are paid once for the whole
+ *  batch, and a caller that serializes access to the pool needs
+ *  to take its lock only once.
  *
  * @param[in] pool
+ * @param[in] count The number of elements wanted
+ * @param[out] elements Array of at least count entries, filled with the new elements
+ *
+ * @return the number of elements allocated, which is less than count
+ * only if a new puddle could not be allocated
+ *
+ */
+uintptr_t
+pool_newElements(J9Pool *pool, uintptr_t count, void **elements)
+{
+	uintptr_t allocated = 0;
+
+	Trc_pool_newElements_Entry(pool, count, elements);
+
+	if (!(pool && elements)) {
+		Trc_pool_newElements_ExitNoop();
+		return 0;
+	}
+
+	{
+		J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+
+		while (allocated < count) {
+			void *newElement = pool_takeFreeSlot(pool, puddleList);
+			if (NULL == newElement) {
+				break;
+			}
+			elements[allocated] = newElement;
+			allocated += 1;
+		}
+	}
+
+	Trc_pool_newElements_Exit(allocated);
+
+	return allocated;
+}
+
+/**
+ * Return an element to the free list of its puddle, freeing the puddle
+ * if it becomes empty. This is the body of @ref pool_removeElement,
+ * shared with @ref pool_removeElements.
+ *
+ * @param[in] pool
+ * @param[in] puddleList The puddle list of the pool.
  * @param[in] anElement Pointer to the element to be removed
  *
  * @return none
- *
  */
-void
-pool_removeElement(J9Pool *pool, void *anElement)
+static void
+pool_releaseSlot(J9Pool *pool, J9PoolPuddleList *puddleList, void *anElement)
 {
 	J9SRP *puddleSRP;
 	int32_t slot;
 	J9PoolPuddle *puddle;
-	J9PoolPuddleList *puddleList;
 	void *freeLocation;
 
-	Trc_pool_removeElement_Entry(pool, anElement);
-
-	if (!(pool && anElement)) {
-		Trc_pool_removeElement_ExitNoop();
-		return;
-	}
-
-	puddleList = J9POOL_PUDDLELIST(pool);
 	puddleSRP = pool_getElementPuddleSRP(pool, anElement);
 	puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
 	slot = pool_getElementPuddleSlot(pool, puddle, anElement);
 	if (slot < 0) {
 		Trc_pool_removeElement_NotFound(anElement, J9POOLPUDDLELIST_NEXTPUDDLE(puddleList));
-		Trc_pool_removeElement_Exit();
 		return;		/* this is an error...  we were passed a bogus data pointer. */
 	}
 
 	if (PUDDLE_SLOT_FREE(puddle, slot)) {
 		Trc_pool_removeElement_NotFound(anElement, puddle);
-		Trc_pool_removeElement_Exit();
 		return;		/* this is an error... the slot was already free. */
 	}
 
@@ -618,10 +668,73 @@ pool_removeElement(J9Pool *pool, void *anElement)
 			WSRP_SET(next->prevAvailablePuddle, puddle);
 		}
 	}
+}
+
+/**
+ *	Deallocates an element from a pool.
+ *
+ * It is safe to call pool_removeElement() while looping over the
+ * pool with @ref pool_startDo / @ref pool_nextDo on the element
+ * returned by those calls.
+ *
+ * @param[in] pool
+ * @param[in] anElement Pointer to the element to be removed
+ *
+ * @return none
+ *
+ */
+void
+pool_removeElement(J9Pool *pool, void *anElement)
+{
+	Trc_pool_removeElement_Entry(pool, anElement);
+
+	if (!(pool && anElement)) {
+		Trc_pool_removeElement_ExitNoop();
+		return;
+	}
+
+	pool_releaseSlot(pool, J9POOL_PUDDLELIST(pool), anElement);
 
 	Trc_pool_removeElement_Exit();
 }
 
+/**
+ *	Deallocates several elements from a pool at once.
+ *
+ *	Each element is removed as by @ref pool_removeElement. NULL
+ *  entries in the array are skipped.
+ *
+ * @param[in] pool
+ * @param[in] count The number of entries in elements
+ * @param[in] elements Array of the elements to be removed
+ *
+ * @return none
+ *
+ */
+void
+pool_removeElements(J9Pool *pool, uintptr_t count, void **elements)
+{
+	Trc_pool_removeElements_Entry(pool, count, elements);
+
+	if (!(pool && elements)) {
+		Trc_pool_removeElements_ExitNoop();
+		return;
+	}
+
+	{
+		J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+		uintptr_t i = 0;
+
+		for (i = 0; i < count; i++) {
+			if (NULL != elements[i]) {
+				pool_releaseSlot(pool, puddleList, elements[i]);
+			}
+		}
+	}
+
+	Trc_pool_removeElements_Exit();
+}
+
 /**
  *	Calls a user provided function for each element in the list.
  *
@@ -0,0 +1,318 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Pool
+ * @brief Per-thread element caches (magazines) for pools shared between threads
+ *
+ * A J9Pool is not thread safe. J9PoolMagazines puts a monitor around the pool and
+ * gives every thread a magazine of up to 2 * batchSize free elements. Elements are
+ * allocated from and freed to the magazine of the current thread without locking.
+ * An empty magazine is refilled with batchSize elements, and a full one gives
+ * batchSize elements back, in a single pool_newElements or pool_removeElements call.
+ *
+ * Elements cached in magazines are still allocated as far as the pool is concerned.
+ * They are counted by pool_numElements and returned by pool_startDo/pool_nextDo.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "omrport.h"
+#include "omrthread.h"
+#include "pool_internal.h"
+#include "ut_pool.h"
+
+#define MAGAZINE_CAPACITY(magazines) (2 * (magazines)->batchSize)
+
+/**
+ * Return the elements cached in magazine to the pool. The caller must hold the pool mutex.
+ */
+static void
+flushMagazine(J9PoolMagazines *magazines, J9PoolMagazine *magazine)
+{
+	pool_removeElements(magazines->pool, magazine->count, magazine->elements);
+	magazine->count = 0;
+}
+
+/**
+ * Unlink magazine from the list of magazines. The caller must hold the pool mutex.
+ */
+static void
+unlinkMagazine(J9PoolMagazines *magazines, J9PoolMagazine *magazine)
+{
+	if (NULL != magazine->next) {
+		magazine->next->previous = magazine->previous;
+	}
+	if (magazines->magazines == magazine) {
+		magazines->magazines = magazine->next;
+	} else if (NULL != magazine->previous) {
+		magazine->previous->next = magazine->next;
+	}
+}
+
+/**
+ * TLS finalizer for the magazines, called when a thread detaches.
+ */
+static void
+magazineFinalizer(void *value)
+{
+	J9PoolMagazine *magazine = (J9PoolMagazine *)value;
+	J9PoolMagazines *magazines = magazine->owner;
+	OMRPORT_ACCESS_FROM_OMRPORT(magazines->portLibrary);
+
+	omrthread_monitor_enter(magazines->poolMutex);
+	flushMagazine(magazines, magazine);
+	unlinkMagazine(magazines, magazine);
+	omrthread_monitor_exit(magazines->poolMutex);
+
+	omrmem_free_memory(magazine);
+}
+
+/**
+ * Get the magazine of the current thread, creating it on first use.
+ *
+ * @return the magazine, or NULL if the thread is not attached to the thread
+ * library or the magazine could not be allocated
+ */
+static J9PoolMagazine *
+getMagazine(J9PoolMagazines *magazines)
+{
+	omrthread_t self = omrthread_self();
+	J9PoolMagazine *magazine = NULL;
+
+	if (NULL != self) {
+		magazine = (J9PoolMagazine *)omrthread_tls_get(self, magazines->tlsKey);
+		if (NULL == magazine) {
+			OMRPORT_ACCESS_FROM_OMRPORT(magazines->portLibrary);
+			uintptr_t size = offsetof(J9PoolMagazine, elements) + (MAGAZINE_CAPACITY(magazines) * sizeof(void *));
+
+			magazine = (J9PoolMagazine *)omrmem_allocate_memory(size, magazines->pool->memoryCategory);
+			if (NULL != magazine) {
+				magazine->owner = magazines;
+				magazine->previous = NULL;
+				magazine->count = 0;
+
+				omrthread_monitor_enter(magazines->poolMutex);
+				magazine->next = magazines->magazines;
+				if (NULL != magazines->magazines) {
+					magazines->magazines->previous = magazine;
+				}
+				magazines->magazines = magazine;
+				omrthread_monitor_exit(magazines->poolMutex);
+
+				omrthread_tls_set(self, magazines->tlsKey, magazine);
+			}
+		}
+	}
+
+	return magazine;
+}
+
+/**
+ * Create per-thread magazines for a pool. From then on, all threads must
+ * allocate and free elements of the pool through the magazines, or hold
+ * magazines->poolMutex while using the pool directly.
+ *
+ * @param[in] portLib The port library used to allocate the magazines
+ * @param[in] pool The pool to cache elements from
+ * @param[in] batchSize The number of elements moved between a magazine and the pool at once.
+ * If zero, J9POOL_MAGAZINE_DEFAULT_BATCH_SIZE is used.
+ *
+ * @return the magazines, or NULL if they could not be created
+ */
+J9PoolMagazines *
+poolMagazines_new(OMRPortLibrary *portLib, J9Pool *pool, uintptr_t batchSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9PoolMagazines *magazines = NULL;
+
+	Trc_poolMagazines_new_Entry(pool, batchSize);
+
+	if (NULL != pool) {
+		magazines = (J9PoolMagazines *)omrmem_allocate_memory(sizeof(J9PoolMagazines), pool->memoryCategory);
+		if (NULL != magazines) {
+			magazines->pool = pool;
+			magazines->portLibrary = portLib;
+			magazines->batchSize = (0 == batchSize) ? J9POOL_MAGAZINE_DEFAULT_BATCH_SIZE : batchSize;
+			magazines->magazines = NULL;
+
+			if (0 != omrthread_monitor_init_with_name(&magazines->poolMutex, 0, "pool magazines")) {
+				omrmem_free_memory(magazines);
+				magazines = NULL;
+			} else if (0 != omrthread_tls_alloc_with_finalizer(&magazines->tlsKey, magazineFinalizer)) {
+				omrthread_monitor_destroy(magazines->poolMutex);
+				omrmem_free_memory(magazines);
+				magazines = NULL;
+			}
+		}
+	}
+
+	Trc_poolMagazines_new_Exit(magazines);
+
+	return magazines;
+}
+
+/**
+ * Return the elements cached by every thread to the pool and free the magazines.
+ * The pool itself is not killed. No other thread may use the magazines while they
+ * are being killed, and threads that are detaching from the thread library at the
+ * same time must have called poolMagazines_flush first.
+ *
+ * @param[in] magazines The magazines to kill
+ */
+void
+poolMagazines_kill(J9PoolMagazines *magazines)
+{
+	Trc_poolMagazines_kill_Entry(magazines);
+
+	if (NULL != magazines) {
+		OMRPORT_ACCESS_FROM_OMRPORT(magazines->portLibrary);
+		J9PoolMagazine *magazine = NULL;
+
+		/* clears the magazine of every thread, so no finalizer runs for them later */
+		omrthread_tls_free(magazines->tlsKey);
+
+		magazine = magazines->magazines;
+		while (NULL != magazine) {
+			J9PoolMagazine *next = magazine->next;
+			flushMagazine(magazines, magazine);
+			omrmem_free_memory(magazine);
+			magazine = next;
+		}
+
+		omrthread_monitor_destroy(magazines->poolMutex);
+		omrmem_free_memory(magazines);
+	}
+
+	Trc_poolMagazines_kill_Exit();
+}
+
+/**
+ * Allocate an element from the magazine of the current thread, refilling
+ * the magazine from the pool if it is empty.
+ *
+ * The contents of the element are set to 0's unless the pool has the
+ * POOL_NO_ZERO flag, in which case they are undefined.
+ *
+ * @param[in] magazines
+ *
+ * @return NULL on error
+ * @return pointer to a new element otherwise
+ */
+void *
+poolMagazines_newElement(J9PoolMagazines *magazines)
+{
+	J9Pool *pool = magazines->pool;
+	J9PoolMagazine *magazine = getMagazine(magazines);
+	void *newElement = NULL;
+
+	if (NULL == magazine) {
+		omrthread_monitor_enter(magazines->poolMutex);
+		newElement = pool_newElement(pool);
+		omrthread_monitor_exit(magazines->poolMutex);
+	} else {
+		if (0 == magazine->count) {
+			omrthread_monitor_enter(magazines->poolMutex);
+			magazine->count = pool_newElements(pool, magazines->batchSize, magazine->elements);
+			omrthread_monitor_exit(magazines->poolMutex);
+		}
+		if (0 != magazine->count) {
+			magazine->count -= 1;
+			newElement = magazine->elements[magazine->count];
+			if (!(pool->flags & POOL_NO_ZERO)) {
+				/* Unless the pool uses holes, the last word of the element is the SRP to its puddle. */
+				memset(newElement, 0, (pool->flags & POOL_USES_HOLES) ? pool->elementSize : (pool->elementSize - sizeof(J9SRP)));
+			}
+		}
+	}
+
+	return newElement;
+}
+
+/**
+ * Free an element to the magazine of the current thread. If the magazine is
+ * full, batchSize elements are first returned to the pool.
+ *
+ * @param[in] magazines
+ * @param[in] anElement Pointer to the element to be freed
+ */
+void
+poolMagazines_removeElement(J9PoolMagazines *magazines, void *anElement)
+{
+	J9PoolMagazine *magazine = NULL;
+
+	if (NULL == anElement) {
+		return;
+	}
+
+	magazine = getMagazine(magazines);
+	if (NULL == magazine) {
+		omrthread_monitor_enter(magazines->poolMutex);
+		pool_removeElement(magazines->pool, anElement);
+		omrthread_monitor_exit(magazines->poolMutex);
+	} else {
+		if (MAGAZINE_CAPACITY(magazines) == magazine->count) {
+			uintptr_t keep = magazine->count - magazines->batchSize;
+
+			omrthread_monitor_enter(magazines->poolMutex);
+			pool_removeElements(magazines->pool, magazines->batchSize, &magazine->elements[keep]);
+			omrthread_monitor_exit(magazines->poolMutex);
+			magazine->count = keep;
+		}
+		magazine->elements[magazine->count] = anElement;
+		magazine->count += 1;
+	}
+}
+
+/**
+ * Return the elements cached by the current thread to the pool and free its
+ * magazine. A thread that stops using the magazines should call this before
+ * it goes idle for a long time, and must call it before it detaches if the
+ * magazines may be killed concurrently with its TLS finalizers. A new magazine
+ * is created if the thread uses the magazines again.
+ *
+ * @param[in] magazines
+ */
+void
+poolMagazines_flush(J9PoolMagazines *magazines)
+{
+	omrthread_t self = omrthread_self();
+
+	if (NULL != self) {
+		J9PoolMagazine *magazine = (J9PoolMagazine *)omrthread_tls_get(self, magazines->tlsKey);
+
+		if (NULL != magazine) {
+			OMRPORT_ACCESS_FROM_OMRPORT(magazines->portLibrary);
+
+			omrthread_tls_set(self, magazines->tlsKey, NULL);
+
+			omrthread_monitor_enter(magazines->poolMutex);
+			flushMagazine(magazines, magazine);
+			unlinkMagazine(magazines, magazine);
+			omrthread_monitor_exit(magazines->poolMutex);
+
+			omrmem_free_memory(magazine);
+		}
+	}
+}